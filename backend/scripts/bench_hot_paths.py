@@ -0,0 +1,469 @@
+"""Hot-path microbenchmarks — the text work done on every request.
+
+Cases (each run at 1 KB, 10 KB, 100 KB and 1 MB of transcript unless noted):
+
+  compress          ``compress_transcript`` on the transcript
+  cache_put         ``ResponseCache.put`` keyed by the transcript
+  cache_get         ``ResponseCache.get`` hit for the same key
+  add_chunk         ``TranscriptManager.add_chunk`` for every segment
+  full_transcript   ``TranscriptManager.get_full_transcript``
+  extract_json      ``SummaryAgent._extract_json`` on a reply that wraps a
+                    fenced JSON object in prose the size of the transcript
+  classify          ``classify_query_complexity`` over a fixed question set
+                    (one size: ``questions``)
+
+The corpus is a mixed Spanish/English/Portuguese meeting (fillers,
+repeated sentences, several speakers) generated from a fixed seed, so
+every run on every machine times the same bytes — its SHA-256 is written
+to the output to prove it.
+
+Variants: each case times the code in ``meetmind`` as variant ``python``.
+A replacement implementation (a compiled extension, a rewritten regex)
+is benchmarked next to it by passing ``--variants some.module``; that
+module calls ``register(case, name, setup)`` at import time with the same
+``setup(size) -> (callable, bytes)`` signature, and its output must match
+the ``python`` variant's before it is timed.
+
+Timing: the loop count is calibrated so one repeat takes ``--min-time``,
+then ``--repeats`` repeats are run and the median is reported (with the
+min and the interquartile range as a share of the median).
+
+Baselines: ``--save-baseline`` writes the results; ``--baseline`` compares
+against a stored file and exits 1 when a case got slower by more than
+``--threshold`` *and* its fastest repeat is still slower than the
+baseline median (so one noisy repeat doesn't fail the run). Absolute
+numbers are only comparable on the same kind of host; the baseline
+records arch/ISA/Python and a mismatch is reported.
+
+Run:
+    cd backend && uv run python scripts/bench_hot_paths.py
+    cd backend && uv run python scripts/bench_hot_paths.py --case compress --size 1m
+    cd backend && uv run python scripts/bench_hot_paths.py --json out.json \\
+        --baseline scripts/baselines/hot_paths.json
+"""
+
+from __future__ import annotations
+
+import argparse
+import hashlib
+import importlib
+import json
+import logging
+import platform
+import random
+import statistics
+import sys
+import time
+from collections.abc import Callable
+from dataclasses import asdict, dataclass
+from pathlib import Path
+from typing import Any
+
+import structlog
+
+from meetmind.agents.copilot_agent import classify_query_complexity
+from meetmind.agents.summary_agent import SummaryAgent
+from meetmind.core.transcript import TranscriptManager
+from meetmind.utils.compressor import compress_transcript
+from meetmind.utils.cpu_features import host_features
+from meetmind.utils.response_cache import ResponseCache
+
+SIZES = {"1k": 1_000, "10k": 10_000, "100k": 100_000, "1m": 1_000_000}
+CORPUS_SEED = 114
+DEFAULT_BASELINE = Path(__file__).parent / "baselines" / "hot_paths.json"
+
+# ─── Corpus ─────────────────────────────────────────────────────
+
+_SPEAKERS = ("Ana", "Luis", "Maria", "John", "Paulo")
+_SENTENCES = {
+    "es": (
+        "Bueno, o sea, el presupuesto del trimestre está cerrado.",
+        "Entonces entonces revisamos los riesgos del lanzamiento.",
+        "Pues digamos que el cliente quiere la demo el viernes.",
+        "¿Quién se encarga de la migración de la base de datos?",
+        "Este, necesitamos aprobar el contrato antes del lunes.",
+        "Sí sí sí, lo hablamos con el equipo de ventas ayer.",
+    ),
+    "en": (
+        "Um, so basically we need to ship the release next week.",
+        "You know, the latency numbers look kind of high today.",
+        "I mean, who owns the follow-up with the vendor?",
+        "Actually we agreed to move the launch to March.",
+        "Uh, let's literally write down the action items now.",
+        "Okay so the risk is the data migration slipping.",
+    ),
+    "pt": (
+        "Então então, a gente fecha o escopo amanhã, né?",
+        "Tipo, o orçamento ainda não foi aprovado pela diretoria.",
+        "Quem disse que o prazo era sexta-feira?",
+        "Bom bom, vamos revisar os riscos do projeto.",
+        "Aí aí, precisamos de mais gente no time de dados.",
+        "Tá tá, eu mando o resumo para o cliente hoje.",
+    ),
+}
+_QUESTIONS = (
+    "who said that?",
+    "What time is the demo?",
+    "How many action items do we have so far?",
+    "Why did we move the launch and what is the impact on the budget?",
+    "Explain the risk with the data migration",
+    "¿Quién dijo que el contrato estaba aprobado?",
+    "¿Por qué el cliente quiere la demo el viernes?",
+    "Analiza el impacto del retraso en el presupuesto del trimestre",
+    "Quem disse que o prazo era sexta-feira?",
+    "Explique o risco do projeto para a diretoria",
+    "Repeat the last decision please",
+    "Can you summarize the discussion about the vendor so far?",
+    "Suggest next steps for the release",
+    "List the owners of each action item we mentioned",
+)
+
+
+def corpus_segments(size: int, seed: int = CORPUS_SEED) -> list[tuple[str, str]]:
+    """Deterministic multilingual meeting of at least ``size`` UTF-8 bytes.
+
+    Language runs switch every few segments; about one sentence in ten is
+    repeated immediately (the compressor's dedup path).
+
+    Args:
+        size: Minimum transcript size in bytes (segments joined by spaces).
+        seed: Generator seed.
+
+    Returns:
+        ``(speaker, text)`` segments.
+    """
+    rng = random.Random(seed)  # noqa: S311 — reproducible corpus, not security
+    segments: list[tuple[str, str]] = []
+    total = 0
+    language = "es"
+    while total < size:
+        if rng.random() < 0.25:
+            language = rng.choice(tuple(_SENTENCES))
+        sentences = rng.sample(_SENTENCES[language], k=rng.randint(1, 3))
+        if rng.random() < 0.1:
+            sentences.append(sentences[-1])
+        text = " ".join(sentences)
+        segments.append((rng.choice(_SPEAKERS), text))
+        total += len(text.encode()) + 1
+    return segments
+
+
+def corpus_text(size: int, seed: int = CORPUS_SEED) -> str:
+    """The corpus as one transcript string (as ``get_full_transcript`` joins it)."""
+    return " ".join(text for _, text in corpus_segments(size, seed))
+
+
+def _llm_reply(prose: str) -> str:
+    """A summary reply with the JSON fenced inside prose (the slow path)."""
+    payload = {
+        "title": "Planning sync",
+        "summary": prose[:500],
+        "key_topics": ["budget", "launch", "migration"],
+        "decisions": [{"what": "Move launch to March", "who": "Ana"}],
+        "action_items": [{"task": "Send summary", "owner": "Paulo", "due": "Friday"}],
+        "risks": [{"risk": "Migration slips", "severity": "high"}],
+        "next_steps": ["Review scope"],
+    }
+    half = len(prose) // 2
+    return (
+        f"Here is the summary you asked for. {prose[:half]}\n"
+        f"```json\n{json.dumps(payload, ensure_ascii=False, indent=2)}\n```\n"
+        f"{prose[half:]}"
+    )
+
+
+# ─── Cases ──────────────────────────────────────────────────────
+
+Setup = Callable[[str], tuple[Callable[[], Any], int]]
+
+
+def _compress(size: str) -> tuple[Callable[[], Any], int]:
+    text = corpus_text(SIZES[size])
+    return (lambda: compress_transcript(text).text), len(text.encode())
+
+
+def _cache_put(size: str) -> tuple[Callable[[], Any], int]:
+    text = corpus_text(SIZES[size])
+    cache = ResponseCache(max_entries=100)
+    response = {"relevant": False, "reason": "small talk"}
+
+    def run() -> int:
+        cache.put(text, response)
+        return cache.size
+
+    return run, len(text.encode())
+
+
+def _cache_get(size: str) -> tuple[Callable[[], Any], int]:
+    text = corpus_text(SIZES[size])
+    cache = ResponseCache(max_entries=100, ttl_seconds=3600)
+    cache.put(text, {"relevant": False, "reason": "small talk"})
+    return (lambda: cache.get(text)), len(text.encode())
+
+
+def _add_chunk(size: str) -> tuple[Callable[[], Any], int]:
+    segments = corpus_segments(SIZES[size])
+
+    def run() -> int:
+        manager = TranscriptManager()
+        for speaker, text in segments:
+            manager.add_chunk(text, speaker=speaker)
+        return manager.segment_count
+
+    return run, sum(len(text.encode()) for _, text in segments)
+
+
+def _full_transcript(size: str) -> tuple[Callable[[], Any], int]:
+    manager = TranscriptManager()
+    for speaker, text in corpus_segments(SIZES[size]):
+        manager.add_chunk(text, speaker=speaker)
+    full = manager.get_full_transcript()
+    return manager.get_full_transcript, len(full.encode())
+
+
+def _extract_json(size: str) -> tuple[Callable[[], Any], int]:
+    reply = _llm_reply(corpus_text(SIZES[size]))
+    agent = SummaryAgent(provider=None)  # type: ignore[arg-type]
+    return (lambda: agent._extract_json(reply)), len(reply.encode())
+
+
+def _classify(size: str) -> tuple[Callable[[], Any], int]:
+    del size
+    return (
+        lambda: [classify_query_complexity(q) for q in _QUESTIONS],
+        sum(len(q.encode()) for q in _QUESTIONS),
+    )
+
+
+_TEXT_SIZES = tuple(SIZES)
+CASES: dict[str, tuple[tuple[str, ...], dict[str, Setup]]] = {
+    "compress": (_TEXT_SIZES, {"python": _compress}),
+    "cache_put": (_TEXT_SIZES, {"python": _cache_put}),
+    "cache_get": (_TEXT_SIZES, {"python": _cache_get}),
+    "add_chunk": (_TEXT_SIZES, {"python": _add_chunk}),
+    "full_transcript": (_TEXT_SIZES, {"python": _full_transcript}),
+    "extract_json": (_TEXT_SIZES, {"python": _extract_json}),
+    "classify": (("questions",), {"python": _classify}),
+}
+
+
+def register(case: str, variant: str, setup: Setup) -> None:
+    """Add an alternative implementation of a case (called by ``--variants`` modules)."""
+    if case not in CASES:
+        raise ValueError(f"Unknown case {case!r} (known: {', '.join(CASES)})")
+    CASES[case][1][variant] = setup
+
+
+# ─── Timing ─────────────────────────────────────────────────────
+
+
+@dataclass
+class Result:
+    """Timing of one case x size x variant."""
+
+    case: str
+    size: str
+    variant: str
+    bytes: int
+    loops: int
+    median_ns: float
+    min_ns: float
+    iqr_pct: float
+    mb_per_s: float
+
+    @property
+    def key(self) -> str:
+        """Identity used to match baseline entries."""
+        return f"{self.case}/{self.size}/{self.variant}"
+
+
+def measure(fn: Callable[[], Any], min_time: float, repeats: int) -> tuple[int, list[float]]:
+    """Calibrate a loop count, then time ``repeats`` repeats.
+
+    Returns:
+        The loop count and per-call nanoseconds of each repeat.
+    """
+    loops = 1
+    while True:
+        start = time.perf_counter_ns()
+        for _ in range(loops):
+            fn()
+        elapsed = time.perf_counter_ns() - start
+        if elapsed >= min_time * 1e9 or loops >= 1 << 20:
+            break
+        loops *= 2 if elapsed <= 0 else max(2, min(10, int(min_time * 1e9 / elapsed) + 1))
+
+    samples: list[float] = []
+    for _ in range(repeats):
+        start = time.perf_counter_ns()
+        for _ in range(loops):
+            fn()
+        samples.append((time.perf_counter_ns() - start) / loops)
+    return loops, samples
+
+
+def run_case(
+    case: str, size: str, variant: str, setup: Setup, min_time: float, repeats: int
+) -> Result:
+    """Set up and time one case x size x variant."""
+    fn, nbytes = setup(size)
+    loops, samples = measure(fn, min_time, repeats)
+    median = statistics.median(samples)
+    quartiles = statistics.quantiles(samples, n=4) if len(samples) > 1 else [median] * 3
+    return Result(
+        case=case,
+        size=size,
+        variant=variant,
+        bytes=nbytes,
+        loops=loops,
+        median_ns=round(median, 1),
+        min_ns=round(min(samples), 1),
+        iqr_pct=round((quartiles[2] - quartiles[0]) / median * 100, 1) if median else 0.0,
+        mb_per_s=round(nbytes / median * 1e3, 2) if median else 0.0,
+    )
+
+
+def check_variants(case: str, size: str, setups: dict[str, Setup]) -> list[str]:
+    """Variants whose output differs from the ``python`` reference."""
+    reference = setups["python"](size)[0]()
+    return [
+        name for name, setup in setups.items() if name != "python" and setup(size)[0]() != reference
+    ]
+
+
+# ─── Baseline ───────────────────────────────────────────────────
+
+
+def host_meta() -> dict[str, Any]:
+    """Where the numbers came from."""
+    features = host_features()
+    return {
+        "arch": features.arch,
+        "isa": features.isa,
+        "cpus": features.cpus,
+        "python": platform.python_version(),
+        "implementation": platform.python_implementation(),
+        "corpus_sha256": hashlib.sha256(corpus_text(SIZES["1m"]).encode()).hexdigest(),
+    }
+
+
+def compare(
+    results: list[Result], baseline: dict[str, Any], threshold: float
+) -> tuple[list[str], list[str]]:
+    """Compare results against a stored baseline.
+
+    Args:
+        results: Current run.
+        baseline: Parsed baseline file.
+        threshold: Allowed slowdown as a fraction (0.15 = 15%).
+
+    Returns:
+        ``(regressions, notes)`` as printable lines.
+    """
+    notes: list[str] = []
+    meta, current = baseline.get("meta", {}), host_meta()
+    for field_name in ("arch", "isa", "python", "corpus_sha256"):
+        if meta.get(field_name) != current[field_name]:
+            notes.append(
+                f"baseline {field_name}={meta.get(field_name)} vs {current[field_name]}"
+                " — absolute numbers may not be comparable"
+            )
+
+    previous = {f"{r['case']}/{r['size']}/{r['variant']}": r for r in baseline.get("results", [])}
+    regressions: list[str] = []
+    for result in results:
+        before = previous.get(result.key)
+        if before is None:
+            notes.append(f"{result.key}: not in baseline")
+            continue
+        ratio = result.median_ns / before["median_ns"]
+        if ratio > 1 + threshold and result.min_ns > before["median_ns"]:
+            regressions.append(
+                f"{result.key}: {_fmt_ns(before['median_ns'])} -> "
+                f"{_fmt_ns(result.median_ns)} ({(ratio - 1) * 100:+.0f}%)"
+            )
+    return regressions, notes
+
+
+# ─── Report ─────────────────────────────────────────────────────
+
+
+def _fmt_ns(ns: float) -> str:
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("µs", 1e3)):
+        if ns >= scale:
+            return f"{ns / scale:.2f}{unit}"
+    return f"{ns:.0f}ns"
+
+
+def print_results(results: list[Result]) -> None:
+    """Human-readable table."""
+    header = ("case", "size", "variant", "median", "min", "iqr", "MB/s")
+    print("{:<16} {:>9} {:<10} {:>10} {:>10} {:>6} {:>9}".format(*header))
+    for r in results:
+        print(
+            f"{r.case:<16} {r.size:>9} {r.variant:<10} {_fmt_ns(r.median_ns):>10} "
+            f"{_fmt_ns(r.min_ns):>10} {r.iqr_pct:>5.1f}% {r.mb_per_s:>9.1f}"
+        )
+
+
+def main() -> None:
+    """CLI entry point."""
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--case", action="append", choices=list(CASES), help="Repeatable")
+    parser.add_argument("--size", action="append", help="Repeatable: 1k, 10k, 100k, 1m")
+    parser.add_argument("--variants", action="append", default=[], help="Module to import")
+    parser.add_argument("--min-time", type=float, default=0.1, help="Seconds per repeat")
+    parser.add_argument("--repeats", type=int, default=7)
+    parser.add_argument("--json", help="Write results as JSON")
+    parser.add_argument("--baseline", help="Compare against this baseline file")
+    parser.add_argument("--threshold", type=float, default=0.15, help="Allowed slowdown")
+    parser.add_argument("--save-baseline", nargs="?", const=str(DEFAULT_BASELINE))
+    args = parser.parse_args()
+
+    # Time the code, not the debug log renderer
+    structlog.configure(wrapper_class=structlog.make_filtering_bound_logger(logging.WARNING))
+    # Variant modules `import bench_hot_paths`; make that this (__main__) module
+    sys.modules.setdefault("bench_hot_paths", sys.modules[__name__])
+    for module in args.variants:
+        importlib.import_module(module)
+
+    results: list[Result] = []
+    mismatched: list[str] = []
+    for case in args.case or CASES:
+        sizes, setups = CASES[case]
+        for size in sizes:
+            if args.size and size not in args.size and size != "questions":
+                continue
+            mismatched += [f"{case}/{size}/{v}" for v in check_variants(case, size, setups)]
+            for variant, setup in setups.items():
+                results.append(run_case(case, size, variant, setup, args.min_time, args.repeats))
+
+    print_results(results)
+    report = {"meta": host_meta(), "results": [asdict(r) for r in results]}
+    for path in filter(None, (args.json, args.save_baseline)):
+        Path(path).parent.mkdir(parents=True, exist_ok=True)
+        Path(path).write_text(json.dumps(report, indent=2) + "\n")
+        print(f"\nWrote {path}")
+
+    status = 0
+    if mismatched:
+        print("\nOutput differs from the python reference: " + ", ".join(mismatched))
+        status = 1
+    if args.baseline:
+        regressions, notes = compare(
+            results, json.loads(Path(args.baseline).read_text()), args.threshold
+        )
+        for note in notes:
+            print(f"note: {note}")
+        if regressions:
+            print(f"\nRegressions (> {args.threshold:.0%} slower than {args.baseline}):")
+            for line in regressions:
+                print(f"  {line}")
+            status = 1
+        else:
+            print(f"\nNo regressions against {args.baseline}")
+    sys.exit(status)
+
+
+if __name__ == "__main__":
+    main()
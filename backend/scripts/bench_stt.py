@@ -0,0 +1,472 @@
+"""STT benchmark — real-time factor, latency and accuracy per engine.
+
+Runs one or more speech-to-text engines over a fixed WAV corpus with
+reference transcripts and reports, per engine and language:
+
+  RTF            compute time / audio duration (audio is fed as fast as
+                 the engine takes it unless ``--realtime``)
+  partial        latency of ``feed()`` calls that produced a new partial
+                 hypothesis (p50/p95) — streaming engines only
+  final          latency of ``finish()``: end of audio to final text
+  WER / CER      corpus-level word / character error rate against the
+                 references (NFKC, lowercased, punctuation stripped)
+  peak RSS       of the worker process and any engine subprocess
+
+Each engine runs in a fresh worker process so peak RSS and model load
+time are its own, and every result records the host arch/ISA tier
+(``utils.cpu_features``) — run the same corpus on c7g and c7i and pass
+both JSON files to ``compare`` for per-ISA numbers side by side.
+
+Engines (``--engine``, repeatable):
+
+  faster-whisper[:MODEL]   faster_whisper in-process, int8 on CPU (final only)
+  cmd:TEMPLATE             any native binary (whisper.cpp, sherpa-onnx, ...):
+                           ``{wav}`` and ``{lang}`` are substituted, stdout is
+                           the transcript (final only)
+  MODULE:FACTORY           Python factory returning an ``SttEngine`` — the
+                           way to benchmark a streaming binding with partials
+
+Corpus layout — the language comes from the directory name::
+
+    corpus/es/<name>.wav   16 kHz mono PCM16
+    corpus/es/<name>.txt   reference transcript
+    corpus/en/...
+
+``gen_meetings.py`` writes synthetic meetings in this layout. Every WAV's
+SHA-256 goes into the results so runs are only compared on
+identical audio.
+
+Run:
+    cd backend && uv run python scripts/bench_stt.py run corpus/ --engine faster-whisper:small
+    cd backend && uv run python scripts/bench_stt.py run corpus/ \\
+        --engine 'cmd:whisper-cli -m ggml-small.bin -l {lang} -nt -np -f {wav}' --json c7g.json
+    cd backend && uv run python scripts/bench_stt.py compare c7g.json c7i.json
+"""
+
+from __future__ import annotations
+
+import argparse
+import hashlib
+import importlib
+import json
+import platform
+import re
+import resource
+import shlex
+import subprocess
+import sys
+import tempfile
+import time
+import unicodedata
+import wave
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Any, Protocol
+
+from meetmind.core.metrics import LatencyHistogram
+from meetmind.utils.cpu_features import host_features
+
+SAMPLE_RATE = 16_000
+BYTES_PER_SECOND = SAMPLE_RATE * 2
+COMMAND_TIMEOUT_S = 600
+
+
+# ─── Corpus ─────────────────────────────────────────────────────
+
+
+@dataclass(frozen=True)
+class Utterance:
+    """One corpus entry."""
+
+    name: str
+    language: str
+    wav: Path
+    reference: str
+    duration_s: float
+    sha256: str
+
+
+def read_pcm16(path: Path) -> bytes:
+    """Raw samples of a 16 kHz mono PCM16 WAV.
+
+    Raises:
+        ValueError: For any other format (convert with
+            ``ffmpeg -i in -ar 16000 -ac 1 -c:a pcm_s16le out.wav``).
+    """
+    with wave.open(str(path), "rb") as wav:
+        fmt = (wav.getframerate(), wav.getnchannels(), wav.getsampwidth())
+        if fmt != (SAMPLE_RATE, 1, 2):
+            raise ValueError(
+                f"{path}: need 16 kHz mono PCM16, got {fmt[0]} Hz x{fmt[1]} {fmt[2] * 8}-bit"
+            )
+        return wav.readframes(wav.getnframes())
+
+
+def load_corpus(root: Path) -> list[Utterance]:
+    """All ``<lang>/<name>.wav`` files that have a ``.txt`` reference."""
+    utterances: list[Utterance] = []
+    for wav_path in sorted(root.glob("*/*.wav")):
+        ref_path = wav_path.with_suffix(".txt")
+        if not ref_path.exists():
+            continue
+        pcm = read_pcm16(wav_path)
+        utterances.append(
+            Utterance(
+                name=wav_path.stem,
+                language=wav_path.parent.name,
+                wav=wav_path,
+                reference=ref_path.read_text().strip(),
+                duration_s=len(pcm) / BYTES_PER_SECOND,
+                sha256=hashlib.sha256(wav_path.read_bytes()).hexdigest(),
+            )
+        )
+    return utterances
+
+
+# ─── Accuracy ───────────────────────────────────────────────────
+
+_PUNCTUATION = re.compile(r"[^\w\s']")
+_SPACES = re.compile(r"\s+")
+
+
+def normalize(text: str) -> str:
+    """Comparable form: NFKC, lowercase, no punctuation, single spaces."""
+    text = unicodedata.normalize("NFKC", text).lower()
+    return _SPACES.sub(" ", _PUNCTUATION.sub(" ", text)).strip()
+
+
+def edit_distance(ref: list[str] | str, hyp: list[str] | str) -> int:
+    """Levenshtein distance (substitutions + deletions + insertions)."""
+    previous = list(range(len(hyp) + 1))
+    for i, r in enumerate(ref, 1):
+        current = [i]
+        for j, h in enumerate(hyp, 1):
+            current.append(min(previous[j] + 1, current[j - 1] + 1, previous[j - 1] + (r != h)))
+        previous = current
+    return previous[-1]
+
+
+def error_counts(reference: str, hypothesis: str) -> dict[str, int]:
+    """Word and character edit counts with their reference lengths."""
+    ref, hyp = normalize(reference), normalize(hypothesis)
+    return {
+        "word_errors": edit_distance(ref.split(), hyp.split()),
+        "ref_words": len(ref.split()),
+        "char_errors": edit_distance(ref, hyp),
+        "ref_chars": len(ref),
+    }
+
+
+# ─── Engines ────────────────────────────────────────────────────
+
+
+class SttEngine(Protocol):
+    """What the harness drives. One instance handles utterances in sequence."""
+
+    def start(self, language: str, wav: Path) -> None:
+        """Begin an utterance (batch engines may just remember the path)."""
+
+    def feed(self, pcm16: bytes) -> str | None:
+        """Push 16 kHz mono PCM16; return the partial hypothesis if it changed."""
+
+    def finish(self) -> str:
+        """End of audio — return the final transcript."""
+
+
+class CommandEngine:
+    """A native binary run once per utterance; stdout is the transcript."""
+
+    def __init__(self, template: str) -> None:
+        """Initialize with a command template containing ``{wav}`` (and optionally ``{lang}``)."""
+        self._template = template
+        self._args: list[str] = []
+
+    def start(self, language: str, wav: Path) -> None:
+        """Prepare the command line."""
+        self._args = [
+            part.replace("{wav}", str(wav)).replace("{lang}", language)
+            for part in shlex.split(self._template)
+        ]
+
+    def feed(self, pcm16: bytes) -> str | None:
+        """Batch engine — audio is read from the file."""
+        del pcm16
+        return None
+
+    def finish(self) -> str:
+        """Run the binary."""
+        done = subprocess.run(  # noqa: S603 — operator-supplied benchmark command
+            self._args, capture_output=True, text=True, check=True, timeout=COMMAND_TIMEOUT_S
+        )
+        return done.stdout.strip()
+
+
+class FasterWhisperEngine:
+    """faster_whisper (CTranslate2) in-process, final transcripts only."""
+
+    def __init__(self, model: str = "small") -> None:
+        """Load the model (counted as load time, not per-utterance latency)."""
+        from faster_whisper import WhisperModel
+
+        self._model = WhisperModel(model, device="cpu", compute_type="int8")
+        self._language = ""
+        self._wav = Path()
+
+    def start(self, language: str, wav: Path) -> None:
+        """Remember the utterance."""
+        self._language, self._wav = language, wav
+
+    def feed(self, pcm16: bytes) -> str | None:
+        """Batch engine — audio is read from the file."""
+        del pcm16
+        return None
+
+    def finish(self) -> str:
+        """Transcribe the whole file."""
+        segments, _ = self._model.transcribe(str(self._wav), language=self._language or None)
+        return " ".join(segment.text.strip() for segment in segments)
+
+
+def load_engine(spec: str) -> SttEngine:
+    """Build an engine from its ``--engine`` spec."""
+    if spec.startswith("cmd:"):
+        return CommandEngine(spec[4:])
+    name, _, arg = spec.partition(":")
+    if name == "faster-whisper":
+        return FasterWhisperEngine(arg or "small")
+    if not arg:
+        raise ValueError(f"Unknown engine {spec!r} (want faster-whisper, cmd:..., module:factory)")
+    factory = getattr(importlib.import_module(name), arg)
+    engine: SttEngine = factory()
+    return engine
+
+
+# ─── Worker ─────────────────────────────────────────────────────
+
+
+def _peak_rss_mb() -> dict[str, float]:
+    scale = 1024 * 1024 if sys.platform == "darwin" else 1024  # ru_maxrss: bytes vs KiB
+    return {
+        "self": round(resource.getrusage(resource.RUSAGE_SELF).ru_maxrss / scale, 1),
+        "children": round(resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss / scale, 1),
+    }
+
+
+def bench_utterance(
+    engine: SttEngine,
+    utterance: Utterance,
+    chunk_ms: int,
+    realtime: bool,
+    partial_latency: LatencyHistogram,
+) -> dict[str, Any]:
+    """Feed one utterance in ``chunk_ms`` chunks and score the result."""
+    pcm = read_pcm16(utterance.wav)
+    step = BYTES_PER_SECOND * chunk_ms // 1000
+    compute_ns = partials = 0
+
+    engine.start(utterance.language, utterance.wav)
+    began = time.perf_counter()
+    for offset in range(0, len(pcm), step):
+        if realtime:
+            time.sleep(max(0.0, began + offset / BYTES_PER_SECOND - time.perf_counter()))
+        start = time.perf_counter_ns()
+        partial = engine.feed(pcm[offset : offset + step])
+        elapsed = time.perf_counter_ns() - start
+        compute_ns += elapsed
+        if partial:
+            partials += 1
+            partial_latency.record_us(elapsed // 1000)
+
+    start = time.perf_counter_ns()
+    hypothesis = engine.finish()
+    final_ns = time.perf_counter_ns() - start
+    compute_ns += final_ns
+
+    return {
+        "name": utterance.name,
+        "language": utterance.language,
+        "duration_s": round(utterance.duration_s, 3),
+        "rtf": round(compute_ns / 1e9 / utterance.duration_s, 4) if utterance.duration_s else 0.0,
+        "final_ms": round(final_ns / 1e6, 1),
+        "partials": partials,
+        "hypothesis": hypothesis,
+        **error_counts(utterance.reference, hypothesis),
+    }
+
+
+def summarize(
+    rows: list[dict[str, Any]], partial_latency: LatencyHistogram | None
+) -> dict[str, Any]:
+    """Corpus-level figures for a set of utterance rows."""
+    audio_s = sum(r["duration_s"] for r in rows)
+    finals = LatencyHistogram()
+    for row in rows:
+        finals.record_us(int(row["final_ms"] * 1000))
+    final = finals.snapshot()
+    summary: dict[str, Any] = {
+        "utterances": len(rows),
+        "audio_s": round(audio_s, 1),
+        "rtf": round(sum(r["rtf"] * r["duration_s"] for r in rows) / audio_s, 4)
+        if audio_s
+        else 0.0,
+        "final_p50_ms": round(final.quantile(0.5) * 1000, 1),
+        "final_p95_ms": round(final.quantile(0.95) * 1000, 1),
+        "wer": _rate(rows, "word_errors", "ref_words"),
+        "cer": _rate(rows, "char_errors", "ref_chars"),
+    }
+    if partial_latency is not None:
+        partial = partial_latency.snapshot()
+        summary["partial_p50_ms"] = (
+            round(partial.quantile(0.5) * 1000, 1) if partial.count else None
+        )
+        summary["partial_p95_ms"] = (
+            round(partial.quantile(0.95) * 1000, 1) if partial.count else None
+        )
+    return summary
+
+
+def _rate(rows: list[dict[str, Any]], errors: str, total: str) -> float:
+    denominator = sum(r[total] for r in rows)
+    return round(sum(r[errors] for r in rows) / denominator, 4) if denominator else 0.0
+
+
+def worker(args: argparse.Namespace) -> int:
+    """Benchmark one engine (runs in its own process)."""
+    corpus = load_corpus(Path(args.corpus))
+    started = time.perf_counter()
+    engine = load_engine(args.engine)
+    load_s = time.perf_counter() - started
+
+    partial_latency = LatencyHistogram()
+    rows = [
+        bench_utterance(engine, u, args.chunk_ms, args.realtime, partial_latency) for u in corpus
+    ]
+    by_language = {
+        lang: summarize([r for r in rows if r["language"] == lang], None)
+        for lang in sorted({r["language"] for r in rows})
+    }
+    result = {
+        "engine": args.engine,
+        "host": {**host_features().to_dict(), "python": platform.python_version()},
+        "corpus_sha256": hashlib.sha256("".join(u.sha256 for u in corpus).encode()).hexdigest(),
+        "chunk_ms": args.chunk_ms,
+        "realtime": args.realtime,
+        "load_s": round(load_s, 2),
+        "peak_rss_mb": _peak_rss_mb(),
+        "overall": summarize(rows, partial_latency),
+        "languages": by_language,
+        "utterances": rows,
+    }
+    Path(args.out).write_text(json.dumps(result, ensure_ascii=False, indent=2))
+    return 0
+
+
+# ─── Report ─────────────────────────────────────────────────────
+
+
+def _ms(value: float | None) -> str:
+    return "-" if value is None else f"{value:.1f}"
+
+
+def print_table(results: list[dict[str, Any]]) -> None:
+    """One line per engine x host x language, plus the overall line."""
+    header = ("engine", "isa", "lang", "audio s", "RTF", "part p50", "p95", "final p50", "p95",
+              "WER", "CER", "RSS MB")  # fmt: skip
+    row_fmt = "{:<28} {:<14} {:<5} {:>8} {:>7} {:>9} {:>6} {:>10} {:>6} {:>7} {:>7} {:>7}"
+    print(row_fmt.format(*header))
+    for result in results:
+        host = f"{result['host']['arch']}/{result['host']['isa']}"
+        rss = max(result["peak_rss_mb"].values())
+        overall = result["overall"]
+        lines = [*result["languages"].items(), ("all", overall)]
+        for lang, s in lines:
+            print(
+                row_fmt.format(
+                    result["engine"][:28],
+                    host,
+                    lang,
+                    f"{s['audio_s']:.0f}",
+                    f"{s['rtf']:.3f}",
+                    _ms(overall.get("partial_p50_ms")) if lang == "all" else "",
+                    _ms(overall.get("partial_p95_ms")) if lang == "all" else "",
+                    _ms(s["final_p50_ms"]),
+                    _ms(s["final_p95_ms"]),
+                    f"{s['wer']:.1%}",
+                    f"{s['cer']:.1%}",
+                    f"{rss:.0f}" if lang == "all" else "",
+                )
+            )
+
+
+def run(args: argparse.Namespace) -> int:
+    """Benchmark each engine in a fresh worker process."""
+    corpus = load_corpus(Path(args.corpus))
+    if not corpus:
+        print(f"No <lang>/<name>.wav + .txt pairs under {args.corpus}")
+        return 1
+    hours = sum(u.duration_s for u in corpus) / 3600
+    print(f"Corpus: {len(corpus)} utterances, {hours:.2f}h, {sorted({u.language for u in corpus})}")
+
+    results: list[dict[str, Any]] = []
+    status = 0
+    with tempfile.TemporaryDirectory() as tmp:
+        for i, spec in enumerate(args.engine):
+            out = Path(tmp) / f"{i}.json"
+            command = [sys.executable, __file__, "_worker", args.corpus, "--engine", spec,
+                       "--chunk-ms", str(args.chunk_ms), "--out", str(out)]  # fmt: skip
+            if args.realtime:
+                command.append("--realtime")
+            done = subprocess.run(command, check=False)  # noqa: S603 — our own interpreter
+            if done.returncode or not out.exists():
+                print(f"{spec}: worker failed (exit {done.returncode})")
+                status = 1
+                continue
+            results.append(json.loads(out.read_text()))
+
+    print_table(results)
+    if args.json:
+        Path(args.json).write_text(json.dumps(results, ensure_ascii=False, indent=2))
+        print(f"\nWrote {args.json}")
+    return status
+
+
+def compare(args: argparse.Namespace) -> int:
+    """Print several result files together (e.g. one per instance type)."""
+    results = [r for path in args.results for r in json.loads(Path(path).read_text())]
+    corpora = {r["corpus_sha256"] for r in results}
+    if len(corpora) > 1:
+        print(f"warning: results come from {len(corpora)} different corpora")
+    results.sort(key=lambda r: (r["engine"], r["host"]["arch"], r["host"]["isa"]))
+    print_table(results)
+    return 0
+
+
+def main() -> None:
+    """CLI entry point."""
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p_run = sub.add_parser("run", help="Benchmark engines over a corpus")
+    p_run.add_argument("corpus", help="Directory of <lang>/<name>.wav + .txt")
+    p_run.add_argument("--engine", action="append", required=True, help="Repeatable")
+    p_run.add_argument("--chunk-ms", type=int, default=100, help="Streaming feed size")
+    p_run.add_argument("--realtime", action="store_true", help="Pace audio at 1x")
+    p_run.add_argument("--json", help="Write results as JSON")
+
+    p_compare = sub.add_parser("compare", help="Tabulate saved results side by side")
+    p_compare.add_argument("results", nargs="+")
+
+    p_worker = sub.add_parser("_worker")
+    p_worker.add_argument("corpus")
+    p_worker.add_argument("--engine", required=True)
+    p_worker.add_argument("--chunk-ms", type=int, default=100)
+    p_worker.add_argument("--realtime", action="store_true")
+    p_worker.add_argument("--out", required=True)
+
+    args = parser.parse_args()
+    handler = {"run": run, "compare": compare, "_worker": worker}[args.command]
+    sys.exit(handler(args))
+
+
+if __name__ == "__main__":
+    main()
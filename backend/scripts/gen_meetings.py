@@ -0,0 +1,538 @@
+"""Synthetic meeting corpus — reproducible, shareable audio with references.
+
+Assembles meetings turn by turn and writes, per meeting::
+
+    <out>/<lang>/<name>.wav    16 kHz mono PCM16 mix (the bench_stt corpus layout)
+    <out>/<lang>/<name>.txt    reference transcript, one turn per line in start order
+    <out>/<lang>/<name>.rttm   diarization labels (NIST RTTM, one SPEAKER line per turn)
+    <out>/<lang>/<name>.json   load_replay recording: timed segments, copilot questions
+    <out>/manifest.json        parameters, seed, clip sources/licences, measured
+                               ratios and the SHA-256 of every file
+
+so the same directory feeds ``bench_stt.py run <out>`` and
+``load_replay.py run <out>/<lang>``. ``<lang>`` is the first of
+``--languages``; switched turns keep their own language in the RTTM/JSON.
+
+Turn audio comes from a licensed clip library when ``--clips`` is given::
+
+    clips/SOURCES.json               {"source": "...", "license": "CC0-1.0"}
+    clips/<lang>/<speaker>/<id>.wav  16 kHz mono PCM16
+    clips/<lang>/<speaker>/<id>.txt  what is said in the clip
+
+Each meeting speaker is bound to one library voice per language, and the
+turn text is the clip's transcript. Without a library, turns are template
+sentences voiced by a built-in synthesizer (per-speaker pitch, syllable
+rhythm, vowel formants, consonant bursts). That is speech-*like* — fine for
+RTF, VAD, load and diarization timing, meaningless for WER.
+
+Controls:
+  --speakers N        distinct voices taking turns
+  --minutes M         meeting length
+  --overlap R         share of turns that start before the previous one ends
+  --silence R         target share of the timeline with nobody talking
+  --languages a,b     languages in play (first is the meeting's primary)
+  --switch-rate R     chance that a turn switches language
+  --snr-db DB         background noise level relative to speech (omit: clean)
+
+The same seed and parameters always produce byte-identical output.
+
+Run:
+    cd backend && uv run python scripts/gen_meetings.py corpus/ --count 5 --minutes 10
+    cd backend && uv run python scripts/gen_meetings.py corpus/ --clips ~/clips \\
+        --speakers 5 --overlap 0.2 --languages es,en --switch-rate 0.15 --snr-db 15
+"""
+
+from __future__ import annotations
+
+import argparse
+import hashlib
+import itertools
+import json
+import math
+import random
+import sys
+import wave
+from array import array
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Any
+
+GENERATOR_VERSION = 1
+SAMPLE_RATE = 16_000
+CHARS_PER_SECOND = 14.0  # synthetic speaking rate
+PEAK = 0.9  # mix is normalized to this fraction of full scale
+
+# ─── Templates ──────────────────────────────────────────────────
+
+NAMES = {
+    "es": ["Ana", "Luis", "Marta", "Carlos", "Lucía", "Diego", "Sofía", "Javier"],
+    "en": ["Alice", "Bob", "Carol", "Dave", "Erin", "Frank", "Grace", "Henry"],
+    "pt": ["João", "Maria", "Pedro", "Beatriz", "Rafael", "Camila", "Tiago", "Larissa"],
+}
+
+VOCAB: dict[str, dict[str, list[str]]] = {
+    "es": {
+        "topic": ["la migración de la base de datos", "el lanzamiento de la app", "el presupuesto"],
+        "day": ["el lunes", "el viernes", "la próxima semana", "fin de mes"],
+        "risk": ["la latencia del servidor", "la renovación del contrato", "la falta de tests"],
+    },
+    "en": {
+        "topic": ["the database migration", "the app launch", "the quarterly budget"],
+        "day": ["Monday", "Friday", "next week", "the end of the month"],
+        "risk": ["server latency", "the vendor contract", "missing test coverage"],
+    },
+    "pt": {
+        "topic": ["a migração do banco de dados", "o lançamento do app", "o orçamento"],
+        "day": ["segunda-feira", "sexta-feira", "a próxima semana", "o fim do mês"],
+        "risk": ["a latência do servidor", "o contrato com o fornecedor", "a falta de testes"],
+    },
+}
+
+TEMPLATES: dict[str, list[str]] = {
+    "es": [
+        "Bueno, empecemos con {topic}.",
+        "{name}, ¿cómo vamos con {topic}?",
+        "Creo que el mayor riesgo es {risk}.",
+        "Decisión: dejamos {topic} para {day}.",
+        "Acción para {name}: revisar {risk} antes de {day}.",
+        "O sea, no estoy seguro de que lleguemos para {day}.",
+        "Estoy de acuerdo con {name}, pero falta hablar de {risk}.",
+        "¿Alguien tiene dudas sobre {topic}?",
+    ],
+    "en": [
+        "Okay, let's start with {topic}.",
+        "{name}, where are we with {topic}?",
+        "I think the biggest risk is {risk}.",
+        "Decision: we move {topic} to {day}.",
+        "Action item for {name}: look into {risk} before {day}.",
+        "Honestly I'm not sure we make it by {day}.",
+        "I agree with {name}, but we still need to talk about {risk}.",
+        "Any questions about {topic}?",
+    ],
+    "pt": [
+        "Bom, vamos começar com {topic}.",
+        "{name}, como estamos com {topic}?",
+        "Acho que o maior risco é {risk}.",
+        "Decisão: deixamos {topic} para {day}.",
+        "Ação para {name}: revisar {risk} antes de {day}.",
+        "Sinceramente não sei se chegamos até {day}.",
+        "Concordo com {name}, mas falta falar sobre {risk}.",
+        "Alguém tem dúvidas sobre {topic}?",
+    ],
+}
+
+QUESTIONS = {
+    "es": ["¿Qué decisiones se tomaron hasta ahora?", "¿Cuáles son los riesgos abiertos?"],
+    "en": ["What has been decided so far?", "What are the open risks?"],
+    "pt": ["O que foi decidido até agora?", "Quais são os riscos em aberto?"],
+}
+
+
+def render_line(rng: random.Random, language: str, others: list[str]) -> str:
+    """One template sentence with its slots filled."""
+    vocab = VOCAB[language]
+    return rng.choice(TEMPLATES[language]).format(
+        name=rng.choice(others) if others else rng.choice(NAMES[language]),
+        **{slot: rng.choice(words) for slot, words in vocab.items()},
+    )
+
+
+# ─── Voices ─────────────────────────────────────────────────────
+
+# (F1, F2) in Hz for a, e, i, o, u
+_VOWELS = [(800, 1200), (500, 1900), (300, 2300), (500, 900), (320, 800)]
+_HARMONICS = 12
+
+
+@dataclass(frozen=True)
+class Voice:
+    """A synthetic speaker: pitch, speaking rate and loudness."""
+
+    f0: float
+    rate: float  # syllables per second
+    gain: float
+
+    @classmethod
+    def random(cls, rng: random.Random) -> Voice:
+        """A voice in the adult male or female pitch range."""
+        low = rng.random() < 0.5
+        return cls(
+            f0=rng.uniform(95, 140) if low else rng.uniform(175, 235),
+            rate=rng.uniform(3.8, 5.2),
+            gain=rng.uniform(0.55, 1.0),
+        )
+
+
+def synthesize(text: str, voice: Voice, rng: random.Random) -> array[float]:
+    """Speech-like audio for ``text``: one voiced syllable per ~3 characters."""
+    out: array[float] = array("f")
+    duration = max(len(text) / CHARS_PER_SECOND, 0.4)
+    syllables = max(1, round(duration * voice.rate))
+    for i in range(syllables):
+        length = int(SAMPLE_RATE * rng.uniform(0.6, 1.4) / voice.rate)
+        # Declining pitch over the turn, with per-syllable jitter
+        f0 = voice.f0 * (1.1 - 0.2 * i / syllables) * rng.uniform(0.95, 1.05)
+        f1, f2 = rng.choice(_VOWELS)
+        period = max(2, round(SAMPLE_RATE / f0))
+        weights = [
+            (1 / k)
+            * (1 / (1 + ((k * f0 - f1) / 120) ** 2) + 0.6 / (1 + ((k * f0 - f2) / 180) ** 2))
+            for k in range(1, _HARMONICS + 1)
+        ]
+        table = [
+            sum(w * math.sin(2 * math.pi * k * n / period) for k, w in enumerate(weights, 1))
+            for n in range(period)
+        ]
+        scale = 1 / (max(abs(v) for v in table) or 1)
+        burst = int(SAMPLE_RATE * 0.02) if rng.random() < 0.6 else 0
+        for n in range(length):
+            envelope = math.sin(math.pi * n / length) ** 0.6
+            sample = table[n % period] * scale * envelope
+            if n < burst:  # consonant onset
+                sample = 0.4 * rng.uniform(-1, 1) + 0.3 * sample
+            out.append(sample * voice.gain)
+        # Short gap between words every few syllables
+        if rng.random() < 0.3:
+            out.extend([0.0] * int(SAMPLE_RATE * rng.uniform(0.05, 0.15)))
+    return out
+
+
+# ─── Clip Library ───────────────────────────────────────────────
+
+
+@dataclass(frozen=True)
+class Clip:
+    """A licensed recording and what is said in it."""
+
+    id: str  # <lang>/<speaker>/<name>, relative to the library
+    path: Path
+    text: str
+
+
+def read_wav(path: Path) -> array[float]:
+    """Samples of a 16 kHz mono PCM16 WAV as floats in [-1, 1].
+
+    Raises:
+        ValueError: For any other format.
+    """
+    with wave.open(str(path), "rb") as wav:
+        fmt = (wav.getframerate(), wav.getnchannels(), wav.getsampwidth())
+        if fmt != (SAMPLE_RATE, 1, 2):
+            raise ValueError(f"{path}: need 16 kHz mono PCM16, got {fmt}")
+        pcm = array("h", wav.readframes(wav.getnframes()))
+    if sys.byteorder == "big":
+        pcm.byteswap()
+    return array("f", (s / 32768 for s in pcm))
+
+
+def load_clips(root: Path) -> tuple[dict[str, dict[str, list[Clip]]], dict[str, Any]]:
+    """Index a clip library by language and library speaker.
+
+    Returns:
+        ``{lang: {speaker: [clips]}}`` and the library's ``SOURCES.json``.
+    """
+    library: dict[str, dict[str, list[Clip]]] = {}
+    for wav_path in sorted(root.glob("*/*/*.wav")):
+        text_path = wav_path.with_suffix(".txt")
+        if not text_path.exists():
+            continue
+        lang, speaker = wav_path.parent.parent.name, wav_path.parent.name
+        clip_id = f"{lang}/{speaker}/{wav_path.stem}"
+        clip = Clip(clip_id, wav_path, text_path.read_text().strip())
+        library.setdefault(lang, {}).setdefault(speaker, []).append(clip)
+    sources_path = root / "SOURCES.json"
+    sources = json.loads(sources_path.read_text()) if sources_path.exists() else {}
+    return library, sources
+
+
+# ─── Meeting ────────────────────────────────────────────────────
+
+
+@dataclass(frozen=True)
+class Params:
+    """Generation parameters for one meeting."""
+
+    speakers: int
+    minutes: float
+    overlap: float
+    silence: float
+    languages: tuple[str, ...]
+    switch_rate: float
+    snr_db: float | None
+
+
+@dataclass
+class Turn:
+    """One speaker turn on the meeting timeline."""
+
+    start_s: float
+    speaker: str
+    language: str
+    text: str
+    audio: array[float]
+
+    @property
+    def end_s(self) -> float:
+        """When the turn stops."""
+        return self.start_s + len(self.audio) / SAMPLE_RATE
+
+
+class Assembler:
+    """Lays turns out on a timeline and mixes them."""
+
+    def __init__(
+        self,
+        params: Params,
+        rng: random.Random,
+        library: dict[str, dict[str, list[Clip]]] | None = None,
+    ) -> None:
+        """Initialize with a cast of speakers for this meeting."""
+        self.params = params
+        self.rng = rng
+        self.library = library or {}
+        primary = params.languages[0]
+        self.speakers = rng.sample(NAMES[primary], k=min(params.speakers, len(NAMES[primary])))
+        self.voices = {name: Voice.random(rng) for name in self.speakers}
+        # Each meeting speaker speaks with one library voice per language
+        self.bindings: dict[tuple[str, str], str] = {}
+        self.used: set[str] = set()
+
+    def utterance(self, speaker: str, language: str) -> tuple[str, array[float]]:
+        """Text and audio for one turn (a library clip when available)."""
+        voices = self.library.get(language)
+        if voices:
+            key = (speaker, language)
+            if key not in self.bindings:
+                taken = {v for (_, lang), v in self.bindings.items() if lang == language}
+                self.bindings[key] = self.rng.choice(sorted(set(voices) - taken) or sorted(voices))
+            clips = voices[self.bindings[key]]
+            fresh = [c for c in clips if c.id not in self.used] or clips
+            clip = self.rng.choice(fresh)
+            self.used.add(clip.id)
+            gain = self.voices[speaker].gain
+            return clip.text, array("f", (s * gain for s in read_wav(clip.path)))
+        others = [s for s in self.speakers if s != speaker]
+        text = render_line(self.rng, language, others)
+        return text, synthesize(text, self.voices[speaker], self.rng)
+
+    def turns(self) -> list[Turn]:
+        """Build the timeline up to the requested length."""
+        p, rng = self.params, self.rng
+        total_s = p.minutes * 60
+        language = p.languages[0]
+        turns: list[Turn] = []
+        speech_s = 0.0
+        while True:
+            previous = turns[-1] if turns else None
+            choices = [s for s in self.speakers if previous is None or s != previous.speaker]
+            speaker = rng.choice(choices or self.speakers)
+            if len(p.languages) > 1 and rng.random() < p.switch_rate:
+                language = rng.choice([lang for lang in p.languages if lang != language])
+            text, audio = self.utterance(speaker, language)
+            duration = len(audio) / SAMPLE_RATE
+            if previous is None:
+                start = rng.uniform(0.2, 1.0)
+            elif rng.random() < p.overlap and len(self.speakers) > 1:
+                prev_duration = previous.end_s - previous.start_s
+                barge_in = rng.uniform(0.2, max(0.3, 0.5 * prev_duration))
+                start = max(previous.end_s - barge_in, previous.start_s + 0.1)
+            else:
+                # Exponential gaps sized so silence ≈ target share of the timeline
+                mean_turn = speech_s / len(turns)
+                mean_gap = mean_turn * p.silence / max(1 - p.silence, 0.05)
+                start = previous.end_s + (rng.expovariate(1 / mean_gap) if mean_gap > 0 else 0.0)
+            if start >= total_s:
+                break
+            turns.append(Turn(start, speaker, language, text, audio))
+            speech_s += duration
+        return turns
+
+    def mix(self, turns: list[Turn]) -> bytes:
+        """Sum every turn onto one track, add noise, normalize to PCM16."""
+        length = int(max((t.end_s for t in turns), default=0) * SAMPLE_RATE) + SAMPLE_RATE // 2
+        track = array("f", bytes(4 * length))
+        for turn in turns:
+            offset = int(turn.start_s * SAMPLE_RATE)
+            for i, sample in enumerate(turn.audio):
+                track[offset + i] += sample
+        if self.params.snr_db is not None:
+            self._add_noise(track, turns, self.params.snr_db)
+        peak = max((abs(s) for s in track), default=0.0) or 1.0
+        scale = PEAK * 32767 / peak
+        pcm = array("h", (round(s * scale) for s in track))
+        if sys.byteorder == "big":
+            pcm.byteswap()
+        return pcm.tobytes()
+
+    def _add_noise(self, track: array[float], turns: list[Turn], snr_db: float) -> None:
+        """Room-like noise (white + low-passed) at ``snr_db`` below speech RMS."""
+        count = sum(len(t.audio) for t in turns)
+        speech_power = sum(s * s for t in turns for s in t.audio) / max(count, 1)
+        noise = array("f", bytes(4 * len(track)))
+        low = 0.0
+        for i in range(len(noise)):
+            white = self.rng.gauss(0, 1)
+            low = 0.98 * low + 0.02 * white
+            noise[i] = 0.3 * white + 5 * low
+        noise_power = sum(s * s for s in noise) / max(len(noise), 1)
+        gain = math.sqrt(speech_power / (noise_power * 10 ** (snr_db / 10) or 1))
+        for i, sample in enumerate(noise):
+            track[i] += sample * gain
+
+
+def measure(turns: list[Turn], duration_s: float) -> dict[str, float]:
+    """Realized silence and overlap shares (10 ms resolution)."""
+    steps = max(1, int(duration_s * 100))
+    active = [0] * steps
+    for turn in turns:
+        for i in range(int(turn.start_s * 100), min(steps, int(turn.end_s * 100))):
+            active[i] += 1
+    speech = sum(1 for a in active if a)
+    overlapped_turns = sum(1 for a, b in itertools.pairwise(turns) if b.start_s < a.end_s)
+    return {
+        "silence_ratio": round(1 - speech / steps, 3),
+        "overlapped_speech_ratio": round(sum(1 for a in active if a > 1) / max(speech, 1), 3),
+        "overlapping_turn_ratio": round(overlapped_turns / max(len(turns) - 1, 1), 3),
+    }
+
+
+# ─── Output ─────────────────────────────────────────────────────
+
+
+def write_meeting(name: str, out: Path, assembler: Assembler) -> dict[str, Any]:
+    """Generate one meeting and write its audio, references and labels.
+
+    Returns:
+        The meeting's manifest entry.
+    """
+    turns = assembler.turns()
+    pcm = assembler.mix(turns)
+    duration_s = len(pcm) / 2 / SAMPLE_RATE
+    primary = assembler.params.languages[0]
+    folder = out / primary
+    folder.mkdir(parents=True, exist_ok=True)
+
+    wav_path = folder / f"{name}.wav"
+    with wave.open(str(wav_path), "wb") as wav:
+        wav.setnchannels(1)
+        wav.setsampwidth(2)
+        wav.setframerate(SAMPLE_RATE)
+        wav.writeframes(pcm)
+    (folder / f"{name}.txt").write_text("\n".join(t.text for t in turns) + "\n")
+    (folder / f"{name}.rttm").write_text(
+        "".join(
+            f"SPEAKER {name} 1 {t.start_s:.3f} {t.end_s - t.start_s:.3f} "
+            f"<NA> <NA> {t.speaker} <NA> <NA>\n"
+            for t in turns
+        )
+    )
+    questions = QUESTIONS[primary]
+    recording = {
+        "language": primary,
+        "audio": wav_path.name,
+        "segments": [
+            {
+                "text": t.text,
+                "speaker": t.speaker,
+                "offset_s": round(t.end_s, 3),  # the client sends a segment once it's spoken
+                "language": t.language,
+            }
+            for t in turns
+        ],
+        "questions": [
+            {"offset_s": round(duration_s * (i + 1) / (len(questions) + 1), 1), "question": q}
+            for i, q in enumerate(questions)
+        ],
+    }
+    (folder / f"{name}.json").write_text(json.dumps(recording, ensure_ascii=False, indent=1))
+
+    files = {
+        path.relative_to(out).as_posix(): hashlib.sha256(path.read_bytes()).hexdigest()
+        for path in sorted(folder.glob(f"{name}.*"))
+    }
+    return {
+        "name": name,
+        "language": primary,
+        "duration_s": round(duration_s, 2),
+        "turns": len(turns),
+        "speakers": assembler.speakers,
+        "languages": sorted({t.language for t in turns}),
+        "clips": sorted(assembler.used),
+        **measure(turns, duration_s),
+        "files": files,
+    }
+
+
+def main() -> None:
+    """CLI entry point."""
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("out", help="Output directory")
+    parser.add_argument("--count", type=int, default=3, help="Meetings to generate")
+    parser.add_argument("--minutes", type=float, default=5.0)
+    parser.add_argument("--speakers", type=int, default=4)
+    parser.add_argument("--overlap", type=float, default=0.1)
+    parser.add_argument("--silence", type=float, default=0.15)
+    parser.add_argument("--languages", default="es", help="Comma-separated, primary first")
+    parser.add_argument("--switch-rate", type=float, default=0.0)
+    parser.add_argument("--snr-db", type=float, help="Background noise (default: none)")
+    parser.add_argument("--clips", help="Licensed clip library (default: synthesized voices)")
+    parser.add_argument("--seed", type=int, default=120)
+    args = parser.parse_args()
+
+    languages = tuple(lang.strip() for lang in args.languages.split(",") if lang.strip())
+    unknown = [lang for lang in languages if lang not in TEMPLATES]
+    if unknown or not languages:
+        parser.error(f"languages must be among {sorted(TEMPLATES)}")
+    if not (0 <= args.overlap < 1 and 0 <= args.silence < 1 and args.speakers >= 1):
+        parser.error("--overlap and --silence must be in [0, 1); --speakers >= 1")
+    params = Params(
+        speakers=args.speakers,
+        minutes=args.minutes,
+        overlap=args.overlap,
+        silence=args.silence,
+        languages=languages,
+        switch_rate=args.switch_rate,
+        snr_db=args.snr_db,
+    )
+
+    library: dict[str, dict[str, list[Clip]]] = {}
+    sources: dict[str, Any] = {}
+    if args.clips:
+        library, sources = load_clips(Path(args.clips))
+        missing = [lang for lang in languages if lang not in library]
+        if missing:
+            print(f"warning: no clips for {missing}; those turns are synthesized", file=sys.stderr)
+        if not sources.get("license"):
+            print(
+                "warning: clips/SOURCES.json has no license — corpus may not be shareable",
+                file=sys.stderr,
+            )
+
+    out = Path(args.out)
+    out.mkdir(parents=True, exist_ok=True)
+    meetings = []
+    for i in range(args.count):
+        # One RNG per meeting: meeting N is the same whatever --count is
+        rng = random.Random(f"{args.seed}:{i}")  # noqa: S311 — reproducible corpus, not crypto
+        entry = write_meeting(f"meeting_{i:03d}", out, Assembler(params, rng, library))
+        meetings.append(entry)
+        print(
+            f"{entry['name']}: {entry['duration_s']:.0f}s, {entry['turns']} turns, "
+            f"silence {entry['silence_ratio']:.0%}, "
+            f"overlapping turns {entry['overlapping_turn_ratio']:.0%}"
+        )
+
+    manifest = {
+        "generator_version": GENERATOR_VERSION,
+        "seed": args.seed,
+        "params": {**vars(params), "languages": list(languages)},
+        "audio": "clips" if library else "synthetic",
+        "clip_sources": sources,
+        "meetings": meetings,
+    }
+    (out / "manifest.json").write_text(json.dumps(manifest, ensure_ascii=False, indent=2))
+    print(f"Wrote {len(meetings)} meetings to {out}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,660 @@
+"""Meeting replay load test — N concurrent recorded meetings against the API.
+
+Each virtual client replays a recorded meeting the way the app does
+(``MeetingNotifier``): segments arrive at their recorded offsets, pending
+segments are flushed to ``/transcript`` every 5s, failed flushes are
+re-queued (three strikes, then the batch is dropped), questions go to
+``/copilot`` with the transcript so far, and the meeting ends with
+``/summary``.
+
+Concurrency is ramped through the given levels. Each level reports
+throughput, p50/p95/p99 per endpoint and error rates, and the first level
+that breaks an SLO is called out. Time is compressed by ``--speed``: at
+60x a 30-minute meeting replays in 30s and flushes 60x as often, so ingest
+load is roughly ``concurrency x speed`` live sessions (LLM calls stay
+bounded by the server's wall-clock screening interval).
+
+Targets:
+  (default)   The FastAPI app in this process with local stand-ins:
+              in-memory storage and a stub LLM with lognormal latency.
+              Fully offline — no Postgres, no API keys, no rate limits.
+  --url URL   A running backend. Tokens are minted with the local
+              MEETMIND_JWT_SECRET_KEY, so it must share that secret;
+              its rate limits apply and 429s are reported as errors.
+
+Recordings are JSON files (or directory trees of them, such as the
+per-language folders ``gen_meetings.py`` writes)::
+
+    {"language": "es",
+     "segments": [{"text": "...", "speaker": "Ana", "offset_s": 3.2}, ...],
+     "questions": [{"offset_s": 120, "question": "..."}],
+     "audio": "meeting.wav"}
+
+``offset_s`` is optional: without it segments are spread evenly over the
+audio's duration (or 4s apart). Other JSON found in a directory (a
+corpus ``manifest.json``, ``SOURCES.json``) and recordings without any
+text are skipped. ``export`` writes real meetings from the
+database in this format, ``gen_meetings.py`` writes shareable synthetic
+ones; with no recordings a built-in meeting is used.
+
+Run:
+    cd backend && uv run python scripts/load_replay.py run --concurrency 1,5,10,25
+    cd backend && uv run python scripts/load_replay.py run --url http://localhost:8000
+    cd backend && uv run python scripts/load_replay.py export recordings/ --limit 20
+"""
+
+from __future__ import annotations
+
+import argparse
+import asyncio
+import json
+import logging
+import math
+import random
+import sys
+import time
+import uuid
+import wave
+from collections import Counter
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Any
+
+import httpx
+import structlog
+
+from meetmind.core.auth import create_access_token
+from meetmind.core.metrics import LatencyHistogram
+
+ENDPOINTS = ("transcript", "copilot", "summary")
+FLUSH_INTERVAL_S = 5.0  # MeetingNotifier._transcriptBatchTimer
+MAX_FLUSH_FAILURES = 3  # MeetingNotifier._maxFlushRetries
+DEFAULT_SEGMENT_GAP_S = 4.0
+DEFAULT_SLOS = "transcript:p95=500,copilot:p95=5000,summary:p95=20000"
+
+
+# ─── Recordings ─────────────────────────────────────────────────
+
+
+@dataclass
+class Recording:
+    """A meeting to replay: timed segments and copilot questions."""
+
+    name: str
+    language: str
+    segments: list[tuple[float, str, str]]  # (offset_s, speaker, text)
+    questions: list[tuple[float, str]] = field(default_factory=list)
+
+    @property
+    def duration_s(self) -> float:
+        """Offset of the last event."""
+        last = [s[0] for s in self.segments[-1:]] + [q[0] for q in self.questions[-1:]]
+        return max(last, default=0.0)
+
+
+def _audio_duration(path: Path) -> float | None:
+    try:
+        with wave.open(str(path)) as wav:
+            return wav.getnframes() / float(wav.getframerate())
+    except (OSError, wave.Error):
+        return None
+
+
+def parse_recording(data: dict[str, Any], name: str, base_dir: Path) -> Recording:
+    """Build a recording from its JSON form, filling in missing offsets."""
+    raw = [s for s in data.get("segments", []) if str(s.get("text", "")).strip()]
+    gap = DEFAULT_SEGMENT_GAP_S
+    if raw and any("offset_s" not in s for s in raw) and data.get("audio"):
+        duration = _audio_duration(base_dir / data["audio"])
+        if duration:
+            gap = duration / len(raw)
+    segments = [
+        (float(s.get("offset_s", i * gap)), str(s.get("speaker", "unknown")), str(s["text"]))
+        for i, s in enumerate(raw)
+    ]
+    segments.sort(key=lambda s: s[0])
+    questions = sorted(
+        (float(q.get("offset_s", 0)), str(q["question"])) for q in data.get("questions", [])
+    )
+    return Recording(name, str(data.get("language", "es")), segments, questions)
+
+
+def _is_recording(item: Any) -> bool:
+    return isinstance(item, dict) and isinstance(item.get("segments"), list)
+
+
+def load_recordings(paths: list[str]) -> list[Recording]:
+    """Load recordings from files and directory trees (``**/*.json``)."""
+    files: list[tuple[Path, str]] = []  # (file, name relative to the argument)
+    for p in map(Path, paths):
+        if p.is_dir():
+            files.extend(
+                (f, str(f.relative_to(p).with_suffix(""))) for f in sorted(p.rglob("*.json"))
+            )
+        else:
+            files.append((p, p.stem))
+    recordings = []
+    for f, name in files:
+        data = json.loads(f.read_text())
+        items = [
+            item for item in (data if isinstance(data, list) else [data]) if _is_recording(item)
+        ]
+        if not items:
+            print(f"Skipping {f}: not a recording", file=sys.stderr)
+            continue
+        for i, item in enumerate(items):
+            recording = parse_recording(item, f"{name}[{i}]", f.parent)
+            if recording.segments:
+                recordings.append(recording)
+    return recordings
+
+
+def builtin_recording(minutes: int = 10, seed: int = 7) -> Recording:
+    """A deterministic bilingual stand-up, for runs without recordings."""
+    rng = random.Random(seed)  # noqa: S311 — reproducible corpus, not crypto
+    speakers = ["Ana", "Luis", "Marta", "Carlos"]
+    lines = [
+        "Tenemos que migrar la base de datos antes del fin del trimestre.",
+        "El riesgo es que el ORM tiene consultas SQL crudas en tres servicios.",
+        "Decision: we will use pgloader for the data migration.",
+        "Action item: Carlos audits every raw query by Friday.",
+        "Bueno, o sea, el cliente pidió adelantar la entrega dos semanas.",
+        "We should add read replicas for the analytics dashboards.",
+        "Propongo revisar el presupuesto de infraestructura la próxima semana.",
+        "Latency on the ingest path went up after the last deploy.",
+    ]
+    segments = []
+    t = 0.0
+    while t < minutes * 60:
+        segments.append((t, rng.choice(speakers), rng.choice(lines)))
+        t += rng.uniform(2.0, 6.0)
+    questions = [
+        (minutes * 20.0, "¿Qué decisiones se tomaron hasta ahora?"),
+        (minutes * 45.0, "What are the open risks?"),
+    ]
+    return Recording("builtin", "es", segments, questions)
+
+
+# ─── Stats ──────────────────────────────────────────────────────
+
+
+@dataclass
+class EndpointStats:
+    """Latency and outcome counts for one endpoint at one level."""
+
+    histogram: LatencyHistogram = field(default_factory=LatencyHistogram)
+    statuses: Counter[str] = field(default_factory=Counter)
+    errors: int = 0
+
+    def record(self, elapsed_ns: int, status: str, ok: bool) -> None:
+        """Record one request."""
+        self.histogram.record_us(elapsed_ns // 1000)
+        self.statuses[status] += 1
+        if not ok:
+            self.errors += 1
+
+    def summary(self, wall_s: float) -> dict[str, Any]:
+        """Throughput, quantiles (ms) and error rate."""
+        snap = self.histogram.snapshot()
+        return {
+            "requests": snap.count,
+            "rps": round(snap.count / wall_s, 2) if wall_s else 0.0,
+            "p50_ms": round(snap.quantile(0.5) * 1000, 1),
+            "p95_ms": round(snap.quantile(0.95) * 1000, 1),
+            "p99_ms": round(snap.quantile(0.99) * 1000, 1),
+            "max_ms": round(snap.max_us / 1000, 1),
+            "error_rate": round(self.errors / snap.count, 4) if snap.count else 0.0,
+            "statuses": dict(self.statuses),
+        }
+
+
+def parse_slos(spec: str) -> dict[str, tuple[float, float]]:
+    """Parse ``"transcript:p95=500,copilot:p99=4000"`` → endpoint → (quantile, ms)."""
+    slos: dict[str, tuple[float, float]] = {}
+    for part in filter(None, (p.strip() for p in spec.split(","))):
+        target, _, limit = part.partition("=")
+        endpoint, _, pct = target.partition(":")
+        slos[endpoint] = (float(pct.lstrip("p")) / 100, float(limit))
+    return slos
+
+
+def check_slos(
+    level: dict[str, Any], slos: dict[str, tuple[float, float]], max_error_rate: float
+) -> list[str]:
+    """Human-readable SLO violations for one level (empty = all met)."""
+    violations = []
+    for endpoint, stats in level["endpoints"].items():
+        if not stats["requests"]:
+            continue
+        if stats["error_rate"] > max_error_rate:
+            violations.append(f"{endpoint} errors {stats['error_rate']:.1%} > {max_error_rate:.1%}")
+        if endpoint in slos:
+            q, limit_ms = slos[endpoint]
+            key = f"p{round(q * 100):d}_ms"
+            observed = stats.get(key)
+            if observed is None:
+                observed = round(level["_histograms"][endpoint].quantile(q) * 1000, 1)
+            if observed > limit_ms:
+                violations.append(f"{endpoint} p{q * 100:g} {observed}ms > {limit_ms:g}ms")
+    return violations
+
+
+# ─── Virtual Client ─────────────────────────────────────────────
+
+
+async def _post(
+    client: httpx.AsyncClient,
+    stats: EndpointStats,
+    path: str,
+    payload: dict[str, Any],
+    headers: dict[str, str],
+) -> tuple[bool, int]:
+    start = time.perf_counter_ns()
+    try:
+        response = await client.post(path, json=payload, headers=headers)
+        status, ok = response.status_code, response.status_code < 400
+    except httpx.HTTPError as e:
+        status, ok = 0, False
+        stats.statuses[type(e).__name__] += 1
+    stats.record(time.perf_counter_ns() - start, str(status) if status else "error", ok)
+    return ok, status
+
+
+async def replay_session(
+    client: httpx.AsyncClient,
+    recording: Recording,
+    stats: dict[str, EndpointStats],
+    *,
+    user_id: str,
+    speed: float,
+    start_delay: float,
+) -> int:
+    """Replay one meeting like the app would.
+
+    Returns:
+        Segments dropped after repeated flush failures.
+    """
+    meeting_id = f"load-{uuid.uuid4().hex[:12]}"
+    headers = {"Authorization": f"Bearer {create_access_token(user_id, f'{user_id}@load.test')}"}
+    timeline = sorted(
+        [(t, 0, (speaker, text)) for t, speaker, text in recording.segments]
+        + [(t, 1, question) for t, question in recording.questions],
+        key=lambda e: (e[0], e[1]),
+    )
+    pending: list[dict[str, str]] = []
+    spoken: list[str] = []
+    failures = dropped = 0
+
+    async def flush() -> None:
+        nonlocal failures, dropped
+        if not pending:
+            return
+        if failures >= MAX_FLUSH_FAILURES:
+            dropped += len(pending)
+            pending.clear()
+            failures = 0
+            return
+        batch = pending[:]
+        pending.clear()
+        ok, status = await _post(
+            client,
+            stats["transcript"],
+            f"/api/meetings/{meeting_id}/transcript",
+            {"segments": batch, "language": recording.language},
+            headers,
+        )
+        if ok:
+            failures = 0
+            return
+        failures += 1
+        if status not in (401, 403, 404) or failures < MAX_FLUSH_FAILURES:
+            pending[:0] = batch
+
+    await asyncio.sleep(start_delay)
+    began = time.perf_counter()
+    next_flush = FLUSH_INTERVAL_S
+    index = 0
+    while index < len(timeline):
+        offset, kind, payload = timeline[index]
+        due = min(offset, next_flush)
+        await asyncio.sleep(max(0.0, began + due / speed - time.perf_counter()))
+        if next_flush <= offset:
+            await flush()
+            next_flush += FLUSH_INTERVAL_S
+            continue
+        index += 1
+        if kind == 0:
+            speaker, text = payload
+            pending.append({"text": text, "speaker": speaker})
+            spoken.append(f"{speaker}: {text}")
+        else:
+            await _post(
+                client,
+                stats["copilot"],
+                f"/api/meetings/{meeting_id}/copilot",
+                {"question": payload, "transcript_context": "\n".join(spoken)},
+                headers,
+            )
+
+    await flush()
+    await _post(
+        client,
+        stats["summary"],
+        f"/api/meetings/{meeting_id}/summary",
+        {"full_transcript": "\n".join(spoken), "language": recording.language},
+        headers,
+    )
+    return dropped + len(pending)
+
+
+async def run_level(
+    client: httpx.AsyncClient,
+    recordings: list[Recording],
+    concurrency: int,
+    speed: float,
+) -> dict[str, Any]:
+    """Run ``concurrency`` sessions to completion and summarize."""
+    stats = {name: EndpointStats() for name in ENDPOINTS}
+    # Stagger starts over one flush interval so clients don't flush in lockstep
+    stagger = FLUSH_INTERVAL_S / speed
+    started = time.perf_counter()
+    dropped = await asyncio.gather(
+        *(
+            replay_session(
+                client,
+                recordings[i % len(recordings)],
+                stats,
+                user_id=f"load-user-{i}",
+                speed=speed,
+                start_delay=random.uniform(0, stagger),  # noqa: S311
+            )
+            for i in range(concurrency)
+        )
+    )
+    wall_s = time.perf_counter() - started
+    return {
+        "concurrency": concurrency,
+        "wall_s": round(wall_s, 2),
+        "dropped_segments": sum(dropped),
+        "endpoints": {name: s.summary(wall_s) for name, s in stats.items()},
+        "_histograms": {name: s.histogram.snapshot() for name, s in stats.items()},
+    }
+
+
+# ─── Local Stand-ins ────────────────────────────────────────────
+
+
+class StubLLMProvider:
+    """LLMProvider stand-in: canned JSON replies after a lognormal delay."""
+
+    def __init__(self, median_ms: float, sigma: float = 0.5, seed: int = 1) -> None:
+        """Initialize with the median latency of a call."""
+        self._mu = math.log(max(median_ms, 0.001) / 1000)
+        self._sigma = sigma
+        self._rng = random.Random(seed)  # noqa: S311
+        self._requests = 0
+
+    async def _reply(self, content: Any, output_tokens: int) -> dict[str, Any]:
+        delay = self._rng.lognormvariate(self._mu, self._sigma)
+        await asyncio.sleep(delay)
+        self._requests += 1
+        return {
+            "content": content if isinstance(content, str) else json.dumps(content),
+            "input_tokens": 800,
+            "output_tokens": output_tokens,
+            "latency_ms": round(delay * 1000, 1),
+            "model_id": "stub",
+        }
+
+    async def invoke(self, model_id: str, prompt: str, **_: Any) -> dict[str, Any]:
+        """Generic call."""
+        return await self._reply("ok", 10)
+
+    async def invoke_screening(self, prompt: str) -> dict[str, Any]:
+        """~30% of windows are relevant."""
+        relevant = self._rng.random() < 0.3
+        return await self._reply({"relevant": relevant, "reason": "stub"}, 20)
+
+    async def invoke_analysis(self, prompt: str) -> dict[str, Any]:
+        """One decision insight."""
+        insight = {
+            "title": "Stub decision",
+            "analysis": "The team agreed on a plan.",
+            "recommendation": "Track it.",
+            "category": "decision",
+        }
+        return await self._reply(insight, 120)
+
+    async def invoke_copilot(self, prompt: str) -> dict[str, Any]:
+        """A short answer."""
+        return await self._reply("Stub answer based on the transcript.", 60)
+
+    async def invoke_summary(self, prompt: str) -> dict[str, Any]:
+        """A minimal structured summary."""
+        summary = {
+            "title": "Stub meeting",
+            "summary": "Replayed meeting.",
+            "key_topics": ["migration"],
+            "decisions": ["Use pgloader"],
+            "action_items": [{"task": "Audit SQL", "owner": "Carlos"}],
+            "risks": [],
+            "next_steps": [],
+        }
+        return await self._reply(summary, 400)
+
+    async def invoke_deep(self, prompt: str) -> dict[str, Any]:
+        """Same as copilot."""
+        return await self.invoke_copilot(prompt)
+
+    @property
+    def usage_stats(self) -> dict[str, int]:
+        """Request count only."""
+        return {"total_input_tokens": 0, "total_output_tokens": 0, "total_requests": self._requests}
+
+
+class StandInStorage:
+    """In-memory replacement for the ``storage`` functions the replayed endpoints use."""
+
+    def __init__(self, latency_ms: float) -> None:
+        """Initialize with a fixed per-call latency."""
+        self._delay = latency_ms / 1000
+        self.segments: Counter[str] = Counter()
+
+    async def _io(self) -> None:
+        await asyncio.sleep(self._delay)
+
+    async def create_meeting(self, meeting_id: str, **_: Any) -> None:
+        """Create (no-op)."""
+        await self._io()
+
+    async def save_segments(self, meeting_id: str, segments: list[dict[str, Any]]) -> int:
+        """Count segments."""
+        await self._io()
+        self.segments[meeting_id] += len(segments)
+        return len(segments)
+
+    async def save_insight(self, meeting_id: str, insight: dict[str, Any]) -> None:
+        """Persist (no-op)."""
+        await self._io()
+
+    async def save_summary(self, meeting_id: str, summary: dict[str, Any]) -> None:
+        """Persist (no-op)."""
+        await self._io()
+
+    async def take_session_snapshot(self, meeting_id: str) -> None:
+        """No drain snapshots offline."""
+        return None
+
+    async def get_user(self, user_id: str) -> None:
+        """Unknown user — the summary endpoint skips the email."""
+        await self._io()
+
+
+def in_process_client(llm_latency_ms: float, db_latency_ms: float) -> httpx.AsyncClient:
+    """The app in this process, wired to local stand-ins."""
+    from meetmind import main
+    from meetmind.api import meeting_api
+
+    # Keep the report readable — the app logs every request at info
+    structlog.configure(wrapper_class=structlog.make_filtering_bound_logger(logging.WARNING))
+    stand_in = StandInStorage(db_latency_ms)
+    main.storage = stand_in  # type: ignore[assignment]
+    meeting_api.storage = stand_in  # type: ignore[assignment]
+    meeting_api.create_llm_provider = lambda: StubLLMProvider(llm_latency_ms)  # type: ignore[assignment]
+    main.meeting_manager.init_agents()
+    main.limiter.enabled = False
+
+    transport = httpx.ASGITransport(app=main.app)
+    return httpx.AsyncClient(transport=transport, base_url="http://replay", timeout=120)
+
+
+# ─── Report ─────────────────────────────────────────────────────
+
+
+def print_level(level: dict[str, Any], violations: list[str]) -> None:
+    """One table per concurrency level."""
+    verdict = "OK" if not violations else "SLO BREACH"
+    print(
+        f"\n── concurrency {level['concurrency']:>4}  wall {level['wall_s']:>7.2f}s  "
+        f"dropped {level['dropped_segments']}  → {verdict}"
+    )
+    print(
+        f"   {'endpoint':<11}{'reqs':>7}{'req/s':>9}"
+        f"{'p50 ms':>10}{'p95 ms':>10}{'p99 ms':>10}{'errors':>9}"
+    )
+    for name, s in level["endpoints"].items():
+        print(
+            f"   {name:<11}{s['requests']:>7}{s['rps']:>9.2f}{s['p50_ms']:>10.1f}"
+            f"{s['p95_ms']:>10.1f}{s['p99_ms']:>10.1f}{s['error_rate']:>9.2%}"
+        )
+    for v in violations:
+        print(f"   ✗ {v}")
+
+
+async def run(args: argparse.Namespace) -> int:
+    """Ramp through the concurrency levels and report."""
+    recordings = load_recordings(args.recordings) if args.recordings else [builtin_recording()]
+    if not recordings:
+        print("No recordings found", file=sys.stderr)
+        return 1
+    levels = [int(c) for c in args.concurrency.split(",")]
+    slos = parse_slos(args.slo)
+
+    if args.url:
+        client = httpx.AsyncClient(
+            base_url=args.url,
+            timeout=120,
+            limits=httpx.Limits(max_connections=max(levels) * 2),
+        )
+    else:
+        client = in_process_client(args.llm_latency_ms, args.db_latency_ms)
+
+    target = args.url or "in-process (stand-ins)"
+    longest = max(r.duration_s for r in recordings) / args.speed
+    print(f"Target: {target} · {len(recordings)} recording(s) · speed {args.speed:g}x")
+    print(f"Levels: {levels} · ~{longest:.0f}s per level · SLOs: {args.slo}")
+
+    results = []
+    breaking: int | None = None
+    async with client:
+        for concurrency in levels:
+            level = await run_level(client, recordings, concurrency, args.speed)
+            if not level["endpoints"]["transcript"]["requests"]:
+                print(f"No transcript requests sent at concurrency {concurrency}", file=sys.stderr)
+                return 1
+            violations = check_slos(level, slos, args.max_error_rate)
+            level.pop("_histograms")
+            level["slo_violations"] = violations
+            results.append(level)
+            print_level(level, violations)
+            if violations and breaking is None:
+                breaking = concurrency
+                if args.stop_on_breach:
+                    break
+
+    print()
+    if breaking is None:
+        print(f"SLOs held up to concurrency {levels[-1]}")
+    else:
+        held = [c for c in levels if c < breaking]
+        last_ok = f"held at {held[-1]}" if held else "never held"
+        print(f"SLOs break at concurrency {breaking} ({last_ok})")
+
+    if args.json:
+        Path(args.json).write_text(
+            json.dumps(
+                {"target": target, "speed": args.speed, "breaks_at": breaking, "levels": results},
+                indent=2,
+            )
+        )
+    return 0
+
+
+# ─── Export ─────────────────────────────────────────────────────
+
+
+async def export(args: argparse.Namespace) -> int:
+    """Write recent meetings from the database as replay recordings."""
+    from meetmind.core import storage
+
+    out = Path(args.out)
+    out.mkdir(parents=True, exist_ok=True)
+    pool = await storage.get_pool()
+    async with pool.acquire() as conn:
+        rows = await conn.fetch(
+            "SELECT id FROM meetings WHERE status = 'completed' ORDER BY started_at DESC LIMIT $1",
+            args.limit,
+        )
+    written = 0
+    for row in rows:
+        meeting = await storage.get_meeting(row["id"])
+        segments = (meeting or {}).get("segments") or []
+        if not segments:
+            continue
+        t0 = float(segments[0]["timestamp_unix"] or 0)
+        recording = {
+            "language": meeting.get("language", "es"),  # type: ignore[union-attr]
+            "segments": [
+                {
+                    "text": s["text"],
+                    "speaker": s["speaker"],
+                    "offset_s": round(float(s["timestamp_unix"] or t0) - t0, 2),
+                }
+                for s in segments
+            ],
+        }
+        (out / f"{row['id']}.json").write_text(json.dumps(recording, ensure_ascii=False))
+        written += 1
+    await storage.close_db()
+    print(f"Exported {written} meeting(s) to {out}/")
+    return 0
+
+
+def main() -> None:
+    """CLI entry point."""
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p_run = sub.add_parser("run", help="Replay meetings at increasing concurrency")
+    p_run.add_argument("recordings", nargs="*", help="Recording files or directories")
+    p_run.add_argument("--url", help="Running backend (default: in-process stand-ins)")
+    p_run.add_argument("--concurrency", default="1,5,10,25,50", help="Comma-separated levels")
+    p_run.add_argument("--speed", type=float, default=60.0, help="Replay time compression")
+    p_run.add_argument("--slo", default=DEFAULT_SLOS, help="endpoint:pNN=ms,...")
+    p_run.add_argument("--max-error-rate", type=float, default=0.01)
+    p_run.add_argument("--stop-on-breach", action="store_true")
+    p_run.add_argument("--llm-latency-ms", type=float, default=400.0, help="Stub LLM median")
+    p_run.add_argument("--db-latency-ms", type=float, default=2.0, help="Stand-in DB latency")
+    p_run.add_argument("--json", help="Write results as JSON")
+
+    p_export = sub.add_parser("export", help="Export recent meetings as recordings")
+    p_export.add_argument("out", help="Output directory")
+    p_export.add_argument("--limit", type=int, default=20)
+
+    args = parser.parse_args()
+    handler = run if args.command == "run" else export
+    sys.exit(asyncio.run(handler(args)))
+
+
+if __name__ == "__main__":
+    main()
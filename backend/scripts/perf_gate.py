@@ -0,0 +1,382 @@
+"""Performance regression gate — pinned benchmark runs vs. versioned baselines.
+
+Suites, each run ``--runs`` times in fresh processes (interleaved, so
+slow drift on the host spreads over all of them):
+
+  micro   ``bench_hot_paths.py`` at 1 KB and 100 KB — median time per case
+  load    ``load_replay.py`` in-process, one level (10 clients at 120x)
+          — transcript p50/p95 and the error rate
+  stt     ``bench_stt.py`` over ``$MEETMIND_PERF_STT_CORPUS`` with
+          ``$MEETMIND_PERF_STT_ENGINE`` — RTF, final p95, WER
+          (skipped when either is unset)
+
+Pinned configuration: the suite arguments below, ``PYTHONHASHSEED=0``,
+one BLAS/OpenMP thread, and the processes pinned to one CPU with
+``taskset`` where available. The arguments and whether the runs were
+pinned are hashed into the baseline, and ``check`` refuses to compare
+against a baseline recorded with a different configuration.
+
+Noise: every metric gets one sample per run. A metric regresses only
+when the whole 95% confidence interval (Welch) of the change in its mean
+is worse than its tolerance — so a stable metric fails on a small but
+consistent slowdown, a noisy one needs a bigger shift, and a single
+outlier run can't fail the gate.
+
+Baselines live in ``scripts/baselines/perf/<arch>-<isa>.json`` (one per
+host class, since absolute numbers only compare on like hardware).
+``record`` writes the current samples and bumps the baseline version;
+commit the file with the change that moved the numbers. Record on the
+runner that checks it: run the Backend CI workflow by hand with
+``record_perf_baseline`` and commit the ``perf-baseline`` artifact. A
+missing or stale baseline fails the ``perf-gate`` job rather than
+passing it.
+
+Run:
+    cd backend && uv run python scripts/perf_gate.py check
+    cd backend && uv run python scripts/perf_gate.py record --runs 7
+"""
+
+from __future__ import annotations
+
+import argparse
+import hashlib
+import json
+import math
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Any
+
+from meetmind.utils.cpu_features import host_features
+
+SCRIPTS = Path(__file__).parent
+BASELINE_DIR = SCRIPTS / "baselines" / "perf"
+
+MICRO_ARGS = ["--size", "1k", "--size", "100k", "--min-time", "0.05", "--repeats", "5"]
+LOAD_ARGS = ["--concurrency", "10", "--speed", "120", "--llm-latency-ms", "50",
+             "--db-latency-ms", "1", "--slo", ""]  # fmt: skip
+STT_ARGS = ["--chunk-ms", "100"]
+
+# Two-sided 95% t critical values by degrees of freedom (1..30)
+_T_975 = (
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+)  # fmt: skip
+
+
+@dataclass(frozen=True)
+class Tolerance:
+    """How much worse a metric may get before it counts as a regression."""
+
+    relative: float = 0.10
+    absolute: float = 0.0
+    higher_is_better: bool = False
+
+
+MICRO_TOLERANCE = Tolerance(relative=0.10)
+TOLERANCES = {
+    "load.transcript.p50_ms": Tolerance(relative=0.15, absolute=1.0),
+    "load.transcript.p95_ms": Tolerance(relative=0.20, absolute=2.0),
+    "load.transcript.error_rate": Tolerance(relative=0.0, absolute=0.005),
+    "stt.rtf": Tolerance(relative=0.10),
+    "stt.final_p95_ms": Tolerance(relative=0.15, absolute=5.0),
+    "stt.wer": Tolerance(relative=0.0, absolute=0.005),
+}
+
+
+def tolerance_for(metric: str) -> Tolerance:
+    """Tolerance of a metric (micro cases share one)."""
+    return TOLERANCES.get(metric, MICRO_TOLERANCE)
+
+
+# ─── Pinned Runs ────────────────────────────────────────────────
+
+
+def stt_config() -> tuple[str, str] | None:
+    """``(corpus, engine)`` when the STT suite is configured."""
+    corpus = os.environ.get("MEETMIND_PERF_STT_CORPUS", "")
+    engine = os.environ.get("MEETMIND_PERF_STT_ENGINE", "")
+    return (corpus, engine) if corpus and engine else None
+
+
+def config_fingerprint(suites: list[str]) -> str:
+    """Hash of everything that must match for numbers to be comparable."""
+    pinned = {
+        "suites": suites,
+        "micro": MICRO_ARGS,
+        "load": LOAD_ARGS,
+        "stt": [*STT_ARGS, *(stt_config() or ())] if "stt" in suites else None,
+        "pinned": bool(_pin_prefix()),
+    }
+    return hashlib.sha256(json.dumps(pinned, sort_keys=True).encode()).hexdigest()[:16]
+
+
+def _pinned_env() -> dict[str, str]:
+    env = dict(os.environ)
+    env.update(PYTHONHASHSEED="0", OMP_NUM_THREADS="1", OPENBLAS_NUM_THREADS="1")
+    src = str(SCRIPTS.parent / "src")
+    env["PYTHONPATH"] = os.pathsep.join(filter(None, (src, env.get("PYTHONPATH"))))
+    return env
+
+
+def _pin_prefix() -> list[str]:
+    """``taskset`` onto the last CPU — keeps the scheduler from migrating us."""
+    cpus = os.cpu_count() or 1
+    if sys.platform.startswith("linux") and cpus > 1 and shutil.which("taskset"):
+        return ["taskset", "-c", str(cpus - 1)]
+    return []
+
+
+def _run_script(script: str, args: list[str], out: Path) -> Any:
+    command = [*_pin_prefix(), sys.executable, str(SCRIPTS / script), *args, "--json", str(out)]
+    done = subprocess.run(  # noqa: S603 — our own scripts
+        command, env=_pinned_env(), capture_output=True, text=True, check=False
+    )
+    if not out.exists():
+        raise RuntimeError(f"{script} failed (exit {done.returncode}):\n{done.stderr[-2000:]}")
+    return json.loads(out.read_text())
+
+
+def run_micro(tmp: Path) -> dict[str, float]:
+    """One pinned hot-path run → ``micro.<case>.<size>`` median ns."""
+    report = _run_script("bench_hot_paths.py", MICRO_ARGS, tmp / "micro.json")
+    return {
+        f"micro.{r['case']}.{r['size']}": r["median_ns"]
+        for r in report["results"]
+        if r["variant"] == "python"
+    }
+
+
+def run_load(tmp: Path) -> dict[str, float]:
+    """One pinned replay level → transcript latency and error rate."""
+    report = _run_script("load_replay.py", ["run", *LOAD_ARGS], tmp / "load.json")
+    transcript = report["levels"][0]["endpoints"]["transcript"]
+    return {
+        "load.transcript.p50_ms": transcript["p50_ms"],
+        "load.transcript.p95_ms": transcript["p95_ms"],
+        "load.transcript.error_rate": transcript["error_rate"],
+    }
+
+
+def run_stt(tmp: Path) -> dict[str, float]:
+    """One STT benchmark run → RTF, final p95 and WER."""
+    corpus, engine = stt_config() or ("", "")
+    args = ["run", corpus, "--engine", engine, *STT_ARGS]
+    results = _run_script("bench_stt.py", args, tmp / "stt.json")
+    if not results:
+        raise RuntimeError(f"bench_stt.py produced no result for {engine}")
+    overall = results[0]["overall"]
+    return {
+        "stt.rtf": overall["rtf"],
+        "stt.final_p95_ms": overall["final_p95_ms"],
+        "stt.wer": overall["wer"],
+    }
+
+
+SUITES = {"micro": run_micro, "load": run_load, "stt": run_stt}
+
+
+def collect(suites: list[str], runs: int) -> dict[str, list[float]]:
+    """Run every suite ``runs`` times, interleaved; samples per metric."""
+    samples: dict[str, list[float]] = {}
+    for i in range(runs):
+        for suite in suites:
+            started = time.perf_counter()
+            with tempfile.TemporaryDirectory() as tmp:
+                values = SUITES[suite](Path(tmp))
+            for metric, value in values.items():
+                samples.setdefault(metric, []).append(float(value))
+            print(f"  run {i + 1}/{runs} {suite:<5} {time.perf_counter() - started:5.1f}s")
+    return samples
+
+
+# ─── Statistics ─────────────────────────────────────────────────
+
+
+def t_critical(df: float) -> float:
+    """Two-sided 95% t critical value (conservative: df rounded down)."""
+    if df < 1:
+        return _T_975[0]
+    index = int(df)
+    return _T_975[index - 1] if index <= len(_T_975) else 1.96
+
+
+def diff_interval(baseline: list[float], current: list[float]) -> tuple[float, float]:
+    """95% Welch confidence interval of ``mean(current) - mean(baseline)``."""
+    diff = statistics.fmean(current) - statistics.fmean(baseline)
+    var_b = statistics.variance(baseline) / len(baseline) if len(baseline) > 1 else 0.0
+    var_c = statistics.variance(current) / len(current) if len(current) > 1 else 0.0
+    se = math.sqrt(var_b + var_c)
+    if se == 0:
+        return diff, diff
+    df_terms = [v**2 / (n - 1) for v, n in ((var_b, len(baseline)), (var_c, len(current))) if n > 1]
+    df = (var_b + var_c) ** 2 / sum(df_terms) if sum(df_terms) else 1.0
+    half = t_critical(df) * se
+    return diff - half, diff + half
+
+
+@dataclass(frozen=True)
+class Verdict:
+    """Comparison of one metric."""
+
+    metric: str
+    baseline_mean: float
+    current_mean: float
+    low: float  # CI of the change, as a fraction of the baseline mean
+    high: float
+    regressed: bool
+    improved: bool
+
+
+def judge(metric: str, baseline: list[float], current: list[float]) -> Verdict:
+    """Regressed when the whole CI of the change is worse than the tolerance."""
+    tol = tolerance_for(metric)
+    base_mean = statistics.fmean(baseline)
+    low, high = diff_interval(baseline, current)
+    if tol.higher_is_better:
+        low, high = -high, -low  # now positive = worse
+    allowed = max(tol.relative * abs(base_mean), tol.absolute)
+    scale = abs(base_mean) or 1.0
+    return Verdict(
+        metric=metric,
+        baseline_mean=base_mean,
+        current_mean=statistics.fmean(current),
+        low=low / scale,
+        high=high / scale,
+        regressed=low > allowed,
+        improved=high < -allowed,
+    )
+
+
+# ─── Baselines ──────────────────────────────────────────────────
+
+
+def baseline_path() -> Path:
+    """Baseline for this host class."""
+    features = host_features()
+    return BASELINE_DIR / f"{features.arch}-{features.isa}.json"
+
+
+def _git_commit() -> str:
+    done = subprocess.run(
+        ["git", "rev-parse", "--short", "HEAD"],  # noqa: S607 — developer tool
+        capture_output=True,
+        text=True,
+        check=False,
+        cwd=SCRIPTS,
+    )
+    return done.stdout.strip() or "unknown"
+
+
+def _suites(args: argparse.Namespace) -> list[str]:
+    suites = args.suite or ["micro", "load", *(["stt"] if stt_config() else [])]
+    if "stt" in suites and not stt_config():
+        raise SystemExit("stt suite needs MEETMIND_PERF_STT_CORPUS and MEETMIND_PERF_STT_ENGINE")
+    return suites
+
+
+def record(args: argparse.Namespace) -> int:
+    """Measure and write a new baseline version."""
+    suites = _suites(args)
+    path = Path(args.baseline) if args.baseline else baseline_path()
+    previous = json.loads(path.read_text()) if path.exists() else {}
+    print(f"Recording {suites} x{args.runs} -> {path}")
+    samples = collect(suites, args.runs)
+
+    baseline = {
+        "version": previous.get("version", 0) + 1,
+        "recorded_at": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+        "commit": _git_commit(),
+        "config": config_fingerprint(suites),
+        "suites": suites,
+        "host": {**host_features().to_dict(), "pinned": bool(_pin_prefix())},
+        "runs": args.runs,
+        "metrics": {
+            name: [round(v, 4) for v in values] for name, values in sorted(samples.items())
+        },
+    }
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text(json.dumps(baseline, indent=2) + "\n")
+    print(f"Wrote baseline v{baseline['version']} ({len(samples)} metrics)")
+    return 0
+
+
+def check(args: argparse.Namespace) -> int:
+    """Measure and compare with the stored baseline.
+
+    Returns:
+        0 when nothing regressed, 1 on a regression, 2 without a usable
+        baseline for this host and configuration.
+    """
+    path = Path(args.baseline) if args.baseline else baseline_path()
+    if not path.exists():
+        print(f"No baseline at {path} — run: uv run python scripts/perf_gate.py record")
+        return 2
+    baseline = json.loads(path.read_text())
+    suites = [s for s in _suites(args) if s in baseline["suites"]]
+    if baseline["config"] != config_fingerprint(baseline["suites"]):
+        print(f"Baseline v{baseline['version']} was recorded with a different pinned config")
+        print("Re-record it in the same change that altered the configuration.")
+        return 2
+
+    print(f"Checking {suites} x{args.runs} against baseline v{baseline['version']} ({path.name})")
+    samples = collect(suites, args.runs)
+    verdicts = [
+        judge(metric, baseline["metrics"][metric], values)
+        for metric, values in sorted(samples.items())
+        if metric in baseline["metrics"]
+    ]
+
+    print(f"\n{'metric':<36} {'baseline':>11} {'current':>11} {'change (95% CI)':>22}")
+    for v in verdicts:
+        flag = "REGRESSED" if v.regressed else ("improved" if v.improved else "")
+        print(
+            f"{v.metric:<36} {v.baseline_mean:>11.4g} {v.current_mean:>11.4g} "
+            f"{f'[{v.low:+.1%}, {v.high:+.1%}]':>22}  {flag}"
+        )
+    regressed = [v.metric for v in verdicts if v.regressed]
+    if args.json:
+        Path(args.json).write_text(
+            json.dumps(
+                {
+                    "baseline_version": baseline["version"],
+                    "samples": samples,
+                    "regressed": regressed,
+                },
+                indent=2,
+            )
+        )
+    if regressed:
+        print(f"\n{len(regressed)} regression(s): {', '.join(regressed)}")
+        return 1
+    print("\nNo regressions beyond noise")
+    return 0
+
+
+def main() -> None:
+    """CLI entry point."""
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    sub = parser.add_subparsers(dest="command", required=True)
+    for name, help_text in (("check", "Compare against the baseline"), ("record", "New baseline")):
+        p = sub.add_parser(name, help=help_text)
+        p.add_argument("--suite", action="append", choices=list(SUITES), help="Repeatable")
+        p.add_argument("--runs", type=int, default=5, help="Repeated runs per suite (>= 3)")
+        p.add_argument("--baseline", help="Baseline file (default: per host class)")
+        if name == "check":
+            p.add_argument("--json", help="Write samples and verdicts as JSON")
+
+    args = parser.parse_args()
+    if args.runs < 3:
+        parser.error("--runs must be at least 3 for a confidence interval")
+    sys.exit(record(args) if args.command == "record" else check(args))
+
+
+if __name__ == "__main__":
+    main()
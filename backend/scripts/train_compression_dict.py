@@ -0,0 +1,75 @@
+"""Train the shared HTTP compression dictionary from real meeting payloads.
+
+Samples recent meetings from the database, serializes them the way the API
+does, and trains a zstd dictionary on the JSON. Point
+MEETMIND_COMPRESSION_DICTIONARY_PATH at the output and restart the backend.
+
+Clients key the dictionary by its SHA-256, so a new file simply makes them
+fetch it again; older clients fall back to plain zstd/gzip meanwhile.
+
+Run: cd backend && uv run python scripts/train_compression_dict.py [out] [meetings]
+"""
+
+import asyncio
+import json
+import sys
+
+import zstandard
+
+from meetmind.core import storage
+from meetmind.utils.http_compression import build_default_dictionary
+
+DICT_SIZE = 32 * 1024
+
+
+async def collect_samples(limit: int) -> list[bytes]:
+    """Serialize up to ``limit`` recent meetings as API-shaped JSON samples."""
+    pool = await storage.get_pool()
+    async with pool.acquire() as conn:
+        ids = await conn.fetch("SELECT id FROM meetings ORDER BY started_at DESC LIMIT $1", limit)
+
+    samples: list[bytes] = []
+    for row in ids:
+        meeting = await storage.get_meeting(row["id"])
+        if not meeting:
+            continue
+        segments = meeting.pop("segments", [])
+        samples.append(json.dumps(meeting, default=str).encode())
+        # Transcript chunks of typical response size, not one huge sample
+        for i in range(0, len(segments), 50):
+            samples.append(json.dumps(segments[i : i + 50], default=str).encode())
+    await storage.close_db()
+    return samples
+
+
+def main() -> None:
+    """Train and write the dictionary."""
+    out = sys.argv[1] if len(sys.argv) > 1 else "compression.dict"
+    limit = int(sys.argv[2]) if len(sys.argv) > 2 else 500
+
+    samples = asyncio.run(collect_samples(limit))
+    print(f"Collected {len(samples)} samples from up to {limit} meetings")
+    if len(samples) < 20:
+        print("Not enough data to train — keep using the built-in dictionary")
+        sys.exit(1)
+
+    trained = zstandard.train_dictionary(DICT_SIZE, samples)
+    # Served and loaded as raw content: keep the built-in vocabulary at the
+    # front, trained content (most frequent last) at the end.
+    data = build_default_dictionary() + b"\n" + trained.as_bytes()
+
+    plain = sum(len(s) for s in samples)
+    cctx = zstandard.ZstdCompressor(
+        level=3,
+        dict_data=zstandard.ZstdCompressionDict(data, dict_type=zstandard.DICT_TYPE_RAWCONTENT),
+    )
+    packed = sum(len(cctx.compress(s)) for s in samples)
+    print(f"Dictionary: {len(data)} bytes — samples {plain} → {packed} bytes")
+
+    with open(out, "wb") as f:
+        f.write(data)
+    print(f"Wrote {out}")
+
+
+if __name__ == "__main__":
+    main()
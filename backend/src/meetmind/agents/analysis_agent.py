@@ -26,6 +26,7 @@ class AnalysisInsight:
         category: str,
         input_tokens: int = 0,
         output_tokens: int = 0,
+        cached_tokens: int = 0,
     ) -> None:
         """Initialize an analysis insight.
 
@@ -36,6 +37,7 @@ class AnalysisInsight:
             category: Category (decision, action, risk, idea).
             input_tokens: Number of input tokens used.
             output_tokens: Number of output tokens used.
+            cached_tokens: Prompt tokens served from the provider's cache.
         """
         self.title = title
         self.analysis = analysis
@@ -43,6 +45,7 @@ class AnalysisInsight:
         self.category = category
         self.input_tokens = input_tokens
         self.output_tokens = output_tokens
+        self.cached_tokens = cached_tokens
 
     def to_dict(self) -> dict[str, str]:
         """Convert to dictionary for WebSocket transmission."""
@@ -135,6 +138,7 @@ class AnalysisAgent:
                 category=str(parsed.get("category", "idea")),
                 input_tokens=result.get("input_tokens", 0),
                 output_tokens=result.get("output_tokens", 0),
+                cached_tokens=result.get("cached_tokens", 0),
             )
 
             logger.info(
@@ -64,6 +64,7 @@ class CopilotResponse:
     input_tokens: int
     output_tokens: int
     model_tier: str = "sonnet"
+    cached_tokens: int = 0
 
 
 # Keywords that indicate a simple, factual query (→ Haiku)
@@ -167,6 +168,7 @@ class CopilotAgent:
                 input_tokens=result.get("input_tokens", 0),
                 output_tokens=result.get("output_tokens", 0),
                 model_tier=model_tier,
+                cached_tokens=result.get("cached_tokens", 0),
             )
 
         except Exception as e:
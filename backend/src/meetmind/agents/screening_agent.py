@@ -24,6 +24,7 @@ class ScreeningResult:
         text_length: int,
         input_tokens: int = 0,
         output_tokens: int = 0,
+        cached_tokens: int = 0,
     ) -> None:
         """Initialize a screening result.
 
@@ -33,12 +34,14 @@ class ScreeningResult:
             text_length: Length of the screened text.
             input_tokens: Number of input tokens used.
             output_tokens: Number of output tokens used.
+            cached_tokens: Prompt tokens served from the provider's cache.
         """
         self.relevant = relevant
         self.reason = reason
         self.text_length = text_length
         self.input_tokens = input_tokens
         self.output_tokens = output_tokens
+        self.cached_tokens = cached_tokens
 
     def to_dict(self) -> dict[str, object]:
         """Convert to dictionary for WebSocket transmission."""
@@ -110,6 +113,7 @@ class ScreeningAgent:
                 text_length=len(text),
                 input_tokens=result.get("input_tokens", 0),
                 output_tokens=result.get("output_tokens", 0),
+                cached_tokens=result.get("cached_tokens", 0),
             )
 
         except json.JSONDecodeError:
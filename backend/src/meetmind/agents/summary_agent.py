@@ -71,6 +71,7 @@ class MeetingSummary:
     latency_ms: float = 0.0
     input_tokens: int = 0
     output_tokens: int = 0
+    cached_tokens: int = 0
 
     def to_dict(self) -> dict[str, Any]:
         """Convert to dictionary for JSON serialization."""
@@ -157,6 +158,7 @@ class SummaryAgent:
                 latency_ms=latency_ms,
                 input_tokens=result.get("input_tokens", 0),
                 output_tokens=result.get("output_tokens", 0),
+                cached_tokens=result.get("cached_tokens", 0),
             )
 
         except Exception as e:
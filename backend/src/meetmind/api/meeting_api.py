@@ -9,6 +9,8 @@ STT is handled on-device (Whisper); this module provides:
 
 from __future__ import annotations
 
+import asyncio
+import time
 from typing import TYPE_CHECKING, Any
 
 import structlog
@@ -18,7 +20,11 @@ from meetmind.agents.copilot_agent import CopilotAgent
 from meetmind.agents.screening_agent import ScreeningAgent
 from meetmind.agents.summary_agent import SummaryAgent
 from meetmind.config.settings import settings
-from meetmind.core import storage
+from meetmind.core import cost_ledger, probes, session_snapshot, storage, tracing
+from meetmind.core import event_hub as events
+from meetmind.core.event_hub import event_hub
+from meetmind.core.memory import deep_sizeof
+from meetmind.core.metrics import metrics
 from meetmind.core.transcript import TranscriptManager
 from meetmind.providers.factory import create_llm_provider
 from meetmind.utils.cost_tracker import BudgetExceededError, CostTracker
@@ -47,6 +53,15 @@ class MeetingManager:
         self._transcripts: dict[str, TranscriptManager] = {}
         self._cost_trackers: dict[str, CostTracker] = {}
         self._languages: dict[str, str] = {}
+        self._owners: dict[str, str | None] = {}
+        # Held while a session is restored or created (both await the DB),
+        # and dropped when the last request waiting on it is done
+        self._session_locks: dict[str, asyncio.Lock] = {}
+        self._session_lock_users: dict[str, int] = {}
+        # Screening runs detached from the request when results are pushed
+        self._background: set[asyncio.Task[Any]] = set()
+        # Meetings with a screening in flight (at most one each)
+        self._screening: set[str] = set()
 
     def init_agents(self) -> None:
         """Initialize LLM provider and AI agents.
@@ -75,43 +90,167 @@ class MeetingManager:
     ) -> None:
         """Ensure a meeting session exists (in-memory + DB).
 
+        A meeting that was live in a previous process resumes from its
+        drain snapshot instead of starting over.
+
         Args:
             meeting_id: The unique meeting identifier.
             language: Language code (e.g. 'es', 'en').
             user_id: Owner's user ID for DB persistence.
         """
-        if meeting_id not in self._transcripts:
-            transcript = TranscriptManager(
-                screening_interval=settings.screening_interval_seconds,
+        if meeting_id in self._transcripts:
+            return
+        lock = self._session_locks.setdefault(meeting_id, asyncio.Lock())
+        self._session_lock_users[meeting_id] = self._session_lock_users.get(meeting_id, 0) + 1
+        try:
+            async with lock:
+                # Concurrent first batches queue here; only one builds it
+                if meeting_id not in self._transcripts:
+                    await self._create_session(meeting_id, language, user_id)
+        finally:
+            # Popping while others still wait would let a newcomer build
+            # the session under a second lock (e.g. after a failed create)
+            users = self._session_lock_users.pop(meeting_id) - 1
+            if users:
+                self._session_lock_users[meeting_id] = users
+            else:
+                del self._session_locks[meeting_id]
+
+    async def _create_session(self, meeting_id: str, language: str, user_id: str | None) -> None:
+        """Restore or start a session; the caller holds its lock."""
+        if await self._restore_session(meeting_id):
+            return
+        # Meeting row first: a request that finds the session in the dicts
+        # goes straight to saving segments, which reference it
+        try:
+            await storage.create_meeting(
+                meeting_id=meeting_id,
+                language=language,
+                user_id=user_id,
             )
-            transcript.set_meeting_id(meeting_id)
-            self._transcripts[meeting_id] = transcript
-            self._cost_trackers[meeting_id] = CostTracker(
-                budget_usd=settings.session_budget_usd,
+        except Exception as e:
+            # Meeting may already exist — that's fine
+            logger.debug(
+                "meeting_create_skipped",
+                meeting_id=meeting_id,
+                reason=str(e),
             )
-            lang_map = {
-                "es": "español",
-                "en": "english",
-                "pt": "português",
-                "fr": "français",
-                "de": "deutsch",
-            }
-            self._languages[meeting_id] = lang_map.get(language, language)
 
-            # Persist meeting to DB (idempotent — ignores if exists)
-            try:
-                await storage.create_meeting(
-                    meeting_id=meeting_id,
-                    language=language,
-                    user_id=user_id,
-                )
-            except Exception as e:
-                # Meeting may already exist — that's fine
-                logger.debug(
-                    "meeting_create_skipped",
-                    meeting_id=meeting_id,
-                    reason=str(e),
-                )
+        transcript = TranscriptManager(
+            screening_interval=settings.screening_interval_seconds,
+        )
+        transcript.set_meeting_id(meeting_id)
+        self._cost_trackers[meeting_id] = CostTracker(
+            budget_usd=settings.session_budget_usd,
+            provider=settings.llm_provider,
+        )
+        lang_map = {
+            "es": "español",
+            "en": "english",
+            "pt": "português",
+            "fr": "français",
+            "de": "deutsch",
+        }
+        self._languages[meeting_id] = lang_map.get(language, language)
+        self._owners[meeting_id] = user_id
+        self._transcripts[meeting_id] = transcript
+
+    async def _restore_session(self, meeting_id: str) -> bool:
+        """Resume a session from a drain snapshot, if one is waiting."""
+        try:
+            data = await storage.take_session_snapshot(meeting_id)
+        except Exception as e:
+            logger.warning("session_restore_failed", meeting_id=meeting_id, error=str(e))
+            return False
+        if data is None:
+            return False
+        try:
+            snapshot = session_snapshot.decode(data)
+        except session_snapshot.SnapshotError as e:
+            logger.warning("session_snapshot_dropped", meeting_id=meeting_id, error=str(e))
+            return False
+        self._transcripts[meeting_id] = snapshot.transcript
+        self._cost_trackers[meeting_id] = snapshot.tracker
+        self._languages[meeting_id] = snapshot.language
+        self._owners[meeting_id] = snapshot.owner
+        logger.info(
+            "session_restored",
+            meeting_id=meeting_id,
+            segments=snapshot.transcript.segment_count,
+            buffered=snapshot.transcript.buffer_size,
+        )
+        return True
+
+    async def drain(self, timeout: float = 10.0) -> int:
+        """Snapshot the live sessions for the next process.
+
+        Runs at shutdown, once the server has finished in-flight requests,
+        so sessions those requests opened are included.
+
+        Waits (up to ``timeout``) for in-flight background screening so
+        its results land in the tracker and the buffer it consumed is not
+        screened again after the restart.
+
+        Args:
+            timeout: Seconds to wait for background screening.
+
+        Returns:
+            Number of sessions snapshotted.
+        """
+        if self._background:
+            _, pending = await asyncio.wait(set(self._background), timeout=timeout)
+            for task in pending:
+                task.cancel()
+        snapshots = [
+            (
+                meeting_id,
+                session_snapshot.encode(
+                    session_snapshot.SessionSnapshot(
+                        transcript=transcript,
+                        tracker=self._cost_trackers[meeting_id],
+                        language=self._languages.get(meeting_id, "español"),
+                        owner=self._owners.get(meeting_id),
+                    )
+                ),
+            )
+            for meeting_id, transcript in self._transcripts.items()
+        ]
+        if not snapshots:
+            return 0
+        try:
+            saved = await storage.save_session_snapshots(snapshots)
+        except Exception as e:
+            logger.error("session_drain_failed", sessions=len(snapshots), error=str(e))
+            return 0
+        logger.info(
+            "sessions_drained",
+            sessions=saved,
+            bytes=sum(len(data) for _, data in snapshots),
+        )
+        return saved
+
+    def memory_by_session(self) -> dict[str, int]:
+        """Bytes held by each live session (transcript, cost tracker, metadata).
+
+        Objects sessions share (owner IDs, language names) are counted
+        once, for the first session that holds them.
+        """
+        # Built up front: a tuple freed mid-walk could hand its ID (already
+        # in ``seen``) to the next session's tuple
+        sessions = [
+            (
+                meeting_id,
+                (
+                    transcript,
+                    self._cost_trackers.get(meeting_id),
+                    self._languages.get(meeting_id),
+                    self._owners.get(meeting_id),
+                ),
+            )
+            for meeting_id, transcript in list(self._transcripts.items())
+        ]
+        seen: set[int] = set()
+        return {meeting_id: deep_sizeof(state, seen) for meeting_id, state in sessions}
 
     def cleanup_session(self, meeting_id: str) -> None:
         """Remove session state for a completed meeting.
@@ -122,6 +261,7 @@ class MeetingManager:
         self._transcripts.pop(meeting_id, None)
         self._cost_trackers.pop(meeting_id, None)
         self._languages.pop(meeting_id, None)
+        self._owners.pop(meeting_id, None)
 
     async def ingest_transcript(
         self,
@@ -129,6 +269,8 @@ class MeetingManager:
         segments: list[dict[str, Any]],
         language: str = "es",
         user_id: str | None = None,
+        screen: bool = True,
+        push: bool = False,
     ) -> dict[str, Any]:
         """Ingest transcript segments and run screening if needed.
 
@@ -137,10 +279,18 @@ class MeetingManager:
             segments: List of {text, speaker} dicts from the client.
             language: Language code for AI responses.
             user_id: Owner's user ID for DB persistence.
+            screen: False to only store the segments (the owner is over
+                quota); the buffer is screened once this is True again.
+            push: The sending client reads the live event stream, so
+                results can be pushed rather than returned.
 
         Returns:
-            Dict with screening/analysis results (if triggered).
+            Dict with screening/analysis results (if triggered). When the
+            client opted into ``push`` and the owner has a live event
+            connection, screening runs in the background and its results
+            are pushed instead (``screening_pending`` is True).
         """
+        ingest_started = time.perf_counter()
         await self.get_or_create_session(meeting_id, language, user_id=user_id)
         transcript = self._transcripts[meeting_id]
         tracker = self._cost_trackers.get(meeting_id)
@@ -148,34 +298,99 @@ class MeetingManager:
 
         result: dict[str, Any] = {"segments_added": 0, "screening": None}
 
-        for seg in segments:
-            text = seg.get("text", "")
-            speaker = seg.get("speaker", "unknown")
-            if text.strip():
-                transcript.add_chunk(text, speaker=speaker)
-                result["segments_added"] += 1
-
-        # Persist segments to DB
+        # Persist first: the client retries until a batch is acknowledged,
+        # so segments it already delivered are skipped, not screened again
+        fresh = segments
         try:
-            await storage.save_segments(meeting_id, segments)
+            with tracing.span("db_persist"):
+                stored = await storage.save_segments(meeting_id, segments)
+            fresh = [seg for seg in segments if seg.get("id") is None or int(seg["id"]) in stored]
         except Exception as e:
             logger.warning("transcript_persist_failed", error=str(e))
 
-        # Run screening if buffer threshold reached
-        if transcript.should_screen() and self._screening_agent:
+        with cost_ledger.meeting(meeting_id), cost_ledger.cpu("ingest"):
+            for seg in fresh:
+                text = seg.get("text", "")
+                speaker = seg.get("speaker", "unknown")
+                if text.strip():
+                    transcript.add_chunk(text, speaker=speaker)
+                    result["segments_added"] += 1
+        if probes.SEGMENTS_INGESTED.enabled:
+            probes.SEGMENTS_INGESTED.fire(meeting_id, result["segments_added"])
+
+        # Run screening if buffer threshold reached (a pure retry adds
+        # nothing new to screen). One at a time per meeting: while one is in
+        # flight, new text stays buffered and goes out with the next batch.
+        if (
+            screen
+            and result["segments_added"]
+            and meeting_id not in self._screening
+            and transcript.should_screen()
+            and self._screening_agent
+        ):
             screening_text = transcript.get_screening_text()
             full_context = transcript.get_full_transcript()
-            screening_result = await self._run_screening(
+            if probes.BATCH_FORMED.enabled:
+                probes.BATCH_FORMED.fire(meeting_id, len(screening_text))
+            screening = self._run_screening(
                 meeting_id,
                 screening_text,
                 full_context,
                 tracker,
                 lang,
+                ingest_started=ingest_started,
             )
-            result["screening"] = screening_result
+            self._screening.add(meeting_id)
+            if push and event_hub.has_subscribers(self._owners.get(meeting_id)):
+                task = asyncio.create_task(screening)
+                self._background.add(task)
+                task.add_done_callback(self._background.discard)
+                task.add_done_callback(lambda _: self._screening.discard(meeting_id))
+                result["screening_pending"] = True
+            else:
+                try:
+                    result["screening"] = await screening
+                finally:
+                    self._screening.discard(meeting_id)
 
         return result
 
+    async def persist_transcript(
+        self,
+        meeting_id: str,
+        segments: list[dict[str, Any]],
+        language: str = "es",
+        user_id: str | None = None,
+    ) -> dict[str, Any]:
+        """Store segments for a meeting that is no longer live.
+
+        For uploads a client couldn't deliver before the meeting ended: the
+        transcript is saved (deduplicated like a live ingest) but no
+        session is created and nothing is screened, so a late upload
+        spends no LLM budget.
+
+        Args:
+            meeting_id: The meeting the segments belong to.
+            segments: Segment dicts as for :meth:`ingest_transcript`.
+            language: Language code, used if the meeting row is missing.
+            user_id: Owner's user ID.
+
+        Returns:
+            Dict with the number of new segments and no screening.
+        """
+        try:
+            await storage.create_meeting(meeting_id=meeting_id, language=language, user_id=user_id)
+        except Exception as e:
+            logger.debug("meeting_create_skipped", meeting_id=meeting_id, reason=str(e))
+        stored = await storage.save_segments(meeting_id, segments)
+        added = sum(
+            1
+            for seg in segments
+            if str(seg.get("text", "")).strip()
+            and (seg.get("id") is None or int(seg["id"]) in stored)
+        )
+        return {"segments_added": added, "screening": None}
+
     async def _run_screening(
         self,
         meeting_id: str,
@@ -183,6 +398,7 @@ class MeetingManager:
         full_context: str,
         tracker: CostTracker | None,
         language: str,
+        ingest_started: float | None = None,
     ) -> dict[str, Any]:
         """Run screening + analysis pipeline.
 
@@ -192,10 +408,35 @@ class MeetingManager:
             full_context: Full transcript for analysis context.
             tracker: Cost tracker for this session.
             language: Language for AI responses.
+            ingest_started: ``perf_counter()`` when the triggering ingest
+                arrived, for the end-to-end ingest → insight latency.
 
         Returns:
             Dict with screening and analysis results.
         """
+        with cost_ledger.meeting(meeting_id, self._owners.get(meeting_id)):
+            result = await self._screen_and_analyze(
+                meeting_id, screening_text, full_context, tracker, language
+            )
+        event_hub.publish(self._owners.get(meeting_id), events.SCREENING, result, meeting_id)
+        if "analysis" in result:
+            if ingest_started is not None:
+                metrics.stage("ingest_to_insight").observe(time.perf_counter() - ingest_started)
+            event_hub.publish(
+                self._owners.get(meeting_id), events.INSIGHT, result["analysis"], meeting_id
+            )
+            tracing.mark("insight_published")
+        return result
+
+    async def _screen_and_analyze(
+        self,
+        meeting_id: str,
+        screening_text: str,
+        full_context: str,
+        tracker: CostTracker | None,
+        language: str,
+    ) -> dict[str, Any]:
+        """Screening + analysis calls and cost/DB bookkeeping."""
         result: dict[str, Any] = {"relevant": False}
 
         if not self._screening_agent or not self._analysis_agent:
@@ -203,7 +444,8 @@ class MeetingManager:
             return result
 
         try:
-            screening = await self._screening_agent.screen(screening_text)
+            with tracing.span("screening"):
+                screening = await self._screening_agent.screen(screening_text)
         except BudgetExceededError:
             result["budget_exceeded"] = True
             return result
@@ -218,18 +460,20 @@ class MeetingManager:
                 s_model,
                 input_tokens=screening.input_tokens,
                 output_tokens=screening.output_tokens,
+                cached_tokens=screening.cached_tokens,
             )
 
         result.update(screening.to_dict())
 
         if screening.relevant:
             try:
-                insight = await self._analysis_agent.analyze(
-                    segment=screening_text,
-                    context=full_context,
-                    screening_reason=screening.reason,
-                    language=language,
-                )
+                with tracing.span("analysis"):
+                    insight = await self._analysis_agent.analyze(
+                        segment=screening_text,
+                        context=full_context,
+                        screening_reason=screening.reason,
+                        language=language,
+                    )
             except BudgetExceededError:
                 result["budget_exceeded"] = True
                 return result
@@ -245,11 +489,13 @@ class MeetingManager:
                         a_model,
                         input_tokens=insight.input_tokens,
                         output_tokens=insight.output_tokens,
+                        cached_tokens=insight.cached_tokens,
                     )
                 result["analysis"] = insight.to_dict()
 
                 try:
-                    await storage.save_insight(meeting_id, insight.to_dict())
+                    with tracing.span("db_persist"):
+                        await storage.save_insight(meeting_id, insight.to_dict())
                 except Exception as e:
                     logger.warning("insight_persist_failed", error=str(e))
 
@@ -260,6 +506,7 @@ class MeetingManager:
         meeting_id: str,
         question: str,
         transcript_context: str,
+        user_id: str | None = None,
     ) -> dict[str, Any]:
         """Run copilot to answer a question with meeting context.
 
@@ -267,6 +514,7 @@ class MeetingManager:
             meeting_id: Meeting identifier (for cost tracking).
             question: The user's question.
             transcript_context: Full meeting transcript.
+            user_id: Asking user, charged for the call's LLM cost.
 
         Returns:
             Dict with AI answer and metadata.
@@ -280,10 +528,14 @@ class MeetingManager:
         tracker = self._cost_trackers.get(meeting_id)
 
         try:
-            response = await self._copilot_agent.respond(
-                question,
-                transcript_context,
-            )
+            with (
+                tracing.span("copilot"),
+                cost_ledger.meeting(meeting_id, user_id or self._owners.get(meeting_id)),
+            ):
+                response = await self._copilot_agent.respond(
+                    question,
+                    transcript_context,
+                )
         except Exception as e:
             logger.warning("copilot_llm_failed", error=str(e))
             return {
@@ -302,6 +554,7 @@ class MeetingManager:
                 model_id,
                 input_tokens=response.input_tokens,
                 output_tokens=response.output_tokens,
+                cached_tokens=response.cached_tokens,
             )
 
         return {
@@ -316,13 +569,18 @@ class MeetingManager:
         meeting_id: str,
         full_transcript: str,
         language: str = "es",
+        user_id: str | None = None,
     ) -> dict[str, Any]:
         """Generate a post-meeting summary.
 
+        Progress and the final summary are also pushed to the owner's
+        live event connections.
+
         Args:
             meeting_id: Meeting identifier (for cost tracking + DB).
             full_transcript: Complete meeting transcript.
             language: Language code for AI response.
+            user_id: Owner's user ID for event delivery.
 
         Returns:
             Dict with summary data.
@@ -336,12 +594,16 @@ class MeetingManager:
                 },
             }
 
+        owner = user_id or self._owners.get(meeting_id)
+        event_hub.publish(owner, events.SUMMARY_PROGRESS, {"stage": "started"}, meeting_id)
+
         tracker = self._cost_trackers.get(meeting_id)
         lang = self._languages.get(meeting_id, language)
-        result = await self._summary_agent.summarize(
-            full_transcript,
-            language=lang,
-        )
+        with tracing.span("summary"), cost_ledger.meeting(meeting_id, owner):
+            result = await self._summary_agent.summarize(
+                full_transcript,
+                language=lang,
+            )
 
         if tracker:
             sum_model = (
@@ -353,20 +615,25 @@ class MeetingManager:
                 sum_model,
                 input_tokens=result.input_tokens,
                 output_tokens=result.output_tokens,
+                cached_tokens=result.cached_tokens,
             )
 
         summary_data = result.to_dict()
 
+        event_hub.publish(owner, events.SUMMARY_PROGRESS, {"stage": "saving"}, meeting_id)
         try:
-            await storage.save_summary(meeting_id, summary_data)
+            with tracing.span("db_persist"):
+                await storage.save_summary(meeting_id, summary_data)
         except Exception as e:
             logger.warning("summary_persist_failed", error=str(e))
 
-        return {
+        response = {
             "summary": summary_data,
             "latency_ms": result.latency_ms,
             "error": result.title == "Summary Error",
         }
+        event_hub.publish(owner, events.SUMMARY, response, meeting_id)
+        return response
 
 
 # Global meeting manager instance
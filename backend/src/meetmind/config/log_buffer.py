@@ -0,0 +1,295 @@
+"""Buffered structured logging — sample on the hot path, render off it.
+
+The request path only samples/rate-caps an event and appends its raw
+``event_dict`` to a bounded ring (``collections.deque.append`` is atomic,
+so producers never take a lock). A background thread drains the ring,
+timestamps and renders the events (JSON or console), and writes them in
+batches. When producers outrun the writer the oldest events are
+overwritten and counted, never blocking a request.
+
+Sampling is configured per event name (``transcript_chunk_added=0.05``)
+and applies to debug/info only; warnings and errors are always kept.
+The per-event rate cap reports how many events it suppressed on the next
+one that gets through.
+"""
+
+from __future__ import annotations
+
+import json
+import random
+import sys
+import threading
+import time
+from collections import deque
+from datetime import UTC, datetime
+from typing import TYPE_CHECKING, Any
+
+import structlog
+
+from meetmind.core import probes
+from meetmind.core.metrics import metrics
+
+if TYPE_CHECKING:
+    from collections.abc import Callable, MutableMapping
+
+_ALWAYS_KEEP = frozenset({"warning", "warn", "error", "exception", "critical", "fatal"})
+
+
+def parse_sample_rates(spec: str) -> dict[str, float]:
+    """Parse ``"event=rate,event=rate"`` into a dict (bad entries are skipped)."""
+    rates: dict[str, float] = {}
+    for part in spec.split(","):
+        name, _, value = part.partition("=")
+        try:
+            rates[name.strip()] = min(max(float(value), 0.0), 1.0)
+        except ValueError:
+            continue
+    rates.pop("", None)
+    return rates
+
+
+# ─── Hot Path ───────────────────────────────────────────────────
+
+
+class EventSampler:
+    """structlog processor that drops sampled-out and over-cap events.
+
+    Runs first in the chain, so dropped events cost a dict lookup and
+    nothing else.
+    """
+
+    def __init__(self, rates: dict[str, float] | None = None, rate_limit: int = 0) -> None:
+        """Initialize the sampler.
+
+        Args:
+            rates: Keep probability per event name (1.0 = keep all).
+            rate_limit: Max events per second per event name (0 = unlimited).
+        """
+        self._rates = rates or {}
+        self._rate_limit = rate_limit
+        # event → [second, count in that second, suppressed since last kept]
+        self._windows: dict[str, list[int]] = {}
+        self.sampled_out = 0
+        self.rate_limited = 0
+
+    def __call__(
+        self, _logger: Any, method_name: str, event_dict: MutableMapping[str, Any]
+    ) -> MutableMapping[str, Any]:
+        """Keep or drop one event."""
+        if method_name in _ALWAYS_KEEP:
+            return event_dict
+        event = event_dict.get("event")
+        if not isinstance(event, str):
+            return event_dict
+
+        rate = self._rates.get(event)
+        if rate is not None and rate < 1.0:
+            if random.random() >= rate:  # noqa: S311 — sampling, not crypto
+                self.sampled_out += 1
+                raise structlog.DropEvent
+            event_dict["sample_rate"] = rate
+
+        if self._rate_limit:
+            now = int(time.monotonic())
+            window = self._windows.get(event)
+            if window is None:
+                self._windows[event] = [now, 1, 0]
+            elif window[0] != now:
+                if window[2]:
+                    event_dict["suppressed"] = window[2]
+                window[0], window[1], window[2] = now, 1, 0
+            elif window[1] >= self._rate_limit:
+                window[2] += 1
+                self.rate_limited += 1
+                raise structlog.DropEvent
+            else:
+                window[1] += 1
+        return event_dict
+
+
+def capture_event(
+    _logger: Any, method_name: str, event_dict: MutableMapping[str, Any]
+) -> tuple[tuple[MutableMapping[str, Any]], dict[str, Any]]:
+    """Final hot-path processor: stamp the raw time and hand the dict over as-is.
+
+    Exception info is resolved here because ``sys.exc_info()`` is only
+    valid inside the handler that logged it.
+    """
+    event_dict["_ts"] = time.time()
+    event_dict["level"] = method_name
+    if event_dict.get("exc_info") is True:
+        event_dict["exc_info"] = sys.exc_info()
+    return (event_dict,), {}
+
+
+class BufferedLogger:
+    """structlog logger whose every method pushes onto the ring buffer."""
+
+    def __init__(self, ring: LogRingBuffer) -> None:
+        """Bind to a ring buffer."""
+        self._ring = ring
+
+    def msg(self, event_dict: MutableMapping[str, Any]) -> None:
+        """Queue one event (all level methods alias this)."""
+        self._ring.push(event_dict)
+
+    debug = info = warning = warn = error = critical = exception = fatal = log = msg
+
+
+class BufferedLoggerFactory:
+    """``logger_factory`` for structlog.configure()."""
+
+    def __init__(self, ring: LogRingBuffer) -> None:
+        """Bind to a ring buffer."""
+        self._logger = BufferedLogger(ring)
+
+    def __call__(self, *args: Any) -> BufferedLogger:
+        """Return the shared buffered logger."""
+        return self._logger
+
+
+# ─── Background Writer ──────────────────────────────────────────
+
+
+def _format_timestamp(
+    _logger: Any, _method_name: str, event_dict: MutableMapping[str, Any]
+) -> MutableMapping[str, Any]:
+    ts = event_dict.pop("_ts", None)
+    if ts is not None:
+        event_dict["timestamp"] = datetime.fromtimestamp(ts, UTC).isoformat()
+    return event_dict
+
+
+class LogRingBuffer:
+    """Bounded event ring drained and rendered by a background thread."""
+
+    def __init__(
+        self,
+        processors: list[Callable[..., Any]],
+        *,
+        capacity: int = 8192,
+        flush_interval: float = 0.1,
+        write: Callable[[str], Any] | None = None,
+    ) -> None:
+        """Initialize the buffer (call :meth:`start` to begin draining).
+
+        Args:
+            processors: Off-path processors; the last one must render a str.
+            capacity: Events held before the oldest are overwritten.
+            flush_interval: Seconds between drains.
+            write: Output function (default: stdout).
+        """
+        self._ring: deque[MutableMapping[str, Any]] = deque(maxlen=capacity)
+        self._capacity = capacity
+        self._processors = [_format_timestamp, *processors]
+        self._interval = flush_interval
+        self._write = write or sys.stdout.write
+        self._flush_lock = threading.Lock()
+        self._stop = threading.Event()
+        self._thread: threading.Thread | None = None
+        self.overwritten = 0
+        self.written = 0
+
+    def push(self, event_dict: MutableMapping[str, Any]) -> None:
+        """Queue an event without locking (called on the request path)."""
+        if len(self._ring) >= self._capacity:
+            self.overwritten += 1
+        self._ring.append(event_dict)
+
+    def start(self) -> None:
+        """Start the background writer thread."""
+        if self._thread is not None:
+            return
+        self._thread = threading.Thread(target=self._run, name="log-writer", daemon=True)
+        self._thread.start()
+
+    def stop(self) -> None:
+        """Stop the writer and flush what is left."""
+        self._stop.set()
+        if self._thread is not None:
+            self._thread.join(timeout=2)
+            self._thread = None
+        self.flush()
+
+    def _run(self) -> None:
+        while not self._stop.wait(self._interval):
+            self.flush()
+
+    def _render(self, event_dict: MutableMapping[str, Any]) -> str:
+        method_name = str(event_dict.pop("level", "info"))
+        result: Any = event_dict
+        for processor in self._processors:
+            result = processor(None, method_name, result)
+        return str(result)
+
+    def _internal(self, event: str, **fields: Any) -> str:
+        """Render the buffer's own warning like any other event.
+
+        Falls back to plain JSON if the configured renderer fails on it too,
+        so the output stays one parseable record per line either way.
+        """
+        now = time.time()
+        try:
+            return self._render({"event": event, "level": "warning", "_ts": now, **fields})
+        except Exception:
+            timestamp = datetime.fromtimestamp(now, UTC).isoformat()
+            return json.dumps(
+                {"event": event, "level": "warning", "timestamp": timestamp, **fields},
+                default=str,
+            )
+
+    def flush(self) -> int:
+        """Render and write everything queued so far.
+
+        Returns:
+            Number of events written.
+        """
+        with self._flush_lock:
+            lines: list[str] = []
+            queue_wait = metrics.stage("log_queue_wait")
+            now = time.time()
+            while True:
+                try:
+                    event_dict = self._ring.popleft()
+                except IndexError:
+                    break
+                queue_wait.observe(now - event_dict.get("_ts", now))
+                try:
+                    lines.append(self._render(event_dict))
+                except Exception as e:  # never lose the writer thread
+                    lines.append(
+                        self._internal(
+                            "log_render_failed", source=str(event_dict.get("event")), error=str(e)
+                        )
+                    )
+            if self.overwritten:
+                lines.append(self._internal("log_buffer_overflow", dropped=self.overwritten))
+                self.overwritten = 0
+            if lines:
+                self._write("\n".join(lines) + "\n")
+                flush = getattr(sys.stdout, "flush", None)
+                if flush is not None and self._write is sys.stdout.write:
+                    flush()
+            self.written += len(lines)
+            if lines and probes.LOG_FLUSH.enabled:
+                probes.LOG_FLUSH.fire(len(lines))
+            return len(lines)
+
+    def snapshot(self) -> list[dict[str, Any]]:
+        """Copies of the queued events, for memory accounting from any thread.
+
+        ``push`` appends without a lock, so the ring is copied in one C
+        call before anything loops over it; the flush lock keeps the
+        writer from rendering (mutating) events while they're copied.
+        """
+        with self._flush_lock:
+            return [dict(event) for event in list(self._ring)]
+
+    def to_dict(self) -> dict[str, int]:
+        """Buffer statistics."""
+        return {
+            "queued": len(self._ring),
+            "capacity": self._capacity,
+            "overwritten": self.overwritten,
+            "written": self.written,
+        }
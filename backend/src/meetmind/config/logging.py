@@ -1,14 +1,25 @@
 """Structured logging configuration for MeetMind.
 
 Uses structlog for consistent, JSON-formatted logs following
-MEETMIND_DEVELOPMENT_STANDARDS.md OBS-001.
+MEETMIND_DEVELOPMENT_STANDARDS.md OBS-001. With ``log_async`` (default)
+events are sampled and queued on the request path and rendered on a
+background thread — see ``log_buffer``.
 """
 
+import atexit
 import logging
 
 import structlog
 
+from meetmind.config.log_buffer import (
+    BufferedLoggerFactory,
+    EventSampler,
+    LogRingBuffer,
+    capture_event,
+    parse_sample_rates,
+)
 from meetmind.config.settings import settings
+from meetmind.core.memory import deep_sizeof
 
 LOG_LEVELS = {
     "DEBUG": logging.DEBUG,
@@ -19,9 +30,18 @@ LOG_LEVELS = {
 }
 
 
+_buffer: LogRingBuffer | None = None
+sampler: EventSampler | None = None
+
+
 def setup_logging() -> None:
     """Configure structlog with JSON output for production, console for dev."""
     log_level = LOG_LEVELS.get(settings.log_level.upper(), logging.INFO)
+    shutdown_logging()
+
+    if settings.log_async:
+        _setup_buffered(log_level)
+        return
 
     processors: list[structlog.types.Processor] = [
         structlog.contextvars.merge_contextvars,
@@ -45,6 +65,63 @@ def setup_logging() -> None:
     )
 
 
+def _setup_buffered(log_level: int) -> None:
+    """Sample + queue on the calling thread; timestamp + render on the writer."""
+    global _buffer, sampler
+    sampler = EventSampler(
+        parse_sample_rates(settings.log_sample_rates),
+        rate_limit=settings.log_rate_limit,
+    )
+    renderer: list[structlog.types.Processor] = [
+        structlog.stdlib.add_log_level,
+        structlog.processors.StackInfoRenderer(),
+        structlog.processors.UnicodeDecoder(),
+    ]
+    if settings.environment == "dev":
+        renderer.append(structlog.dev.ConsoleRenderer())
+    else:
+        renderer += [structlog.processors.format_exc_info, structlog.processors.JSONRenderer()]
+
+    _buffer = LogRingBuffer(renderer, capacity=settings.log_buffer_size)
+    _buffer.start()
+
+    structlog.configure(
+        processors=[sampler, structlog.contextvars.merge_contextvars, capture_event],
+        wrapper_class=structlog.make_filtering_bound_logger(log_level),
+        context_class=dict,
+        logger_factory=BufferedLoggerFactory(_buffer),
+        cache_logger_on_first_use=True,
+    )
+
+
+def shutdown_logging() -> None:
+    """Flush and stop the background log writer (safe to call repeatedly)."""
+    global _buffer
+    if _buffer is not None:
+        _buffer.stop()
+        _buffer = None
+
+
+def log_buffer_bytes() -> int:
+    """Memory held by the log ring (events waiting for the writer)."""
+    buffer = _buffer
+    return deep_sizeof(buffer.snapshot()) if buffer is not None else 0
+
+
+def logging_stats() -> dict[str, int]:
+    """Buffer and sampling counters (empty when logging is synchronous)."""
+    if _buffer is None or sampler is None:
+        return {}
+    return {
+        **_buffer.to_dict(),
+        "sampled_out": sampler.sampled_out,
+        "rate_limited": sampler.rate_limited,
+    }
+
+
+atexit.register(shutdown_logging)
+
+
 def get_logger(name: str) -> structlog.stdlib.BoundLogger:
     """Get a structured logger with the given name.
 
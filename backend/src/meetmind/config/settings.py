@@ -37,16 +37,59 @@ class Settings(BaseSettings):
     # Screening
     screening_interval_seconds: int = 5
 
+    # Deploys: wait this long for in-flight screening before snapshotting sessions
+    drain_timeout_seconds: float = 10.0
+
+    # PDF reports streamed at once; further downloads wait for a slot
+    report_export_concurrency: int = 4
+
+    # Delta sync: live meetings' version bumps are batched this often
+    change_flush_seconds: float = 2.0
+
+    # Live push channel (SSE)
+    event_queue_size: int = 256  # per-connection backlog before oldest events drop
+    event_replay_size: int = 64  # recent events kept per user for Last-Event-ID resume
+    event_heartbeat_seconds: float = 15.0
+
+    # HTTP compression (JSON responses, request bodies)
+    compression_min_bytes: int = 1024  # smaller payloads go out uncompressed
+    compression_zstd_level: int = 3
+    compression_dictionary_path: str = ""  # trained dictionary; empty = built-in vocabulary
+
+    # Prometheus /metrics (latency histograms)
+    metrics_enabled: bool = True
+    metrics_token: str = ""  # if set, scrapes must send "Authorization: Bearer <token>"
+
+    # Live diagnosis (USDT is opt-in: install stapsdt + libstapsdt; SIGUSR2 toggles the recorder)
+    probes_record: bool = False  # start the in-process probe recorder at boot
+    perf_map: bool = False  # write /tmp/perf-<pid>.map for perf (CPython 3.12+)
+    memory_sample_seconds: float = 60.0  # per-subsystem byte counts / high-water marks
+    memory_tracemalloc: bool = False  # attribute allocations to modules (~10-30% CPU overhead)
+
     # Cost Optimization
     session_budget_usd: float = 1.00
     enable_transcript_compression: bool = True
     enable_response_cache: bool = True
     enable_smart_routing: bool = True
+    cost_ledger_dir: str = ""  # append-only per-call cost log; empty = rollup only
+    cost_ledger_flush_seconds: float = 15.0  # ledger → log file + meetings.cost_usd
+    cpu_usd_per_hour: float = 0.04048  # vCPU-hour price for server CPU rows (Fargate)
+
+    # Monthly per-user quotas (UTC calendar month; 0 = unlimited). "pro" covers pro and team.
+    quotas_enabled: bool = True
+    quota_free_minutes: float = 300.0
+    quota_free_llm_usd: float = 1.00
+    quota_free_summaries: int = 15
+    quota_pro_minutes: float = 3000.0
+    quota_pro_llm_usd: float = 20.00
+    quota_pro_summaries: int = 300
+    usage_flush_seconds: float = 30.0  # local counters → usage_counters table
 
     # Auth (zero-cost: Google + Apple OAuth)
     jwt_secret_key: str = ""  # Auto-generated if empty; set in .env for production
     jwt_access_minutes: int = 10080  # 7 days — avoids 401s without app-side auto-refresh
     jwt_refresh_days: int = 30
+    auth_token_cache_size: int = 4096  # verified tokens kept in memory
     google_client_id: str = (
         "190972367615-4ft721hggursqog484ftlibtthkeeskm.apps.googleusercontent.com"
     )
@@ -63,11 +106,19 @@ class Settings(BaseSettings):
 
     # Logging
     log_level: str = "INFO"
+    log_async: bool = True  # render and write logs on a background thread
+    log_buffer_size: int = 8192  # queued events before the oldest are overwritten
+    log_rate_limit: int = 100  # max events/second per event name (0 = unlimited)
+    # Keep probability per debug/info event name; warnings and errors are never sampled
+    log_sample_rates: str = "transcript_chunk_added=0.05,cache_hit=0.1,transcript_compressed=0.1"
 
     # Amazon SES (email summaries)
     ses_region: str = "us-east-1"
-    ses_sender: str = ""           # e.g. noreply@aurameet.live  — empty = email disabled
+    ses_sender: str = ""  # e.g. noreply@aurameet.live  — empty = email disabled
     ses_sender_name: str = "Aura Meet"
+    ses_send_concurrency: int = 4  # dedicated send threads (not the default executor)
+    ses_send_batch_size: int = 10
+    ses_send_max_retries: int = 3
 
     model_config = {"env_prefix": "MEETMIND_", "env_file": ".env"}
 
@@ -21,6 +21,7 @@ from fastapi import Depends, HTTPException, WebSocket, status
 from fastapi.security import HTTPAuthorizationCredentials, HTTPBearer
 
 from meetmind.config.settings import settings
+from meetmind.core.token_cache import VerifiedTokenCache
 
 logger = structlog.get_logger(__name__)
 
@@ -102,10 +103,28 @@ def create_reset_token(user_id: str) -> str:
     return jwt.encode(payload, _get_jwt_secret(), algorithm="HS256")
 
 
+# ─── Verified Token Cache ───────────────────────────────────────
+
+token_cache = VerifiedTokenCache(max_entries=settings.auth_token_cache_size)
+
+
+def revoke_user_tokens(user_id: str) -> None:
+    """Invalidate every token issued to a user so far (reset, deletion)."""
+    token_cache.revoke_user(user_id)
+
+
 def decode_token(token: str) -> dict[str, Any]:
-    """Decode and validate a JWT token."""
+    """Decode and validate a JWT token.
+
+    Verified payloads are cached by token digest, so repeat requests with
+    the same token cost a hash lookup instead of an HMAC verification.
+    """
+    cached = token_cache.get(token)
+    if cached is not None:
+        return cached
+
     try:
-        return jwt.decode(token, _get_jwt_secret(), algorithms=["HS256"])
+        payload: dict[str, Any] = jwt.decode(token, _get_jwt_secret(), algorithms=["HS256"])
     except jwt.ExpiredSignatureError:
         raise HTTPException(
             status_code=status.HTTP_401_UNAUTHORIZED,
@@ -117,10 +136,42 @@ def decode_token(token: str) -> dict[str, Any]:
             detail="Invalid token",
         ) from None
 
+    if token_cache.is_revoked(token, payload):
+        raise HTTPException(
+            status_code=status.HTTP_401_UNAUTHORIZED,
+            detail="Token revoked",
+        )
+
+    token_cache.put(token, payload)
+    return payload
+
+
+# ─── JWKS Key Tables ────────────────────────────────────────────
+
+
+def _build_key_table(jwks: dict[str, Any]) -> dict[str, Any]:
+    """Pre-parse a JWKS document into a kid → RSA public key table.
+
+    Parsing happens once per JWKS fetch instead of once per login.
+    """
+    from jwt.algorithms import RSAAlgorithm  # type: ignore[import-untyped]
+
+    table: dict[str, Any] = {}
+    for key in jwks.get("keys", []):
+        kid = key.get("kid")
+        if not kid:
+            continue
+        try:
+            table[kid] = RSAAlgorithm.from_jwk(key)
+        except (jwt.InvalidKeyError, ValueError, KeyError) as e:
+            logger.warning("jwks_key_skipped", kid=kid, error=str(e))
+    return table
+
 
 # ─── Google Token Verification ──────────────────────────────────
 
 _google_certs_cache: dict[str, Any] = {}
+_google_key_table: dict[str, Any] = {}
 _google_certs_expiry: datetime | None = None
 
 GOOGLE_CERTS_URL = "https://www.googleapis.com/oauth2/v3/certs"
@@ -128,31 +179,32 @@ GOOGLE_ISSUERS = ("https://accounts.google.com", "accounts.google.com")
 
 
 async def _get_google_public_keys() -> dict[str, Any]:
-    """Fetch and cache Google's public keys (JWKS)."""
-    global _google_certs_cache, _google_certs_expiry
+    """Fetch and cache Google's public keys as a kid → key table."""
+    global _google_certs_cache, _google_key_table, _google_certs_expiry
     now = datetime.now(UTC)
-    if _google_certs_cache and _google_certs_expiry and now < _google_certs_expiry:
-        return _google_certs_cache
+    if _google_key_table and _google_certs_expiry and now < _google_certs_expiry:
+        return _google_key_table
 
     try:
         async with httpx.AsyncClient(timeout=10.0) as client:
             resp = await client.get(GOOGLE_CERTS_URL)
             resp.raise_for_status()
             _google_certs_cache = resp.json()
+            _google_key_table = _build_key_table(_google_certs_cache)
             # Cache for 6 hours
             _google_certs_expiry = now + timedelta(hours=6)
     except (httpx.ConnectError, httpx.TimeoutException, httpx.HTTPStatusError) as e:
         logger.error("google_jwks_fetch_failed", error=str(e))
-        if _google_certs_cache:
+        if _google_key_table:
             # Use stale cache if available
             logger.warning("google_jwks_using_stale_cache")
-            return _google_certs_cache
+            return _google_key_table
         raise HTTPException(
             status_code=status.HTTP_503_SERVICE_UNAVAILABLE,
             detail="Unable to verify Google credentials. Please try again.",
         ) from None
 
-    return _google_certs_cache
+    return _google_key_table
 
 
 async def verify_google_token(id_token: str) -> dict[str, Any]:
@@ -161,31 +213,19 @@ async def verify_google_token(id_token: str) -> dict[str, Any]:
     Returns:
         Dict with: sub, email, name, picture
     """
-    jwks = await _get_google_public_keys()
+    keys = await _get_google_public_keys()
 
     try:
         # Decode header to get key ID
         header = jwt.get_unverified_header(id_token)
-        kid = header.get("kid")
+        public_key = keys.get(header.get("kid", ""))
 
-        # Find matching key
-        key_data = None
-        for key in jwks.get("keys", []):
-            if key.get("kid") == kid:
-                key_data = key
-                break
-
-        if not key_data:
+        if public_key is None:
             raise HTTPException(
                 status_code=status.HTTP_401_UNAUTHORIZED,
                 detail="Google token key not found",
             )
 
-        # Build public key and verify
-        from jwt.algorithms import RSAAlgorithm  # type: ignore[import-untyped]
-
-        public_key = RSAAlgorithm.from_jwk(key_data)
-
         payload = jwt.decode(
             id_token,
             public_key,  # type: ignore[arg-type]
@@ -212,6 +252,7 @@ async def verify_google_token(id_token: str) -> dict[str, Any]:
 # ─── Apple Token Verification ───────────────────────────────────
 
 _apple_certs_cache: dict[str, Any] = {}
+_apple_key_table: dict[str, Any] = {}
 _apple_certs_expiry: datetime | None = None
 
 APPLE_KEYS_URL = "https://appleid.apple.com/auth/keys"
@@ -219,29 +260,30 @@ APPLE_ISSUER = "https://appleid.apple.com"
 
 
 async def _get_apple_public_keys() -> dict[str, Any]:
-    """Fetch and cache Apple's public keys (JWKS)."""
-    global _apple_certs_cache, _apple_certs_expiry
+    """Fetch and cache Apple's public keys as a kid → key table."""
+    global _apple_certs_cache, _apple_key_table, _apple_certs_expiry
     now = datetime.now(UTC)
-    if _apple_certs_cache and _apple_certs_expiry and now < _apple_certs_expiry:
-        return _apple_certs_cache
+    if _apple_key_table and _apple_certs_expiry and now < _apple_certs_expiry:
+        return _apple_key_table
 
     try:
         async with httpx.AsyncClient(timeout=10.0) as client:
             resp = await client.get(APPLE_KEYS_URL)
             resp.raise_for_status()
             _apple_certs_cache = resp.json()
+            _apple_key_table = _build_key_table(_apple_certs_cache)
             _apple_certs_expiry = now + timedelta(hours=6)
     except (httpx.ConnectError, httpx.TimeoutException, httpx.HTTPStatusError) as e:
         logger.error("apple_jwks_fetch_failed", error=str(e))
-        if _apple_certs_cache:
+        if _apple_key_table:
             logger.warning("apple_jwks_using_stale_cache")
-            return _apple_certs_cache
+            return _apple_key_table
         raise HTTPException(
             status_code=status.HTTP_503_SERVICE_UNAVAILABLE,
             detail="Unable to verify Apple credentials. Please try again.",
         ) from None
 
-    return _apple_certs_cache
+    return _apple_key_table
 
 
 async def verify_apple_token(id_token: str) -> dict[str, Any]:
@@ -250,28 +292,18 @@ async def verify_apple_token(id_token: str) -> dict[str, Any]:
     Returns:
         Dict with: sub, email, name (may be empty for Apple)
     """
-    jwks = await _get_apple_public_keys()
+    keys = await _get_apple_public_keys()
 
     try:
         header = jwt.get_unverified_header(id_token)
-        kid = header.get("kid")
+        public_key = keys.get(header.get("kid", ""))
 
-        key_data = None
-        for key in jwks.get("keys", []):
-            if key.get("kid") == kid:
-                key_data = key
-                break
-
-        if not key_data:
+        if public_key is None:
             raise HTTPException(
                 status_code=status.HTTP_401_UNAUTHORIZED,
                 detail="Apple token key not found",
             )
 
-        from jwt.algorithms import RSAAlgorithm  # type: ignore[import-untyped]
-
-        public_key = RSAAlgorithm.from_jwk(key_data)
-
         # Apple uses bundle_id as audience
         audience = settings.apple_bundle_id or settings.apple_service_id
 
@@ -0,0 +1,370 @@
+"""Cost ledger — what each meeting really cost, call by call, durably.
+
+Every LLM call is recorded by the provider that made it: provider,
+model, uncached/cached/output tokens, latency, and USD from the
+per-provider price table (``utils.cost_tracker.PRICING``). CPU-heavy
+server stages record their thread CPU time with :func:`cpu`, priced at
+``cpu_usd_per_hour``. Rows are attributed to the meeting set with
+:func:`meeting` (a context variable, so background screening tasks
+inherit it); calls outside any meeting are kept as unattributed. When
+the meeting's owner is known, LLM cost also counts against their
+monthly quota (``core.usage``).
+
+Unlike ``CostTracker`` (per-session budget enforcement, gone when the
+session is), the ledger is durable. :meth:`CostLedger.flush` runs every
+``cost_ledger_flush_seconds`` and at shutdown:
+
+1. appends the pending rows as one compressed columnar block to
+   ``<cost_ledger_dir>/ledger-YYYYMMDD.mmcl`` (skipped when unset), and
+2. adds each meeting's cost since the last flush to ``meetings.cost_usd``,
+   so the column holds the meeting's full cost across evictions,
+   restarts and instances.
+
+Block layout (little-endian)::
+
+    magic "MMCL" | u8 version | u8 reserved | u16 reserved | u32 rows
+    u32 payload length | zlib(payload)
+
+    payload: u16 string count, then per string u16 length + UTF-8
+             i64 base timestamp (ms) + rows x u32 delta (ms)
+             rows x u8 kind (0 = llm, 1 = cpu)
+             rows x u16 meeting, provider, model (string indexes)
+             rows x u32 input, cached, output tokens, latency (µs)
+             rows x f64 cost (USD)
+
+For CPU rows ``model`` is the stage name and ``latency`` the CPU time.
+:func:`read_log` decodes a file back into rows.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import struct
+import threading
+import time
+import zlib
+from contextlib import contextmanager
+from contextvars import ContextVar
+from dataclasses import dataclass
+from datetime import UTC, datetime
+from pathlib import Path
+from typing import TYPE_CHECKING, Any
+
+import structlog
+
+from meetmind.config.settings import settings
+from meetmind.core import storage, usage
+from meetmind.utils.cost_tracker import price_tier, price_usd
+
+if TYPE_CHECKING:
+    from collections.abc import Iterator
+
+logger = structlog.get_logger(__name__)
+
+MAGIC = b"MMCL"
+VERSION = 1
+KIND_LLM = 0
+KIND_CPU = 1
+_HEADER = struct.Struct("<4sBBHII")
+_U32_MAX = 0xFFFFFFFF
+_MAX_TOTALS = 5000  # meetings kept in the in-process totals
+
+_meeting: ContextVar[str] = ContextVar("meetmind_cost_meeting", default="")
+_user: ContextVar[str | None] = ContextVar("meetmind_cost_user", default=None)
+
+
+@dataclass(frozen=True, slots=True)
+class LedgerRow:
+    """One LLM call or CPU-heavy stage."""
+
+    ts_ms: int
+    kind: int
+    meeting_id: str
+    provider: str
+    model: str  # stage name for CPU rows
+    input_tokens: int = 0
+    cached_tokens: int = 0
+    output_tokens: int = 0
+    latency_us: int = 0  # CPU time for CPU rows
+    cost_usd: float = 0.0
+
+
+# ─── Attribution ────────────────────────────────────────────────
+
+
+@contextmanager
+def meeting(meeting_id: str, user_id: str | None = None) -> Iterator[None]:
+    """Attribute ledger rows recorded in this context to a meeting (and its owner)."""
+    token = _meeting.set(meeting_id)
+    user_token = _user.set(user_id)
+    try:
+        yield
+    finally:
+        _user.reset(user_token)
+        _meeting.reset(token)
+
+
+def current_meeting() -> str:
+    """Meeting the current context is attributed to ('' if none)."""
+    return _meeting.get()
+
+
+@contextmanager
+def cpu(stage: str) -> Iterator[None]:
+    """Record the thread CPU time of a synchronous stage.
+
+    Only wrap code without ``await`` — across an await the thread runs
+    other tasks and their CPU would be billed here.
+    """
+    start = time.thread_time_ns()
+    try:
+        yield
+    finally:
+        ledger.record_cpu(stage, (time.thread_time_ns() - start) // 1000)
+
+
+# ─── Ledger ─────────────────────────────────────────────────────
+
+
+class CostLedger:
+    """Pending rows plus the per-meeting cost not yet rolled up."""
+
+    def __init__(self) -> None:
+        """Initialize an empty ledger."""
+        self._rows: list[LedgerRow] = []
+        self._unrolled: dict[str, float] = {}
+        self._lock = threading.Lock()
+        self.totals: dict[str, float] = {}  # per meeting, most recently active last
+
+    def record_llm(
+        self,
+        provider: str,
+        model_id: str,
+        *,
+        input_tokens: int,
+        output_tokens: int,
+        cached_tokens: int = 0,
+        cache_write_tokens: int = 0,
+        latency_ms: float = 0.0,
+    ) -> float:
+        """Record one LLM call against the current meeting.
+
+        Args:
+            provider: ``bedrock`` or ``openai``.
+            model_id: Model the call went to.
+            input_tokens: Uncached prompt tokens.
+            output_tokens: Completion tokens.
+            cached_tokens: Prompt tokens served from the provider's cache.
+            cache_write_tokens: Prompt tokens written to the provider's cache,
+                priced at its write rate and logged with ``input_tokens``.
+            latency_ms: Wall time of the call.
+
+        Returns:
+            The call's cost in USD.
+        """
+        cost = price_usd(
+            provider,
+            price_tier(provider, model_id),
+            input_tokens,
+            output_tokens,
+            cached_tokens,
+            cache_write_tokens,
+        )
+        self._append(
+            LedgerRow(
+                ts_ms=time.time_ns() // 1_000_000,
+                kind=KIND_LLM,
+                meeting_id=_meeting.get(),
+                provider=provider,
+                model=model_id,
+                input_tokens=input_tokens + cache_write_tokens,
+                cached_tokens=cached_tokens,
+                output_tokens=output_tokens,
+                latency_us=min(int(latency_ms * 1000), _U32_MAX),
+                cost_usd=cost,
+            )
+        )
+        user_id = _user.get()
+        if user_id:
+            usage.counters.add(user_id, llm_usd=cost)
+        return cost
+
+    def record_cpu(self, stage: str, cpu_us: int) -> None:
+        """Record server CPU time spent on a stage for the current meeting."""
+        self._append(
+            LedgerRow(
+                ts_ms=time.time_ns() // 1_000_000,
+                kind=KIND_CPU,
+                meeting_id=_meeting.get(),
+                provider="cpu",
+                model=stage,
+                latency_us=min(cpu_us, _U32_MAX),
+                cost_usd=cpu_us / 3.6e9 * settings.cpu_usd_per_hour,
+            )
+        )
+
+    def _append(self, row: LedgerRow) -> None:
+        with self._lock:
+            self._rows.append(row)
+            if row.meeting_id:
+                self._unrolled[row.meeting_id] = self._unrolled.get(row.meeting_id, 0.0) + (
+                    row.cost_usd
+                )
+                total = self.totals.pop(row.meeting_id, 0.0) + row.cost_usd
+                self.totals[row.meeting_id] = total
+                if len(self.totals) > _MAX_TOTALS:
+                    del self.totals[next(iter(self.totals))]
+
+    async def flush(self) -> int:
+        """Append pending rows to the log and roll costs into ``meetings.cost_usd``.
+
+        A failed rollup keeps its amounts for the next flush; nothing is
+        double counted because amounts are taken out before the write.
+
+        Returns:
+            Number of rows written to the log.
+        """
+        with self._lock:
+            rows, self._rows = self._rows, []
+            unrolled, self._unrolled = self._unrolled, {}
+        written = 0
+        if rows and settings.cost_ledger_dir:
+            try:
+                await asyncio.to_thread(append_block, Path(settings.cost_ledger_dir), rows)
+                written = len(rows)
+            except OSError as e:
+                logger.warning("cost_ledger_write_failed", rows=len(rows), error=str(e))
+        deltas = [(m, usd) for m, usd in unrolled.items() if usd > 0]
+        if deltas:
+            try:
+                await storage.add_meeting_costs(deltas)
+            except Exception as e:
+                logger.warning("cost_rollup_failed", meetings=len(deltas), error=str(e))
+                with self._lock:
+                    for meeting_id, usd in deltas:
+                        self._unrolled[meeting_id] = self._unrolled.get(meeting_id, 0.0) + usd
+        return written
+
+    async def run(self, interval: float) -> None:
+        """Flush every ``interval`` seconds until cancelled."""
+        while True:
+            await asyncio.sleep(interval)
+            await self.flush()
+
+
+ledger = CostLedger()
+
+
+# ─── Log Format ─────────────────────────────────────────────────
+
+
+def encode_block(rows: list[LedgerRow]) -> bytes:
+    """One columnar block for ``rows`` (see the module docstring)."""
+    strings: dict[str, int] = {}
+    for row in rows:
+        for value in (row.meeting_id, row.provider, row.model):
+            strings.setdefault(value, len(strings))
+    n = len(rows)
+    base = min(r.ts_ms for r in rows) if rows else 0
+    parts = [struct.pack("<H", len(strings))]
+    for value in strings:
+        data = value.encode()[:0xFFFF]
+        parts.append(struct.pack("<H", len(data)) + data)
+    parts += [
+        struct.pack("<q", base),
+        struct.pack(f"<{n}I", *(min(r.ts_ms - base, _U32_MAX) for r in rows)),
+        struct.pack(f"<{n}B", *(r.kind for r in rows)),
+        struct.pack(f"<{n}H", *(strings[r.meeting_id] for r in rows)),
+        struct.pack(f"<{n}H", *(strings[r.provider] for r in rows)),
+        struct.pack(f"<{n}H", *(strings[r.model] for r in rows)),
+        struct.pack(f"<{n}I", *(min(r.input_tokens, _U32_MAX) for r in rows)),
+        struct.pack(f"<{n}I", *(min(r.cached_tokens, _U32_MAX) for r in rows)),
+        struct.pack(f"<{n}I", *(min(r.output_tokens, _U32_MAX) for r in rows)),
+        struct.pack(f"<{n}I", *(r.latency_us for r in rows)),
+        struct.pack(f"<{n}d", *(r.cost_usd for r in rows)),
+    ]
+    payload = zlib.compress(b"".join(parts), 6)
+    return _HEADER.pack(MAGIC, VERSION, 0, 0, n, len(payload)) + payload
+
+
+def decode_blocks(data: bytes) -> Iterator[LedgerRow]:
+    """Rows of every block in a log file's bytes.
+
+    Raises:
+        ValueError: On a bad magic or version (a torn final block is skipped).
+    """
+    offset = 0
+    while offset + _HEADER.size <= len(data):
+        magic, version, _, _, n, length = _HEADER.unpack_from(data, offset)
+        if magic != MAGIC or version != VERSION:
+            raise ValueError(f"Not a cost ledger block at byte {offset}")
+        start = offset + _HEADER.size
+        if start + length > len(data):
+            return  # torn write at the tail
+        payload = zlib.decompress(data[start : start + length])
+        offset = start + length
+
+        pos = 2
+        strings: list[str] = []
+        for _ in range(struct.unpack_from("<H", payload)[0]):
+            (size,) = struct.unpack_from("<H", payload, pos)
+            strings.append(payload[pos + 2 : pos + 2 + size].decode())
+            pos += 2 + size
+        (base,) = struct.unpack_from("<q", payload, pos)
+        pos += 8
+        columns: list[tuple[Any, ...]] = []
+        for code, width in (
+            ("I", 4), ("B", 1), ("H", 2), ("H", 2), ("H", 2),
+            ("I", 4), ("I", 4), ("I", 4), ("I", 4), ("d", 8),
+        ):  # fmt: skip
+            columns.append(struct.unpack_from(f"<{n}{code}", payload, pos))
+            pos += n * width
+        ts, kind, meeting_ix, provider_ix, model_ix, inp, cached, out, latency, cost = columns
+        for i in range(n):
+            yield LedgerRow(
+                ts_ms=base + ts[i],
+                kind=kind[i],
+                meeting_id=strings[meeting_ix[i]],
+                provider=strings[provider_ix[i]],
+                model=strings[model_ix[i]],
+                input_tokens=inp[i],
+                cached_tokens=cached[i],
+                output_tokens=out[i],
+                latency_us=latency[i],
+                cost_usd=cost[i],
+            )
+
+
+def append_block(directory: Path, rows: list[LedgerRow]) -> Path:
+    """Append one block to today's (UTC) log file.
+
+    Returns:
+        The file written.
+    """
+    directory.mkdir(parents=True, exist_ok=True)
+    path = directory / f"ledger-{datetime.now(UTC):%Y%m%d}.mmcl"
+    with path.open("ab") as f:
+        f.write(encode_block(rows))
+    return path
+
+
+def read_log(path: Path) -> list[LedgerRow]:
+    """Every row in a ledger file."""
+    return list(decode_blocks(path.read_bytes()))
+
+
+def summarize(rows: list[LedgerRow]) -> dict[str, dict[str, Any]]:
+    """Per-meeting totals: USD, LLM calls and tokens, CPU seconds."""
+    out: dict[str, dict[str, Any]] = {}
+    for row in rows:
+        entry = out.setdefault(
+            row.meeting_id or "(unattributed)",
+            {"cost_usd": 0.0, "llm_calls": 0, "tokens": 0, "cpu_s": 0.0},
+        )
+        entry["cost_usd"] += row.cost_usd
+        if row.kind == KIND_LLM:
+            entry["llm_calls"] += 1
+            entry["tokens"] += row.input_tokens + row.cached_tokens + row.output_tokens
+        else:
+            entry["cpu_s"] += row.latency_us / 1e6
+    return out
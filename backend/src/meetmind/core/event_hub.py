@@ -0,0 +1,289 @@
+"""Event Hub — in-process fan-out of live meeting events to connected devices.
+
+Screening results, insights, summary progress, and action-item updates
+are published here the moment they are produced and pushed to every open
+Server-Sent Events connection for the owning user. Each event is
+serialized once and the same SSE frame is shared by all subscribers.
+
+Every subscriber has a bounded queue; a slow client loses its oldest
+events rather than stalling the publisher. A short per-user replay
+buffer lets a reconnecting client resume with ``Last-Event-ID``.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import contextlib
+import itertools
+import json
+import time
+from collections import OrderedDict, deque
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, Any
+
+import structlog
+
+from meetmind.config.settings import settings
+from meetmind.core import probes
+from meetmind.core.memory import deep_sizeof
+from meetmind.core.metrics import metrics
+
+if TYPE_CHECKING:
+    from collections.abc import AsyncIterator, Awaitable, Callable
+
+logger = structlog.get_logger(__name__)
+
+# Event types pushed to clients
+SCREENING = "screening"
+INSIGHT = "insight"
+SUMMARY_PROGRESS = "summary_progress"
+SUMMARY = "summary"
+ACTION_ITEM = "action_item"
+
+
+@dataclass(frozen=True, slots=True)
+class Event:
+    """A published event with its pre-encoded SSE frame."""
+
+    id: int
+    type: str
+    frame: bytes
+
+
+class Subscription:
+    """One device connection — a bounded queue of pending events."""
+
+    def __init__(self, hub: EventHub, user_id: str, max_queued: int) -> None:
+        """Initialize the subscription.
+
+        Args:
+            hub: Owning hub (for unsubscribe).
+            user_id: Subscribed user.
+            max_queued: Queue capacity before the oldest event is dropped.
+        """
+        self.user_id = user_id
+        self.dropped = 0
+        self._hub = hub
+        # (event, perf_counter_ns when queued) — the wait feeds event_queue_wait
+        self._queue: asyncio.Queue[tuple[Event, int]] = asyncio.Queue(maxsize=max_queued)
+
+    def offer(self, event: Event) -> None:
+        """Enqueue without blocking, dropping the oldest event when full."""
+        if self._queue.full():
+            self._queue.get_nowait()
+            self.dropped += 1
+        self._queue.put_nowait((event, time.perf_counter_ns()))
+        if probes.EVENT_ENQUEUE.enabled:
+            probes.EVENT_ENQUEUE.fire(self.user_id, self._queue.qsize(), self.dropped)
+
+    async def next(self, timeout: float) -> Event | None:
+        """Wait for the next event.
+
+        Args:
+            timeout: Seconds to wait before returning None (heartbeat).
+
+        Returns:
+            The next event, or None on timeout.
+        """
+        try:
+            event, queued_ns = await asyncio.wait_for(self._queue.get(), timeout=timeout)
+        except TimeoutError:
+            return None
+        wait_us = (time.perf_counter_ns() - queued_ns) // 1000
+        metrics.stage("event_queue_wait").record_us(wait_us)
+        if probes.EVENT_DEQUEUE.enabled:
+            probes.EVENT_DEQUEUE.fire(self.user_id, wait_us)
+        return event
+
+    def queued_events(self) -> list[Event]:
+        """Events waiting to be sent (for memory accounting)."""
+        return [event for event, _ in list(self._queue._queue)]  # type: ignore[attr-defined]
+
+    def close(self) -> None:
+        """Detach from the hub."""
+        self._hub.unsubscribe(self)
+
+
+class EventHub:
+    """Per-user publish/subscribe hub for live meeting events."""
+
+    def __init__(
+        self,
+        *,
+        max_queued: int = 256,
+        replay_size: int = 64,
+        max_replay_users: int = 1024,
+    ) -> None:
+        """Initialize the hub.
+
+        Args:
+            max_queued: Per-subscriber queue capacity.
+            replay_size: Recent events kept per user for resume.
+            max_replay_users: Users whose replay buffers are retained (LRU).
+        """
+        self._max_queued = max_queued
+        self._replay_size = replay_size
+        self._max_replay_users = max_replay_users
+        self._subscribers: dict[str, set[Subscription]] = {}
+        self._replay: OrderedDict[str, deque[Event]] = OrderedDict()
+        self._ids = itertools.count(1)
+        self._published = 0
+        self._delivered = 0
+
+    def subscribe(self, user_id: str, last_event_id: int | None = None) -> Subscription:
+        """Open a subscription for a user's events.
+
+        Args:
+            user_id: User to receive events for.
+            last_event_id: Resume point — buffered events after it are
+                queued immediately.
+
+        Returns:
+            The new subscription. Call ``close()`` when the client leaves.
+        """
+        sub = Subscription(self, user_id, self._max_queued)
+        self._subscribers.setdefault(user_id, set()).add(sub)
+        if last_event_id is not None:
+            for event in self._replay.get(user_id, ()):
+                if event.id > last_event_id:
+                    sub.offer(event)
+        logger.debug("event_subscribed", user_id=user_id, resume_from=last_event_id)
+        return sub
+
+    def unsubscribe(self, sub: Subscription) -> None:
+        """Remove a subscription (idempotent)."""
+        subs = self._subscribers.get(sub.user_id)
+        if subs is None:
+            return
+        subs.discard(sub)
+        if not subs:
+            del self._subscribers[sub.user_id]
+        if sub.dropped:
+            logger.warning("event_subscriber_lagged", user_id=sub.user_id, dropped=sub.dropped)
+
+    def has_subscribers(self, user_id: str | None) -> bool:
+        """Check whether a user has at least one live connection."""
+        return bool(user_id) and user_id in self._subscribers
+
+    def publish(
+        self,
+        user_id: str | None,
+        event_type: str,
+        data: dict[str, Any],
+        meeting_id: str | None = None,
+    ) -> int:
+        """Publish an event to all of a user's connections.
+
+        Args:
+            user_id: Owner of the meeting. No-op when None.
+            event_type: One of the module-level event type constants.
+            data: JSON-serializable payload.
+            meeting_id: Meeting the event belongs to.
+
+        Returns:
+            Number of connections the event was queued on.
+        """
+        if not user_id:
+            return 0
+        event_id = next(self._ids)
+        payload = json.dumps(
+            {"meeting_id": meeting_id, "ts": time.time(), **data},
+            ensure_ascii=False,
+            default=str,
+        )
+        event = Event(
+            id=event_id,
+            type=event_type,
+            frame=f"id: {event_id}\nevent: {event_type}\ndata: {payload}\n\n".encode(),
+        )
+
+        replay = self._replay.get(user_id)
+        if replay is None:
+            replay = self._replay[user_id] = deque(maxlen=self._replay_size)
+            if len(self._replay) > self._max_replay_users:
+                self._replay.popitem(last=False)
+        else:
+            self._replay.move_to_end(user_id)
+        replay.append(event)
+
+        subs = self._subscribers.get(user_id, ())
+        for sub in subs:
+            sub.offer(event)
+        self._published += 1
+        self._delivered += len(subs)
+        return len(subs)
+
+    def to_dict(self) -> dict[str, Any]:
+        """Stats for monitoring.
+
+        Returns:
+            Hub statistics dictionary.
+        """
+        return {
+            "users": len(self._subscribers),
+            "connections": sum(len(s) for s in self._subscribers.values()),
+            "published": self._published,
+            "delivered": self._delivered,
+        }
+
+    def memory_by_user(self) -> dict[str, int]:
+        """Bytes held per user: queued frames on open connections plus replay."""
+        usage: dict[str, int] = {}
+        for user_id, subs in list(self._subscribers.items()):
+            # Frames are shared between queues; count each user's once (the
+            # lists are kept alive so a freed one can't pass its ID on)
+            queued = [sub.queued_events() for sub in list(subs)]
+            seen: set[int] = set()
+            usage[user_id] = sum(deep_sizeof(events, seen) for events in queued)
+        for user_id, replay in list(self._replay.items()):
+            usage[user_id] = usage.get(user_id, 0) + deep_sizeof(replay)
+        return usage
+
+
+async def sse_stream(
+    sub: Subscription,
+    *,
+    heartbeat_s: float,
+    is_disconnected: Callable[[], Awaitable[bool]],
+) -> AsyncIterator[bytes]:
+    """Render a subscription as an SSE byte stream.
+
+    Sends a comment line as heartbeat when idle so proxies keep the
+    connection open, and always detaches the subscription on exit.
+
+    Args:
+        sub: Subscription to drain.
+        heartbeat_s: Idle seconds between heartbeats.
+        is_disconnected: Client disconnect probe (``request.is_disconnected``).
+
+    Yields:
+        SSE frames.
+    """
+    try:
+        yield b"retry: 3000\n\n"
+        while True:
+            event = await sub.next(timeout=heartbeat_s)
+            if event is None:
+                if await is_disconnected():
+                    return
+                yield b": ping\n\n"
+                continue
+            yield event.frame
+    finally:
+        sub.close()
+
+
+def parse_last_event_id(value: str | None) -> int | None:
+    """Parse a ``Last-Event-ID`` header value; invalid values are ignored."""
+    if not value:
+        return None
+    with contextlib.suppress(ValueError):
+        return int(value)
+    return None
+
+
+# Global hub instance
+event_hub = EventHub(
+    max_queued=settings.event_queue_size,
+    replay_size=settings.event_replay_size,
+)
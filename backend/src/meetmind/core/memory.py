@@ -0,0 +1,210 @@
+"""Memory accounting — which subsystem is holding the bytes when RSS climbs.
+
+Every long-lived structure (live sessions, the event hub's queues and
+replay buffers, the trace store, the token cache, the log ring, ...)
+registers a *sizer* with :data:`accountant`. A sizer returns the bytes it
+holds, or a per-key breakdown (per meeting, per user) that the report
+sums and ranks. Sizes are measured with :func:`deep_sizeof`, which walks
+containers and this package's own objects but counts third-party objects
+(clients, sockets, locks) shallowly, so one session never drags in the
+LLM provider.
+
+Sampling walks tens of thousands of objects (tens of ms for a long
+meeting), so it runs in a worker thread, not on the event loop. Sizers
+therefore copy a live container before looping over it in Python
+(``list(d.items())``, ``list(ring)``): the copy is a single C call the
+loop can't interleave with, while a Python-level loop can see the
+container change under it.
+
+:meth:`MemoryAccountant.sample` keeps a high-water mark per subsystem;
+the app samples periodically so peaks between two reads aren't lost.
+When ``memory_tracemalloc`` is on, the report also attributes live
+Python allocations to the module that made them (``meetmind.core.tracing``,
+``asyncpg``, ...) — the allocation-site view for growth no sizer covers.
+"""
+
+from __future__ import annotations
+
+import resource
+import sys
+import threading
+import tracemalloc
+from collections import deque
+from pathlib import Path
+from typing import TYPE_CHECKING, Any
+
+import structlog
+
+if TYPE_CHECKING:
+    from collections.abc import Callable, Mapping
+
+logger = structlog.get_logger(__name__)
+
+_CONTAINERS = (dict, list, tuple, set, frozenset, deque)
+_LEAVES = (str, bytes, bytearray, memoryview, int, float, bool, complex, type(None))
+_OWN_PACKAGE = "meetmind."
+
+
+def deep_sizeof(obj: object, seen: set[int] | None = None) -> int:
+    """Bytes reachable from ``obj`` (each object counted once).
+
+    Builtin containers and ``meetmind`` objects are followed; anything
+    else (modules, functions, third-party objects) counts only its own
+    ``sys.getsizeof``.
+
+    Args:
+        obj: Root object.
+        seen: Object IDs already counted (share it across calls to avoid
+            double counting between roots).
+    """
+    if seen is None:
+        seen = set()
+    total = 0
+    stack = [obj]
+    while stack:
+        item = stack.pop()
+        if id(item) in seen:
+            continue
+        seen.add(id(item))
+        total += sys.getsizeof(item, 0)
+        if isinstance(item, _LEAVES):
+            continue
+        if isinstance(item, dict):
+            stack.extend(item.keys())
+            stack.extend(item.values())
+        elif isinstance(item, _CONTAINERS):
+            stack.extend(item)
+        elif type(item).__module__.startswith(_OWN_PACKAGE):
+            attrs = getattr(item, "__dict__", None)
+            if attrs is not None:
+                stack.append(attrs)
+            for cls in type(item).__mro__:
+                for slot in cls.__dict__.get("__slots__", ()):
+                    value = getattr(item, slot, None)
+                    if value is not None:
+                        stack.append(value)
+    return total
+
+
+# ─── Process ────────────────────────────────────────────────────
+
+
+def process_memory() -> dict[str, int]:
+    """Current and peak RSS of this process, in bytes."""
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # ru_maxrss is KiB on Linux, bytes on macOS
+    peak_bytes = peak if sys.platform == "darwin" else peak * 1024
+    try:
+        pages = int(Path("/proc/self/statm").read_text().split()[1])
+        rss = pages * resource.getpagesize()
+    except (OSError, IndexError, ValueError):
+        rss = peak_bytes
+    return {"rss_bytes": rss, "peak_rss_bytes": peak_bytes}
+
+
+def allocations_by_module(limit: int = 20) -> dict[str, Any] | None:
+    """Live traced allocations grouped by allocating module (None if off)."""
+    if not tracemalloc.is_tracing():
+        return None
+    by_module: dict[str, list[int]] = {}
+    for stat in tracemalloc.take_snapshot().statistics("filename"):
+        module = _module_of(stat.traceback[0].filename)
+        entry = by_module.setdefault(module, [0, 0])
+        entry[0] += stat.size
+        entry[1] += stat.count
+    current, peak = tracemalloc.get_traced_memory()
+    top = sorted(by_module.items(), key=lambda kv: kv[1][0], reverse=True)[:limit]
+    return {
+        "traced_bytes": current,
+        "traced_peak_bytes": peak,
+        "modules": {name: {"bytes": size, "blocks": count} for name, (size, count) in top},
+    }
+
+
+def _module_of(filename: str) -> str:
+    """``.../site-packages/asyncpg/pool.py`` → ``asyncpg``; ours → ``meetmind.core.tracing``."""
+    parts = Path(filename).with_suffix("").parts
+    if "meetmind" in parts:
+        return ".".join(parts[len(parts) - 1 - parts[::-1].index("meetmind") :])
+    for marker in ("site-packages", "dist-packages"):
+        if marker in parts:
+            return parts[parts.index(marker) + 1]
+    for i, part in enumerate(parts[:-1]):
+        if part.startswith("python3"):
+            return parts[i + 1]  # stdlib package or module (asyncio, json, ...)
+    return parts[-1]
+
+
+# ─── Accountant ─────────────────────────────────────────────────
+
+
+class MemoryAccountant:
+    """Registered subsystem sizers with running high-water marks."""
+
+    def __init__(self) -> None:
+        """Initialize with no subsystems."""
+        self._sizers: dict[str, Callable[[], int | Mapping[str, int]]] = {}
+        self._high_water: dict[str, int] = {}
+        self._lock = threading.Lock()
+
+    def register(self, name: str, sizer: Callable[[], int | Mapping[str, int]]) -> None:
+        """Add (or replace) a subsystem.
+
+        Args:
+            name: Subsystem name in the report.
+            sizer: Returns bytes held, or bytes per key (session, user, ...).
+        """
+        self._sizers[name] = sizer
+
+    def sample(self, top: int = 10) -> dict[str, Any]:
+        """Measure every subsystem and update the high-water marks.
+
+        Blocking: call it through ``asyncio.to_thread`` from async code.
+
+        Args:
+            top: Largest keys to list for subsystems with a breakdown.
+
+        Returns:
+            Per-subsystem bytes, high water and top keys, plus process RSS.
+        """
+        with self._lock:
+            subsystems: dict[str, dict[str, Any]] = {}
+            for name, sizer in list(self._sizers.items()):
+                try:
+                    measured = sizer()
+                except Exception as e:  # one broken sizer must not hide the rest
+                    logger.warning("memory_sizer_failed", subsystem=name, error=str(e))
+                    continue
+                entry: dict[str, Any] = {}
+                if isinstance(measured, int):
+                    size = measured
+                else:
+                    size = sum(measured.values())
+                    ranked = sorted(measured.items(), key=lambda kv: kv[1], reverse=True)
+                    entry["count"] = len(measured)
+                    entry["top"] = dict(ranked[:top])
+                high = max(self._high_water.get(name, 0), size)
+                self._high_water[name] = high
+                subsystems[name] = {"bytes": size, "high_water_bytes": high, **entry}
+
+        process = process_memory()
+        accounted = sum(s["bytes"] for s in subsystems.values())
+        return {
+            **process,
+            "accounted_bytes": accounted,
+            "unaccounted_bytes": max(process["rss_bytes"] - accounted, 0),
+            "subsystems": dict(
+                sorted(subsystems.items(), key=lambda kv: kv[1]["bytes"], reverse=True)
+            ),
+        }
+
+    def report(self, top: int = 10) -> dict[str, Any]:
+        """A fresh sample plus the allocation-site view when tracing."""
+        report = self.sample(top=top)
+        allocations = allocations_by_module()
+        if allocations is not None:
+            report["allocations"] = allocations
+        return report
+
+
+accountant = MemoryAccountant()
@@ -0,0 +1,335 @@
+"""Metrics — per-stage latency histograms exposed in Prometheus format.
+
+Each histogram is HDR-style: microsecond values land in log-linear
+buckets (64 linear sub-buckets per power of two, ≤1.6% relative error)
+from 1µs to ~38h, so p99/p999 are exact to two significant digits without
+configuring bucket bounds up front.
+
+Recording is lock-free: every thread writes its own shard (the event
+loop, the log writer, executor threads), and shards are only merged when
+``/metrics`` is scraped. The hot path is a ``perf_counter_ns`` pair, a
+``bit_length`` and three integer adds.
+"""
+
+from __future__ import annotations
+
+import threading
+import time
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, Any
+
+if TYPE_CHECKING:
+    from types import TracebackType
+
+    from starlette.types import ASGIApp, Message, Receive, Scope, Send
+
+_SUB_BUCKET_BITS = 7
+_SUB_BUCKETS = 1 << _SUB_BUCKET_BITS  # values below this are exact
+_HALF = _SUB_BUCKETS // 2
+_MAX_EXPONENT = 37  # 2^37 µs ≈ 38h
+BUCKET_COUNT = _SUB_BUCKETS + (_MAX_EXPONENT - _SUB_BUCKET_BITS + 1) * _HALF
+
+# Prometheus `le` bounds (seconds) — coarse, for aggregation across instances
+PROMETHEUS_BUCKETS = (
+    0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 30.0, 60.0,
+)  # fmt: skip
+EXPORTED_QUANTILES = (0.5, 0.9, 0.99, 0.999)
+
+
+def bucket_index(value_us: int) -> int:
+    """HDR bucket for a microsecond value (clamped to the covered range)."""
+    if value_us < _SUB_BUCKETS:
+        return max(value_us, 0)
+    exponent = value_us.bit_length() - 1
+    if exponent > _MAX_EXPONENT:
+        return BUCKET_COUNT - 1
+    shift = exponent - (_SUB_BUCKET_BITS - 1)
+    return _SUB_BUCKETS + (exponent - _SUB_BUCKET_BITS) * _HALF + (value_us >> shift) - _HALF
+
+
+def bucket_upper_us(index: int) -> int:
+    """Highest microsecond value that maps to a bucket."""
+    if index < _SUB_BUCKETS:
+        return index
+    block, sub = divmod(index - _SUB_BUCKETS, _HALF)
+    shift = block + 1
+    return ((_HALF + sub + 1) << shift) - 1
+
+
+# ─── Histogram ──────────────────────────────────────────────────
+
+
+class _Shard:
+    """One thread's counts — only that thread ever writes it."""
+
+    __slots__ = ("count", "counts", "max_us", "sum_us")
+
+    def __init__(self) -> None:
+        self.counts = [0] * BUCKET_COUNT
+        self.count = 0
+        self.sum_us = 0
+        self.max_us = 0
+
+
+@dataclass
+class HistogramSnapshot:
+    """Merged view of a histogram at scrape time."""
+
+    counts: list[int]
+    count: int
+    sum_us: int
+    max_us: int
+
+    def quantile(self, q: float) -> float:
+        """Value at quantile ``q`` in seconds (0.0 when empty)."""
+        if not self.count:
+            return 0.0
+        rank = max(1, round(q * self.count))
+        seen = 0
+        for index, n in enumerate(self.counts):
+            seen += n
+            if seen >= rank:
+                return min(bucket_upper_us(index), self.max_us) / 1e6
+        return self.max_us / 1e6
+
+    def count_at_or_below(self, seconds: float) -> int:
+        """Observations ≤ ``seconds`` (bucket-resolution)."""
+        return sum(self.counts[: bucket_index(int(seconds * 1e6)) + 1])
+
+    def to_dict(self) -> dict[str, float]:
+        """Summary in milliseconds."""
+        return {
+            "count": self.count,
+            "mean_ms": round(self.sum_us / self.count / 1000, 3) if self.count else 0.0,
+            "p50_ms": round(self.quantile(0.5) * 1000, 3),
+            "p99_ms": round(self.quantile(0.99) * 1000, 3),
+            "max_ms": round(self.max_us / 1000, 3),
+        }
+
+
+class LatencyHistogram:
+    """HDR-style latency histogram with per-thread shards."""
+
+    def __init__(self) -> None:
+        """Initialize with no shards (created on each thread's first record)."""
+        self._local = threading.local()
+        self._shards: list[_Shard] = []
+        self._shards_lock = threading.Lock()
+
+    def _new_shard(self) -> _Shard:
+        shard = _Shard()
+        with self._shards_lock:
+            self._shards.append(shard)
+        self._local.shard = shard
+        return shard
+
+    def record_us(self, value_us: int) -> None:
+        """Record one observation in microseconds."""
+        try:
+            shard: _Shard = self._local.shard
+        except AttributeError:
+            shard = self._new_shard()
+        shard.counts[bucket_index(value_us)] += 1
+        shard.count += 1
+        shard.sum_us += value_us
+        if value_us > shard.max_us:
+            shard.max_us = value_us
+
+    def observe(self, seconds: float) -> None:
+        """Record one observation in seconds."""
+        self.record_us(int(seconds * 1e6))
+
+    def time(self) -> _Timer:
+        """Context manager that records the duration of its block."""
+        return _Timer(self)
+
+    def snapshot(self) -> HistogramSnapshot:
+        """Merge all shards (racy reads are fine — counts only grow)."""
+        with self._shards_lock:
+            shards = list(self._shards)
+        counts = [0] * BUCKET_COUNT
+        total = sum_us = max_us = 0
+        for shard in shards:
+            for index, n in enumerate(shard.counts):
+                if n:
+                    counts[index] += n
+            total += shard.count
+            sum_us += shard.sum_us
+            max_us = max(max_us, shard.max_us)
+        return HistogramSnapshot(counts=counts, count=total, sum_us=sum_us, max_us=max_us)
+
+
+class _Timer:
+    __slots__ = ("_histogram", "_start")
+
+    def __init__(self, histogram: LatencyHistogram) -> None:
+        self._histogram = histogram
+        self._start = 0
+
+    def __enter__(self) -> _Timer:
+        self._start = time.perf_counter_ns()
+        return self
+
+    def __exit__(
+        self,
+        exc_type: type[BaseException] | None,
+        exc: BaseException | None,
+        tb: TracebackType | None,
+    ) -> None:
+        self._histogram.record_us((time.perf_counter_ns() - self._start) // 1000)
+
+
+# ─── Registry ───────────────────────────────────────────────────
+
+
+_FAMILIES = {
+    "stage": (
+        "meetmind_stage_duration_seconds",
+        "Pipeline stage latency (parse, persist, screening, analysis, queues, ...)",
+    ),
+    "http": ("meetmind_http_request_duration_seconds", "HTTP request latency by route"),
+}
+
+
+class MetricsRegistry:
+    """Named histograms, rendered together on scrape."""
+
+    def __init__(self) -> None:
+        """Initialize an empty registry."""
+        self._histograms: dict[tuple[str, tuple[tuple[str, str], ...]], LatencyHistogram] = {}
+        self._stages: dict[str, LatencyHistogram] = {}  # fast path for stage()
+        self._lock = threading.Lock()
+
+    def histogram(self, family: str, **labels: str) -> LatencyHistogram:
+        """Get (or create) the histogram for a family + label set."""
+        key = (family, tuple(sorted(labels.items())))
+        histogram = self._histograms.get(key)
+        if histogram is None:
+            with self._lock:
+                histogram = self._histograms.setdefault(key, LatencyHistogram())
+        return histogram
+
+    def stage(self, name: str) -> LatencyHistogram:
+        """Histogram for a pipeline stage."""
+        histogram = self._stages.get(name)
+        if histogram is None:
+            histogram = self._stages[name] = self.histogram("stage", stage=name)
+        return histogram
+
+    def snapshot(self, family: str = "stage") -> dict[str, dict[str, float]]:
+        """Per-series summaries for one family (keyed by joined label values)."""
+        return {
+            ",".join(v for _, v in labels): h.snapshot().to_dict()
+            for (fam, labels), h in sorted(self._series(), key=lambda item: item[0])
+            if fam == family
+        }
+
+    def render_prometheus(self) -> str:
+        """Render every histogram in the Prometheus text format (0.0.4)."""
+        lines: list[str] = []
+        all_series = self._series()
+        for family, (name, help_text) in _FAMILIES.items():
+            series = sorted(
+                ((k[1], h) for k, h in all_series if k[0] == family), key=lambda x: x[0]
+            )
+            if not series:
+                continue
+            snapshots = [(labels, h.snapshot()) for labels, h in series]
+
+            lines.append(f"# HELP {name} {help_text}")
+            lines.append(f"# TYPE {name} histogram")
+            for labels, snap in snapshots:
+                base = _format_labels(labels)
+                for le in PROMETHEUS_BUCKETS:
+                    bucket_labels = _format_labels((*labels, ("le", _format_float(le))))
+                    lines.append(f"{name}_bucket{bucket_labels} {snap.count_at_or_below(le)}")
+                lines.append(
+                    f"{name}_bucket{_format_labels((*labels, ('le', '+Inf')))} {snap.count}"
+                )
+                lines.append(f"{name}_sum{base} {_format_float(snap.sum_us / 1e6)}")
+                lines.append(f"{name}_count{base} {snap.count}")
+
+            quantile_name = name.replace("_seconds", "_quantile_seconds")
+            lines.append(f"# HELP {quantile_name} {help_text} (HDR quantiles since start)")
+            lines.append(f"# TYPE {quantile_name} gauge")
+            for labels, snap in snapshots:
+                for q in EXPORTED_QUANTILES:
+                    q_labels = _format_labels((*labels, ("quantile", str(q))))
+                    lines.append(f"{quantile_name}{q_labels} {_format_float(snap.quantile(q))}")
+        return "\n".join(lines) + "\n" if lines else ""
+
+    def _series(self) -> list[tuple[tuple[str, tuple[tuple[str, str], ...]], LatencyHistogram]]:
+        with self._lock:  # request threads may add series mid-scrape
+            return list(self._histograms.items())
+
+    def reset(self) -> None:
+        """Drop every histogram (tests)."""
+        with self._lock:
+            self._histograms.clear()
+            self._stages.clear()
+
+
+def _format_labels(labels: tuple[tuple[str, str], ...]) -> str:
+    if not labels:
+        return ""
+    pairs = (
+        k + '="' + v.replace("\\", "\\\\").replace('"', '\\"').replace("\n", "\\n") + '"'
+        for k, v in labels
+    )
+    return "{" + ",".join(pairs) + "}"
+
+
+def _format_float(value: float) -> str:
+    return repr(float(value))
+
+
+# ─── HTTP Middleware ────────────────────────────────────────────
+
+
+# Methods that get their own series; anything else is labelled "other"
+_METHODS = frozenset({"GET", "POST", "PUT", "PATCH", "DELETE", "OPTIONS", "HEAD"})
+
+
+class MetricsMiddleware:
+    """Pure ASGI middleware timing each request by route template.
+
+    The route template (``/api/meetings/{meeting_id}``) rather than the raw
+    path keeps label cardinality bounded; unmatched paths share one series,
+    and so do methods outside the standard set.
+    """
+
+    def __init__(self, app: ASGIApp, registry: MetricsRegistry) -> None:
+        """Wrap an ASGI app."""
+        self.app = app
+        self.registry = registry
+
+    async def __call__(self, scope: Scope, receive: Receive, send: Send) -> None:
+        """Time HTTP requests; pass everything else through."""
+        if scope["type"] != "http":
+            await self.app(scope, receive, send)
+            return
+
+        start = time.perf_counter_ns()
+        status = 500
+
+        async def send_wrapper(message: Message) -> None:
+            nonlocal status
+            if message["type"] == "http.response.start":
+                status = message["status"]
+            await send(message)
+
+        try:
+            await self.app(scope, receive, send_wrapper)
+        finally:
+            route: Any = scope.get("route")
+            path = getattr(route, "path", None) or "unmatched"
+            self.registry.histogram(
+                "http",
+                method=scope["method"] if scope["method"] in _METHODS else "other",
+                route=path,
+                status=f"{status // 100}xx",
+            ).record_us((time.perf_counter_ns() - start) // 1000)
+
+
+# Global instance (one per process)
+metrics = MetricsRegistry()
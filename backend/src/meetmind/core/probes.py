@@ -0,0 +1,258 @@
+"""Probes — static tracepoints for looking inside a live instance.
+
+The hot path fires named probes at its key points: segments ingested, a
+screening batch formed, every pipeline stage finishing (screening,
+analysis, persist, ...), event queue enqueue/dequeue, cache hits and
+misses, DB flushes, and log buffer drains. The catalogue is declared once
+below, like a USDT provider header, so tools can list it.
+
+A call site checks ``probe.enabled`` before building any arguments; with
+nothing listening that is a single attribute load and the arguments are
+never evaluated. Two things can listen:
+
+- **USDT.** When the optional ``stapsdt`` package is installed, every
+  probe is registered as a USDT probe of provider ``meetmind``, so
+  ``bpftrace -p <pid> -e 'usdt:*:meetmind:db_flush { ... }'`` attaches to
+  a running process without a restart. The kernel flips the probe's
+  semaphore on attach; a watcher thread polls the semaphores every
+  :data:`USDT_POLL_SECONDS` and ``enabled`` follows them, so a probe no
+  tracer is attached to stays off. String arguments go out as
+  NUL-terminated bytes (read them with ``str(arg0)``). USDT is opt-in:
+  neither ``stapsdt`` nor the ``libstapsdt`` it wraps is a dependency or
+  part of the image, so install both where you want to trace.
+- **Recorder.** An in-process ring of recent firings, for boxes where
+  eBPF isn't available. ``SIGUSR2`` (or ``POST /metrics/probes``) toggles
+  it and ``GET /metrics/probes`` reads it.
+
+Separately, ``perf_map`` turns on CPython's perf trampoline (3.12+), which
+writes ``/tmp/perf-<pid>.map`` so ``perf top``/``perf record`` attribute
+samples to Python functions instead of one opaque interpreter loop.
+"""
+
+from __future__ import annotations
+
+import signal
+import sys
+import threading
+import time
+from collections import Counter, deque
+from typing import Any
+
+import structlog
+
+logger = structlog.get_logger(__name__)
+
+PROVIDER = "meetmind"
+RECORDER_CAPACITY = 4096
+USDT_POLL_SECONDS = 1.0
+
+ProbeArg = int | str
+
+
+class Probe:
+    """One named tracepoint with a fixed argument signature."""
+
+    __slots__ = ("_usdt", "args", "enabled", "name")
+
+    def __init__(self, name: str, args: dict[str, type[int] | type[str]]) -> None:
+        """Initialize a probe (use :func:`define`).
+
+        Args:
+            name: Probe name as seen by tracers.
+            args: Argument names → ``int`` or ``str``, in firing order.
+        """
+        self.name = name
+        self.args = args
+        self.enabled = False
+        self._usdt: Any = None
+
+    def fire(self, *values: ProbeArg) -> None:
+        """Emit the probe (call only when ``enabled``)."""
+        if _attached(self):
+            self._usdt.fire(*(v.encode() if isinstance(v, str) else v for v in values))
+        if recorder.active:
+            recorder.append(self.name, values)
+
+
+_probes: dict[str, Probe] = {}
+_provider: Any = None  # the loaded USDT provider, kept alive for the process
+
+
+def define(name: str, **args: type[int] | type[str]) -> Probe:
+    """Declare a probe in the catalogue."""
+    probe = Probe(name, args)
+    _probes[name] = probe
+    return probe
+
+
+# ─── Catalogue ──────────────────────────────────────────────────
+
+SEGMENTS_INGESTED = define("segments_ingested", meeting=str, segments=int)
+BATCH_FORMED = define("batch_formed", meeting=str, chars=int)
+STAGE_DONE = define("stage_done", stage=str, duration_us=int)
+EVENT_ENQUEUE = define("event_enqueue", user=str, depth=int, dropped=int)
+EVENT_DEQUEUE = define("event_dequeue", user=str, wait_us=int)
+CACHE_HIT = define("cache_hit", cache=str)
+CACHE_MISS = define("cache_miss", cache=str)
+DB_FLUSH = define("db_flush", table=str, rows=int)
+LOG_FLUSH = define("log_flush", events=int)
+
+
+# ─── Recorder ───────────────────────────────────────────────────
+
+
+class Recorder:
+    """Ring buffer of recent probe firings plus per-probe counts."""
+
+    def __init__(self, capacity: int = RECORDER_CAPACITY) -> None:
+        """Initialize a stopped recorder."""
+        self.active = False
+        self.started_at: float | None = None
+        self._ring: deque[tuple[int, str, tuple[ProbeArg, ...]]] = deque(maxlen=capacity)
+        self._counts: Counter[str] = Counter()
+
+    def append(self, name: str, values: tuple[ProbeArg, ...]) -> None:
+        """Record one firing."""
+        self._ring.append((time.time_ns(), name, values))
+        self._counts[name] += 1
+
+    def start(self) -> None:
+        """Start recording (clears the previous capture)."""
+        self._ring.clear()
+        self._counts.clear()
+        self.started_at = time.time()
+        self.active = True
+        _refresh()
+
+    def stop(self) -> None:
+        """Stop recording; the capture stays readable."""
+        self.active = False
+        _refresh()
+
+    def snapshot(self, limit: int = 200) -> dict[str, Any]:
+        """Counts and the most recent firings, newest last."""
+        recent = list(self._ring)[-limit:] if limit > 0 else []
+        return {
+            "recording": self.active,
+            "started_at": self.started_at,
+            "counts": dict(self._counts),
+            "recent": [
+                {"t_ns": t, "probe": name, **dict(zip(_probes[name].args, values, strict=False))}
+                for t, name, values in recent
+            ],
+        }
+
+
+recorder = Recorder()
+
+
+def _attached(probe: Probe) -> bool:
+    """Whether a tracer is attached to the probe's USDT semaphore."""
+    if probe._usdt is None:
+        return False
+    state = probe._usdt.is_enabled  # a property or a method, by stapsdt version
+    return bool(state() if callable(state) else state)
+
+
+def _refresh() -> None:
+    """Recompute every probe's ``enabled`` flag."""
+    for probe in _probes.values():
+        probe.enabled = recorder.active or _attached(probe)
+
+
+def _watch_usdt() -> None:
+    """Keep ``enabled`` in step with tracers attaching and detaching."""
+    while _provider is not None:
+        _refresh()
+        time.sleep(USDT_POLL_SECONDS)
+
+
+# ─── Setup ──────────────────────────────────────────────────────
+
+
+def load_usdt() -> bool:
+    """Register the catalogue as USDT probes if ``stapsdt`` is installed.
+
+    Returns:
+        True if the probes are live for external tracers.
+    """
+    global _provider
+    try:
+        import stapsdt  # type: ignore[import-not-found]
+    except ImportError:
+        return False
+    try:
+        provider = stapsdt.Provider(PROVIDER)
+        pending = {
+            name: provider.add_probe(
+                name,
+                *(
+                    stapsdt.ArgTypes.uint64 if kind is str else stapsdt.ArgTypes.int64
+                    for kind in probe.args.values()
+                ),
+            )
+            for name, probe in _probes.items()
+        }
+        provider.load()
+    except Exception as e:  # a broken libstapsdt must not stop startup
+        logger.warning("usdt_load_failed", error=str(e))
+        return False
+    for name, usdt in pending.items():
+        _probes[name]._usdt = usdt
+    _provider = provider
+    _refresh()
+    threading.Thread(target=_watch_usdt, name="usdt-watch", daemon=True).start()
+    return True
+
+
+def enable_perf_map() -> bool:
+    """Turn on the interpreter's perf map (``/tmp/perf-<pid>.map``).
+
+    Returns:
+        True if the trampoline is active (needs CPython 3.12+ on Linux).
+    """
+    activate = getattr(sys, "activate_stack_trampoline", None)
+    if activate is None:
+        return False
+    try:
+        activate("perf")
+    except ValueError as e:
+        logger.warning("perf_map_unavailable", error=str(e))
+        return False
+    return True
+
+
+def install(record: bool = False, perf_map: bool = False) -> dict[str, Any]:
+    """Wire up probes at startup.
+
+    Args:
+        record: Start the in-process recorder immediately.
+        perf_map: Enable the perf trampoline.
+
+    Returns:
+        What got enabled, for the startup log.
+    """
+    usdt = load_usdt()
+    if hasattr(signal, "SIGUSR2") and threading.current_thread() is threading.main_thread():
+        signal.signal(signal.SIGUSR2, _toggle_recorder)
+    if record:
+        recorder.start()
+    return {
+        "probes": len(_probes),
+        "usdt": usdt,
+        "recording": recorder.active,
+        "perf_map": enable_perf_map() if perf_map else False,
+    }
+
+
+def _toggle_recorder(signum: int, frame: object) -> None:
+    """SIGUSR2: start or stop the recorder."""
+    if recorder.active:
+        recorder.stop()
+    else:
+        recorder.start()
+
+
+def catalogue() -> dict[str, list[str]]:
+    """Probe names and their argument names."""
+    return {name: list(probe.args) for name, probe in _probes.items()}
@@ -0,0 +1,100 @@
+"""Readiness — per-component startup state for liveness/readiness probes.
+
+Startup is split in two phases. The process is *live* as soon as uvicorn
+accepts connections; components (database pool, schema, AI agents) come up
+in a background warm-up task and report here. ``/health`` shows each
+component, ``/health/ready`` answers 503 until the required ones are up.
+"""
+
+from __future__ import annotations
+
+import time
+from dataclasses import dataclass, field
+
+import structlog
+
+logger = structlog.get_logger(__name__)
+
+PENDING = "pending"
+READY = "ready"
+FAILED = "failed"
+
+
+@dataclass
+class ComponentState:
+    """Startup state of one component."""
+
+    status: str = PENDING
+    error: str | None = None
+    started_at: float = field(default_factory=time.monotonic)
+    elapsed_ms: float | None = None
+
+    def to_dict(self) -> dict[str, object]:
+        """Convert to dictionary for the health endpoint."""
+        result: dict[str, object] = {"status": self.status}
+        if self.elapsed_ms is not None:
+            result["elapsed_ms"] = self.elapsed_ms
+        if self.error:
+            result["error"] = self.error
+        return result
+
+
+class Readiness:
+    """Tracks which components are up.
+
+    Components are registered as required (traffic waits for them) or
+    optional (reported, but the instance serves without them — e.g. AI
+    agents, whose endpoints already degrade gracefully).
+    """
+
+    def __init__(self) -> None:
+        """Initialize with no components."""
+        self._components: dict[str, ComponentState] = {}
+        self._required: set[str] = set()
+        self._created = time.monotonic()
+
+    def register(self, name: str, *, required: bool = True) -> None:
+        """Register a component as pending (resets its state)."""
+        self._components[name] = ComponentState()
+        if required:
+            self._required.add(name)
+        else:
+            self._required.discard(name)
+
+    def mark_ready(self, name: str) -> None:
+        """Mark a component as up."""
+        self._finish(name, READY, None)
+        logger.info("component_ready", component=name, elapsed_ms=self._components[name].elapsed_ms)
+
+    def mark_failed(self, name: str, error: str) -> None:
+        """Mark a component as failed (it may be retried and marked ready later)."""
+        self._finish(name, FAILED, error)
+        logger.warning("component_failed", component=name, error=error)
+
+    def _finish(self, name: str, status: str, error: str | None) -> None:
+        state = self._components.setdefault(name, ComponentState())
+        state.status = status
+        state.error = error
+        state.elapsed_ms = round((time.monotonic() - state.started_at) * 1000, 1)
+
+    def status(self, name: str) -> str | None:
+        """Status of a component, or None if unregistered."""
+        state = self._components.get(name)
+        return state.status if state else None
+
+    @property
+    def ready(self) -> bool:
+        """Whether every required component is up."""
+        return all(self._components[n].status == READY for n in self._required)
+
+    def to_dict(self) -> dict[str, object]:
+        """Snapshot for the health endpoints."""
+        return {
+            "ready": self.ready,
+            "uptime_s": round(time.monotonic() - self._created, 1),
+            "components": {n: s.to_dict() for n, s in self._components.items()},
+        }
+
+
+# Global instance (one per process)
+readiness = Readiness()
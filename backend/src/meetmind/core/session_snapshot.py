@@ -0,0 +1,73 @@
+"""Session snapshots — hand live meeting state from one process to the next.
+
+On shutdown (deploy, scale-in) the draining process serializes each active
+session — transcript, unscreened buffer, screening clock, cost counters —
+into a compact snapshot stored in Postgres. The next process that sees a
+request for that meeting claims the snapshot and resumes exactly where the
+old one stopped: nothing is lost and nothing already screened is sent to
+the screening model again.
+
+Snapshots are zlib-compressed JSON with a format version; a snapshot the
+current code can't read is dropped and the session starts fresh.
+"""
+
+from __future__ import annotations
+
+import json
+import zlib
+from dataclasses import dataclass
+from typing import Any
+
+from meetmind.core.transcript import TranscriptManager
+from meetmind.utils.cost_tracker import CostTracker
+
+SNAPSHOT_VERSION = 1
+
+
+class SnapshotError(ValueError):
+    """Raised for snapshots that are corrupt or from an unknown format."""
+
+
+@dataclass
+class SessionSnapshot:
+    """In-memory state of one meeting session."""
+
+    transcript: TranscriptManager
+    tracker: CostTracker
+    language: str
+    owner: str | None
+
+
+def encode(session: SessionSnapshot) -> bytes:
+    """Serialize a session into a compressed snapshot."""
+    payload: dict[str, Any] = {
+        "v": SNAPSHOT_VERSION,
+        "language": session.language,
+        "owner": session.owner,
+        "transcript": session.transcript.export_state(),
+        "cost": session.tracker.export_state(),
+    }
+    return zlib.compress(json.dumps(payload, separators=(",", ":")).encode(), 6)
+
+
+def decode(data: bytes) -> SessionSnapshot:
+    """Rebuild a session from :func:`encode` output.
+
+    Raises:
+        SnapshotError: If the snapshot is corrupt or from another format version.
+    """
+    try:
+        payload = json.loads(zlib.decompress(data))
+    except (zlib.error, ValueError) as e:
+        raise SnapshotError(f"Corrupt snapshot: {e}") from e
+    if not isinstance(payload, dict) or payload.get("v") != SNAPSHOT_VERSION:
+        raise SnapshotError("Unsupported snapshot version")
+    try:
+        return SessionSnapshot(
+            transcript=TranscriptManager.from_state(payload["transcript"]),
+            tracker=CostTracker.from_state(payload["cost"]),
+            language=str(payload["language"]),
+            owner=payload.get("owner"),
+        )
+    except (KeyError, TypeError, ValueError) as e:
+        raise SnapshotError(f"Malformed snapshot: {e}") from e
@@ -13,38 +13,54 @@ Schema supports:
 
 from __future__ import annotations
 
+import asyncio
 import json
 import time
-from typing import Any
+from typing import TYPE_CHECKING, Any
 
 import asyncpg  # type: ignore[import-untyped]
 import structlog
 
 from meetmind.config.settings import settings
+from meetmind.core import probes
+
+if TYPE_CHECKING:
+    from collections.abc import AsyncIterator
 
 logger = structlog.get_logger(__name__)
 
 # ─── Connection Pool ──────────────────────────────────────────────
 
 _pool: asyncpg.Pool | None = None
+_init_lock = asyncio.Lock()  # startup warm-up and lazy get_pool() share one pool
 
 
 async def init_db() -> None:
-    """Initialize connection pool and create schema."""
+    """Initialize connection pool and migrate the schema if needed."""
+    await open_pool()
+    await migrate()
+
+
+async def open_pool() -> None:
+    """Create the connection pool (no-op if already open)."""
     global _pool
-    dsn = settings.database_url
-    _pool = await asyncpg.create_pool(
-        dsn,
-        min_size=2,
-        max_size=10,
-        command_timeout=30,
-        timeout=5,  # fail fast if DB unreachable (prevents lifespan hang)
-    )
+    async with _init_lock:
+        if _pool is not None:
+            return
+        dsn = settings.database_url
+        _pool = await asyncpg.create_pool(
+            dsn,
+            min_size=2,
+            max_size=10,
+            command_timeout=30,
+            timeout=5,  # fail fast if DB unreachable
+        )
     logger.info("db_pool_created", dsn=dsn.split("@")[-1])  # log host only
 
-    async with _pool.acquire() as conn:
-        await _create_schema(conn)
-    logger.info("db_schema_ready")
+
+def pool_ready() -> bool:
+    """Whether the connection pool is open (never blocks)."""
+    return _pool is not None
 
 
 async def close_db() -> None:
@@ -65,6 +81,57 @@ async def get_pool() -> asyncpg.Pool:
 
 # ─── Schema ───────────────────────────────────────────────────────
 
+# Bump whenever _create_schema changes; instances skip the DDL otherwise.
+SCHEMA_VERSION = 5
+_MIGRATION_LOCK_ID = 0x4D4D5343  # pg advisory lock key ("MMSC")
+_CHANGE_LOCK_CLASS = 0x4D4D4348  # two-key advisory locks per user ("MMCH")
+
+
+async def _schema_version(conn: asyncpg.Connection) -> int:
+    """Applied schema version (0 for databases that predate versioning)."""
+    # Checked with to_regclass, not by catching the error: a failed query
+    # would abort the migration transaction this also runs in.
+    if not await conn.fetchval("SELECT to_regclass('schema_version') IS NOT NULL"):
+        return 0
+    version = await conn.fetchval("SELECT version FROM schema_version")
+    return int(version or 0)
+
+
+async def migrate() -> bool:
+    """Bring the schema up to :data:`SCHEMA_VERSION`.
+
+    A current database costs one single-row SELECT. Otherwise the DDL runs
+    in a transaction under an advisory lock, so instances starting together
+    don't migrate concurrently.
+
+    Returns:
+        True if the DDL ran, False if the schema was already current.
+    """
+    pool = _pool
+    if pool is None:
+        await open_pool()
+        pool = _pool
+    async with pool.acquire() as conn:
+        if await _schema_version(conn) >= SCHEMA_VERSION:
+            logger.info("db_schema_current", version=SCHEMA_VERSION)
+            return False
+
+        async with conn.transaction():
+            await conn.execute("SELECT pg_advisory_xact_lock($1)", _MIGRATION_LOCK_ID)
+            current = await _schema_version(conn)
+            if current >= SCHEMA_VERSION:
+                return False  # another instance got here first
+            await _create_schema(conn)
+            await conn.execute(
+                """
+                INSERT INTO schema_version (id, version) VALUES (TRUE, $1)
+                ON CONFLICT (id) DO UPDATE SET version = $1, applied_at = NOW()
+                """,
+                SCHEMA_VERSION,
+            )
+    logger.info("db_schema_migrated", from_version=current, to_version=SCHEMA_VERSION)
+    return True
+
 
 async def _create_schema(conn: asyncpg.Connection) -> None:
     """Create tables if they don't exist."""
@@ -175,15 +242,165 @@ async def _create_schema(conn: asyncpg.Connection) -> None:
         CREATE INDEX IF NOT EXISTS idx_meetings_user
             ON meetings(user_id, started_at DESC);
 
+        -- Snapshot sync pages a user's meetings by ID
+        CREATE INDEX IF NOT EXISTS idx_meetings_user_id
+            ON meetings(user_id, id);
+
         -- Migration: add user_id to existing meetings if not present
         DO $$ BEGIN
             ALTER TABLE meetings ADD COLUMN IF NOT EXISTS
                 user_id TEXT REFERENCES users(id) ON DELETE CASCADE;
         EXCEPTION WHEN duplicate_column THEN NULL;
         END $$;
+
+        -- Delta sync: meeting versions + compacted per-user change log
+        -- (one row per meeting, deletes kept as tombstones)
+        CREATE SEQUENCE IF NOT EXISTS meeting_version_seq;
+
+        -- Idempotent ingest: the client's per-meeting segment ID, so a
+        -- batch resent after a lost acknowledgement isn't stored twice
+        ALTER TABLE transcript_segments ADD COLUMN IF NOT EXISTS client_seq BIGINT;
+
+        CREATE UNIQUE INDEX IF NOT EXISTS idx_segments_client_seq
+            ON transcript_segments(meeting_id, client_seq)
+            WHERE client_seq IS NOT NULL;
+
+        ALTER TABLE meetings ADD COLUMN IF NOT EXISTS version BIGINT NOT NULL DEFAULT 0;
+
+        CREATE TABLE IF NOT EXISTS meeting_changes (
+            meeting_id      TEXT PRIMARY KEY,
+            user_id         TEXT NOT NULL REFERENCES users(id) ON DELETE CASCADE,
+            version         BIGINT NOT NULL,
+            deleted         BOOLEAN NOT NULL DEFAULT FALSE,
+            changed_at      TIMESTAMPTZ NOT NULL DEFAULT NOW()
+        );
+
+        CREATE INDEX IF NOT EXISTS idx_meeting_changes_user
+            ON meeting_changes(user_id, version);
+
+        -- Live session state handed from a draining process to its successor
+        CREATE TABLE IF NOT EXISTS session_snapshots (
+            meeting_id      TEXT PRIMARY KEY REFERENCES meetings(id) ON DELETE CASCADE,
+            data            BYTEA NOT NULL,
+            created_at      TIMESTAMPTZ NOT NULL DEFAULT NOW()
+        );
+
+        -- Per-user monthly usage for server-side quotas (core.usage)
+        CREATE TABLE IF NOT EXISTS usage_counters (
+            user_id         TEXT NOT NULL REFERENCES users(id) ON DELETE CASCADE,
+            month           TEXT NOT NULL,
+            minutes         DOUBLE PRECISION NOT NULL DEFAULT 0,
+            llm_usd         DOUBLE PRECISION NOT NULL DEFAULT 0,
+            summaries       INTEGER NOT NULL DEFAULT 0,
+            updated_at      TIMESTAMPTZ NOT NULL DEFAULT NOW(),
+            PRIMARY KEY (month, user_id)
+        );
+
+        CREATE TABLE IF NOT EXISTS schema_version (
+            id              BOOLEAN PRIMARY KEY DEFAULT TRUE CHECK (id),
+            version         INTEGER NOT NULL,
+            applied_at      TIMESTAMPTZ NOT NULL DEFAULT NOW()
+        );
     """)
 
 
+# ─── Change Log ──────────────────────────────────────────────────
+
+
+# Meetings whose transcript or insights changed since the last flush_changes()
+_pending_changes: set[str] = set()
+
+
+async def _record_change(conn: asyncpg.Connection, meeting_id: str) -> None:
+    """Bump a meeting's version and log it for delta sync.
+
+    Called after writes that change what ``get_meeting`` returns; the
+    frequent ones (segments, insights, costs) go through
+    :func:`mark_changed` instead and are bumped once per flush.
+    """
+    _pending_changes.discard(meeting_id)  # this bump covers them
+    await _record_changes(conn, [meeting_id])
+
+
+async def _record_changes(conn: asyncpg.Connection, meeting_ids: list[str]) -> None:
+    """Bump several meetings' versions in one transaction.
+
+    Versions come from one global sequence, and a client cursor is the
+    highest version it has seen — so a version must not become visible
+    before a lower one of the same user. Each owner's versions are drawn
+    under a transaction advisory lock held until commit, which makes a
+    user's versions commit in order: a sync can't return version N while
+    N-1 is still in flight and then miss it.
+    """
+    async with conn.transaction():
+        # Lock in hash order so concurrent flushes can't deadlock
+        await conn.execute(
+            """
+            SELECT pg_advisory_xact_lock($2, h)
+            FROM (
+                SELECT DISTINCT hashtext(user_id) AS h
+                FROM meetings
+                WHERE id = ANY($1::text[]) AND user_id IS NOT NULL
+                ORDER BY h
+            ) owners
+            """,
+            meeting_ids,
+            _CHANGE_LOCK_CLASS,
+        )
+        await conn.execute(
+            """
+            WITH bumped AS (
+                UPDATE meetings
+                SET version = nextval('meeting_version_seq'), updated_at = NOW()
+                WHERE id = ANY($1::text[])
+                RETURNING id, user_id, version
+            )
+            INSERT INTO meeting_changes (meeting_id, user_id, version, deleted)
+            SELECT id, user_id, version, FALSE FROM bumped WHERE user_id IS NOT NULL
+            ON CONFLICT (meeting_id) DO UPDATE
+                SET version = EXCLUDED.version, deleted = FALSE, changed_at = NOW()
+            """,
+            meeting_ids,
+        )
+
+
+def mark_changed(meeting_id: str) -> None:
+    """Queue a version bump for the next :func:`flush_changes`.
+
+    A live meeting is written every few seconds (segments, insights,
+    costs); bumping on each write would add an upsert to every one.
+    """
+    _pending_changes.add(meeting_id)
+
+
+async def flush_changes() -> int:
+    """Bump every meeting marked since the last flush, in one transaction.
+
+    Returns:
+        Number of meetings bumped.
+    """
+    if not _pending_changes:
+        return 0
+    meeting_ids = sorted(_pending_changes)
+    _pending_changes.clear()
+    try:
+        pool = await get_pool()
+        async with pool.acquire() as conn:
+            await _record_changes(conn, meeting_ids)
+    except Exception as e:
+        _pending_changes.update(meeting_ids)  # retried next flush
+        logger.warning("change_flush_failed", meetings=len(meeting_ids), error=str(e))
+        return 0
+    return len(meeting_ids)
+
+
+async def run_change_flush(interval: float) -> None:
+    """Flush every ``interval`` seconds until cancelled."""
+    while True:
+        await asyncio.sleep(interval)
+        await flush_changes()
+
+
 # ─── Meetings CRUD ───────────────────────────────────────────────
 
 
@@ -206,6 +423,8 @@ async def create_meeting(
             language,
             user_id,
         )
+        if row:
+            await _record_change(conn, meeting_id)
     logger.info("meeting_created", meeting_id=meeting_id, user_id=user_id)
     return dict(row) if row else {}
 
@@ -251,10 +470,41 @@ async def end_meeting(
             seg_count,
             insight_count,
         )
+        if row:
+            await _record_change(conn, meeting_id)
     logger.info("meeting_ended", meeting_id=meeting_id, segments=seg_count)
     return dict(row) if row else {}
 
 
+async def add_meeting_costs(deltas: list[tuple[str, float]]) -> int:
+    """Add newly ledgered cost to each meeting's ``cost_usd``.
+
+    Increments rather than overwrites, so several instances (and a
+    resumed session) all contribute. Cost moves every ledger flush while
+    a meeting is live, so the sync version is bumped through
+    :func:`mark_changed` (once per change flush), not per update.
+
+    Args:
+        deltas: (meeting_id, USD since the last rollup) pairs.
+
+    Returns:
+        Number of meetings updated.
+    """
+    if not deltas:
+        return 0
+    pool = await get_pool()
+    async with pool.acquire() as conn:
+        await conn.executemany(
+            "UPDATE meetings SET cost_usd = COALESCE(cost_usd, 0) + $2 WHERE id = $1",
+            deltas,
+        )
+    for meeting_id, _ in deltas:
+        mark_changed(meeting_id)
+    if probes.DB_FLUSH.enabled:
+        probes.DB_FLUSH.fire("meetings.cost_usd", len(deltas))
+    return len(deltas)
+
+
 async def list_meetings(
     limit: int = 50,
     offset: int = 0,
@@ -292,26 +542,145 @@ async def list_meetings(
     return [dict(r) for r in rows]
 
 
-async def get_meeting(meeting_id: str) -> dict[str, Any] | None:
-    """Get a single meeting with all its data."""
+async def get_meeting_version(meeting_id: str) -> dict[str, Any] | None:
+    """Get a meeting's owner and version without loading its data.
+
+    Lets the detail endpoint answer ``If-None-Match`` with a 304 before
+    fetching or serializing anything.
+    """
     pool = await get_pool()
     async with pool.acquire() as conn:
-        meeting = await conn.fetchrow(
-            "SELECT * FROM meetings WHERE id = $1",
+        row = await conn.fetchrow(
+            "SELECT user_id, version FROM meetings WHERE id = $1",
             meeting_id,
         )
-        if not meeting:
-            return None
+    return dict(row) if row else None
+
 
-        segments = await conn.fetch(
+async def sync_meetings(
+    user_id: str,
+    since: int = 0,
+    limit: int = 200,
+    after: str | None = None,
+) -> dict[str, Any]:
+    """Get a user's meeting changes after a client cursor.
+
+    A client without a cursor gets a full snapshot instead, paged by
+    meeting ID: each page carries the change-log cursor read before the
+    first one plus an ``after`` key, and the client sends both back
+    (``since=cursor&after=...``) for the next page. Anything written while
+    the snapshot is paged has a higher version and comes in the first
+    delta sync after it.
+
+    Args:
+        user_id: Owner of the meetings.
+        since: Highest version the client has seen; 0 for a snapshot.
+        limit: Maximum changes per page.
+        after: Last meeting ID of the previous snapshot page; continues a
+            snapshot taken at ``since``.
+
+    Returns:
+        ``{"cursor", "meetings", "deleted", "has_more"}`` — changed meetings
+        as list rows (with ``version``), IDs of deleted meetings, and the
+        cursor to send next time. Snapshot pages add ``after``.
+    """
+    pool = await get_pool()
+    async with pool.acquire() as conn:
+        if since <= 0 or after is not None:
+            if after is None:
+                # Read the cursor first: anything written meanwhile is
+                # re-sent on the next sync rather than missed.
+                since = await conn.fetchval(
+                    "SELECT COALESCE(MAX(version), 0) FROM meeting_changes WHERE user_id = $1",
+                    user_id,
+                )
+            rows = await conn.fetch(
+                """
+                SELECT id, title, language, status, started_at, ended_at,
+                       duration_secs, total_segments, total_insights, cost_usd, version
+                FROM meetings
+                WHERE user_id = $1 AND ($2::text IS NULL OR id > $2)
+                ORDER BY id
+                LIMIT $3
+                """,
+                user_id,
+                after,
+                limit,
+            )
+            has_more = len(rows) == limit
+            return {
+                "cursor": since,
+                "meetings": [dict(r) for r in rows],
+                "deleted": [],
+                "has_more": has_more,
+                "after": rows[-1]["id"] if has_more else None,
+            }
+
+        rows = await conn.fetch(
             """
-            SELECT speaker, text, timestamp_unix, segment_index
-            FROM transcript_segments
-            WHERE meeting_id = $1
-            ORDER BY segment_index
+            SELECT c.meeting_id, c.version, c.deleted,
+                   m.title, m.language, m.status, m.started_at, m.ended_at,
+                   m.duration_secs, m.total_segments, m.total_insights, m.cost_usd
+            FROM meeting_changes c
+            LEFT JOIN meetings m ON m.id = c.meeting_id
+            WHERE c.user_id = $1 AND c.version > $2
+            ORDER BY c.version
+            LIMIT $3
             """,
+            user_id,
+            since,
+            limit,
+        )
+
+    meetings: list[dict[str, Any]] = []
+    deleted: list[str] = []
+    for r in rows:
+        row = dict(r)
+        meeting_id = row.pop("meeting_id")
+        if row.pop("deleted") or row["title"] is None:
+            deleted.append(meeting_id)
+        else:
+            meetings.append({"id": meeting_id, **row})
+    return {
+        "cursor": rows[-1]["version"] if rows else since,
+        "meetings": meetings,
+        "deleted": deleted,
+        "has_more": len(rows) == limit,
+    }
+
+
+async def get_meeting(
+    meeting_id: str,
+    *,
+    include_segments: bool = True,
+) -> dict[str, Any] | None:
+    """Get a single meeting with all its data.
+
+    Args:
+        meeting_id: Meeting identifier.
+        include_segments: Load the full transcript. Streaming readers pass
+            False and use :func:`iter_segments` instead.
+    """
+    pool = await get_pool()
+    async with pool.acquire() as conn:
+        meeting = await conn.fetchrow(
+            "SELECT * FROM meetings WHERE id = $1",
             meeting_id,
         )
+        if not meeting:
+            return None
+
+        segments = []
+        if include_segments:
+            segments = await conn.fetch(
+                """
+                SELECT speaker, text, timestamp_unix, segment_index
+                FROM transcript_segments
+                WHERE meeting_id = $1
+                ORDER BY segment_index
+                """,
+                meeting_id,
+            )
 
         insights_rows = await conn.fetch(
             """
@@ -354,54 +723,325 @@ async def get_meeting(meeting_id: str) -> dict[str, Any] | None:
     return result
 
 
+# Any character above U+00FF (the only ones WinAnsi fonts may lack)
+_BEYOND_LATIN1 = "[^\x01-\xff]"
+
+
+async def iter_segments(
+    meeting_id: str,
+    batch_size: int = 500,
+    *,
+    beyond_latin1: bool = False,
+) -> AsyncIterator[dict[str, Any]]:
+    """Stream a meeting's transcript segments in order.
+
+    Reads keyset pages (``segment_index > last``) and gives the
+    connection back to the pool between pages, so a slow consumer (a
+    PDF download) holds at most ``batch_size`` rows and no connection.
+
+    Args:
+        meeting_id: Meeting identifier.
+        batch_size: Rows fetched per round trip.
+        beyond_latin1: Only segments whose text or speaker has a
+            character above U+00FF (a cheap pre-filter for font checks).
+
+    Yields:
+        Segment dicts (speaker, text, timestamp_unix, segment_index).
+    """
+    pool = await get_pool()
+    pattern = _BEYOND_LATIN1 if beyond_latin1 else None
+    last = -1
+    while True:
+        async with pool.acquire() as conn:
+            rows = await conn.fetch(
+                """
+                SELECT speaker, text, timestamp_unix, segment_index
+                FROM transcript_segments
+                WHERE meeting_id = $1 AND segment_index > $2
+                  AND ($4::text IS NULL OR text ~ $4 OR COALESCE(speaker, '') ~ $4)
+                ORDER BY segment_index
+                LIMIT $3
+                """,
+                meeting_id,
+                last,
+                batch_size,
+                pattern,
+            )
+        for row in rows:
+            yield dict(row)
+        if len(rows) < batch_size:
+            return
+        last = rows[-1]["segment_index"]
+
+
 async def delete_meeting(meeting_id: str) -> bool:
     """Delete a meeting and all related data (cascades)."""
     pool = await get_pool()
-    async with pool.acquire() as conn:
-        result = await conn.execute(
-            "DELETE FROM meetings WHERE id = $1",
+    async with pool.acquire() as conn, conn.transaction():
+        row = await conn.fetchrow(
+            "DELETE FROM meetings WHERE id = $1 RETURNING user_id",
             meeting_id,
         )
-    deleted: bool = result == "DELETE 1"
+        if row and row["user_id"]:
+            # Tombstone so other devices drop it on their next sync (its
+            # version drawn in commit order, as in _record_changes)
+            await conn.execute(
+                "SELECT pg_advisory_xact_lock($1, hashtext($2))",
+                _CHANGE_LOCK_CLASS,
+                row["user_id"],
+            )
+            await conn.execute(
+                """
+                INSERT INTO meeting_changes (meeting_id, user_id, version, deleted)
+                VALUES ($1, $2, nextval('meeting_version_seq'), TRUE)
+                ON CONFLICT (meeting_id) DO UPDATE
+                    SET version = EXCLUDED.version, deleted = TRUE, changed_at = NOW()
+                """,
+                meeting_id,
+                row["user_id"],
+            )
+    _pending_changes.discard(meeting_id)
+    deleted = row is not None
     if deleted:
         logger.info("meeting_deleted", meeting_id=meeting_id)
     return deleted
 
 
+# ─── Usage Counters ──────────────────────────────────────────────
+
+
+async def load_usage(
+    month: str, user_id: str | None = None
+) -> list[tuple[str, str, float, float, int]]:
+    """Usage so far in a month, with each user's subscription tier.
+
+    Args:
+        month: ``YYYY-MM`` (UTC).
+        user_id: One user (a row even with no usage yet); None for every
+            user with usage this month.
+
+    Returns:
+        (user_id, tier, minutes, llm_usd, summaries) rows.
+    """
+    pool = await get_pool()
+    async with pool.acquire() as conn:
+        if user_id is None:
+            rows = await conn.fetch(
+                """
+                SELECT u.id, u.subscription_tier, c.minutes, c.llm_usd, c.summaries
+                FROM usage_counters c JOIN users u ON u.id = c.user_id
+                WHERE c.month = $1
+                """,
+                month,
+            )
+        else:
+            rows = await conn.fetch(
+                """
+                SELECT u.id, u.subscription_tier, COALESCE(c.minutes, 0),
+                       COALESCE(c.llm_usd, 0), COALESCE(c.summaries, 0)
+                FROM users u
+                LEFT JOIN usage_counters c ON c.user_id = u.id AND c.month = $1
+                WHERE u.id = $2
+                """,
+                month,
+                user_id,
+            )
+    return [tuple(row) for row in rows]
+
+
+async def add_usage(
+    month: str, deltas: list[tuple[str, float, float, int]]
+) -> list[tuple[str, str, float, float, int]]:
+    """Add usage increments and read back the month's totals.
+
+    Increments (rather than overwrites) so every instance contributes;
+    the returned totals include the other instances' usage. Deltas for
+    users that no longer exist are dropped.
+
+    Args:
+        month: ``YYYY-MM`` (UTC).
+        deltas: (user_id, minutes, llm_usd, summaries) increments.
+
+    Returns:
+        (user_id, tier, minutes, llm_usd, summaries) totals for those users.
+    """
+    if not deltas:
+        return []
+    users, minutes, llm_usd, summaries = (list(col) for col in zip(*deltas, strict=True))
+    pool = await get_pool()
+    async with pool.acquire() as conn:
+        rows = await conn.fetch(
+            """
+            WITH added AS (
+                INSERT INTO usage_counters (user_id, month, minutes, llm_usd, summaries)
+                SELECT d.user_id, $1, d.minutes, d.llm_usd, d.summaries
+                FROM unnest($2::text[], $3::float8[], $4::float8[], $5::int[])
+                    AS d(user_id, minutes, llm_usd, summaries)
+                JOIN users ON users.id = d.user_id
+                ON CONFLICT (month, user_id) DO UPDATE
+                    SET minutes = usage_counters.minutes + EXCLUDED.minutes,
+                        llm_usd = usage_counters.llm_usd + EXCLUDED.llm_usd,
+                        summaries = usage_counters.summaries + EXCLUDED.summaries,
+                        updated_at = NOW()
+                RETURNING user_id, minutes, llm_usd, summaries
+            )
+            SELECT a.user_id, u.subscription_tier, a.minutes, a.llm_usd, a.summaries
+            FROM added a JOIN users u ON u.id = a.user_id
+            """,
+            month,
+            users,
+            minutes,
+            llm_usd,
+            summaries,
+        )
+    if probes.DB_FLUSH.enabled:
+        probes.DB_FLUSH.fire("usage_counters", len(deltas))
+    return [tuple(row) for row in rows]
+
+
+# ─── Session Snapshots ───────────────────────────────────────────
+
+# Snapshots older than this belong to meetings nobody resumed
+SNAPSHOT_MAX_AGE_HOURS = 6
+
+
+async def save_session_snapshots(snapshots: list[tuple[str, bytes]]) -> int:
+    """Store live-session snapshots (one per meeting) for the next process.
+
+    Args:
+        snapshots: (meeting_id, encoded snapshot) pairs.
+
+    Returns:
+        Number of snapshots written.
+    """
+    if not snapshots:
+        return 0
+    pool = await get_pool()
+    async with pool.acquire() as conn:
+        await conn.executemany(
+            """
+            INSERT INTO session_snapshots (meeting_id, data) VALUES ($1, $2)
+            ON CONFLICT (meeting_id) DO UPDATE
+                SET data = EXCLUDED.data, created_at = NOW()
+            """,
+            snapshots,
+        )
+    if probes.DB_FLUSH.enabled:
+        probes.DB_FLUSH.fire("session_snapshots", len(snapshots))
+    return len(snapshots)
+
+
+async def take_session_snapshot(meeting_id: str) -> bytes | None:
+    """Claim and remove a meeting's snapshot (None if absent or stale).
+
+    The DELETE … RETURNING makes the claim atomic, so only one process
+    resumes a session.
+    """
+    pool = await get_pool()
+    async with pool.acquire() as conn:
+        data = await conn.fetchval(
+            """
+            DELETE FROM session_snapshots WHERE meeting_id = $1
+            RETURNING CASE
+                WHEN created_at > NOW() - make_interval(hours => $2) THEN data
+            END
+            """,
+            meeting_id,
+            SNAPSHOT_MAX_AGE_HOURS,
+        )
+    return bytes(data) if data is not None else None
+
+
+async def purge_session_snapshots() -> int:
+    """Delete snapshots nobody resumed.
+
+    Returns:
+        Number of snapshots removed.
+    """
+    pool = await get_pool()
+    async with pool.acquire() as conn:
+        result = await conn.execute(
+            "DELETE FROM session_snapshots WHERE created_at < NOW() - make_interval(hours => $1)",
+            SNAPSHOT_MAX_AGE_HOURS,
+        )
+    return int(result.split()[-1])
+
+
 # ─── Transcript Segments ─────────────────────────────────────────
 
 
 async def save_segments(
     meeting_id: str,
     segments: list[dict[str, Any]],
-) -> int:
-    """Bulk-insert transcript segments for a meeting."""
+) -> set[int]:
+    """Bulk-insert transcript segments for a meeting, at most once each.
+
+    Segments carrying the client's per-meeting ``id`` are deduplicated on
+    it (uploads are retried until acknowledged, so a batch can arrive
+    twice) and ordered by it; ``captured_at`` (epoch ms, client clock)
+    is their timestamp.
+
+    Args:
+        meeting_id: Meeting identifier.
+        segments: Segment dicts (``text``, ``speaker``, optional ``id``,
+            ``captured_at`` or ``timestamp``).
+
+    Returns:
+        Client IDs that were new. Segments without an ID are always
+        stored and not listed.
+    """
     if not segments:
-        return 0
+        return set()
+
+    now = time.time()
+    speakers: list[str] = []
+    texts: list[str] = []
+    stamps: list[float] = []
+    indexes: list[int] = []
+    seqs: list[int | None] = []
+    for idx, seg in enumerate(segments):
+        seq = int(seg["id"]) if seg.get("id") is not None else None
+        if "captured_at" in seg:
+            stamp = float(seg["captured_at"]) / 1000.0
+        else:
+            stamp = float(seg.get("timestamp", now))
+        speakers.append(str(seg.get("speaker", "unknown")))
+        texts.append(str(seg["text"]))
+        stamps.append(stamp)
+        indexes.append(seq if seq is not None else idx)
+        seqs.append(seq)
 
     pool = await get_pool()
     async with pool.acquire() as conn:
-        records = [
-            (
-                meeting_id,
-                seg.get("speaker", "unknown"),
-                seg["text"],
-                seg.get("timestamp", time.time()),
-                idx,
-            )
-            for idx, seg in enumerate(segments)
-        ]
-        await conn.executemany(
+        rows = await conn.fetch(
             """
             INSERT INTO transcript_segments
-                (meeting_id, speaker, text, timestamp_unix, segment_index)
-            VALUES ($1, $2, $3, $4, $5)
-            ON CONFLICT DO NOTHING
+                (meeting_id, speaker, text, timestamp_unix, segment_index, client_seq)
+            SELECT $1, s.speaker, s.text, s.stamp, s.idx, s.seq
+            FROM unnest($2::text[], $3::text[], $4::float8[], $5::int[], $6::bigint[])
+                AS s(speaker, text, stamp, idx, seq)
+            ON CONFLICT (meeting_id, client_seq) WHERE client_seq IS NOT NULL DO NOTHING
+            RETURNING client_seq
             """,
-            records,
+            meeting_id,
+            speakers,
+            texts,
+            stamps,
+            indexes,
+            seqs,
         )
-    logger.info("segments_saved", meeting_id=meeting_id, count=len(segments))
-    return len(segments)
+    if rows:
+        mark_changed(meeting_id)
+    stored = {row["client_seq"] for row in rows if row["client_seq"] is not None}
+    if probes.DB_FLUSH.enabled:
+        probes.DB_FLUSH.fire("transcript_segments", len(rows))
+    logger.info(
+        "segments_saved",
+        meeting_id=meeting_id,
+        count=len(rows),
+        duplicates=len(segments) - len(rows),
+    )
+    return stored
 
 
 # ─── Insights ────────────────────────────────────────────────────
@@ -431,6 +1071,9 @@ async def save_insight(
             insight.get("timestamp", time.time()),
             json.dumps(insight.get("metadata", {})),
         )
+    mark_changed(meeting_id)
+    if probes.DB_FLUSH.enabled:
+        probes.DB_FLUSH.fire("insights", 1)
     return int(row["id"]) if row else 0
 
 
@@ -484,6 +1127,7 @@ async def save_summary(
                         item.get("deadline"),
                         item.get("priority", "medium"),
                     )
+        await _record_change(conn, meeting_id)
 
     logger.info(
         "summary_saved",
@@ -503,16 +1147,19 @@ async def update_action_item(
     """Update an action item's status (pending/done)."""
     pool = await get_pool()
     async with pool.acquire() as conn:
-        result = await conn.execute(
+        meeting_id = await conn.fetchval(
             """
             UPDATE action_items
             SET status = $2, updated_at = NOW()
             WHERE id = $1
+            RETURNING meeting_id
             """,
             item_id,
             status,
         )
-    return bool(result == "UPDATE 1")
+        if meeting_id:
+            await _record_change(conn, meeting_id)
+    return meeting_id is not None
 
 
 async def get_pending_action_items(
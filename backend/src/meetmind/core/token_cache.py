@@ -0,0 +1,211 @@
+"""Verified Token Cache — bounded LRU of already-verified JWT payloads.
+
+Every authenticated request decodes the same few thousand access tokens
+over and over. Once a token's HMAC signature has been verified, its
+payload cannot change, so we keep it keyed by a digest of the raw token
+and skip PyJWT entirely until the token expires or is revoked.
+
+Revocation is tracked two ways:
+  - per token (digest blocklist, kept until the token's own ``exp``)
+  - per user ("not before" timestamp compared against the token's ``iat``)
+"""
+
+from __future__ import annotations
+
+import hashlib
+import time
+from collections import OrderedDict
+from typing import Any
+
+import structlog
+
+from meetmind.core import probes
+
+logger = structlog.get_logger(__name__)
+
+
+def token_digest(token: str) -> bytes:
+    """Compute the cache key for a raw token.
+
+    BLAKE2b-128 is collision-resistant for this use and cheaper than
+    SHA-256 on the short strings we hash here.
+
+    Args:
+        token: Encoded JWT.
+
+    Returns:
+        16-byte digest.
+    """
+    return hashlib.blake2b(token.encode(), digest_size=16).digest()
+
+
+class VerifiedTokenCache:
+    """LRU cache of verified token payloads honoring ``exp`` and revocation."""
+
+    def __init__(self, max_entries: int = 4096) -> None:
+        """Initialize the token cache.
+
+        Args:
+            max_entries: Maximum number of verified tokens kept in memory.
+        """
+        self._max_entries = max_entries
+        self._cache: OrderedDict[bytes, _TokenEntry] = OrderedDict()
+        self._revoked: dict[bytes, float] = {}  # digest → token exp
+        self._user_not_before: dict[str, float] = {}
+        self._hits = 0
+        self._misses = 0
+
+    def get(self, token: str) -> dict[str, Any] | None:
+        """Look up a previously verified token.
+
+        Args:
+            token: Encoded JWT.
+
+        Returns:
+            The verified payload, or None on miss, expiry, or revocation.
+        """
+        key = token_digest(token)
+        entry = self._cache.get(key)
+
+        if entry is None:
+            self._misses += 1
+            if probes.CACHE_MISS.enabled:
+                probes.CACHE_MISS.fire("token")
+            return None
+
+        if time.time() >= entry.exp or self._is_revoked(key, entry.payload):
+            del self._cache[key]
+            self._misses += 1
+            if probes.CACHE_MISS.enabled:
+                probes.CACHE_MISS.fire("token")
+            return None
+
+        self._cache.move_to_end(key)
+        self._hits += 1
+        if probes.CACHE_HIT.enabled:
+            probes.CACHE_HIT.fire("token")
+        return entry.payload
+
+    def put(self, token: str, payload: dict[str, Any]) -> None:
+        """Store a freshly verified token payload.
+
+        Tokens without an ``exp`` claim are never cached.
+
+        Args:
+            token: Encoded JWT.
+            payload: Claims returned by signature verification.
+        """
+        exp = payload.get("exp")
+        if not isinstance(exp, int | float):
+            return
+
+        key = token_digest(token)
+        while len(self._cache) >= self._max_entries:
+            self._cache.popitem(last=False)
+
+        self._cache[key] = _TokenEntry(payload=payload, exp=float(exp))
+
+    def is_revoked(self, token: str, payload: dict[str, Any]) -> bool:
+        """Check whether a verified token has been revoked.
+
+        Args:
+            token: Encoded JWT.
+            payload: Its verified claims.
+
+        Returns:
+            True if the token or its user's earlier tokens were revoked.
+        """
+        return self._is_revoked(token_digest(token), payload)
+
+    def _is_revoked(self, key: bytes, payload: dict[str, Any]) -> bool:
+        if key in self._revoked:
+            return True
+        not_before = self._user_not_before.get(str(payload.get("sub", "")))
+        if not_before is None:
+            return False
+        iat = payload.get("iat")
+        return not isinstance(iat, int | float) or iat < not_before
+
+    def revoke_token(self, token: str, exp: float) -> None:
+        """Revoke a single token until its natural expiry.
+
+        Args:
+            token: Encoded JWT.
+            exp: The token's ``exp`` claim (Unix seconds).
+        """
+        key = token_digest(token)
+        self._cache.pop(key, None)
+        self._purge_revoked()
+        self._revoked[key] = exp
+
+    def revoke_user(self, user_id: str) -> None:
+        """Revoke every token issued to a user before now.
+
+        Tokens issued later in the same second stay valid, so a login
+        right after a password reset is not rejected.
+
+        Args:
+            user_id: The token subject.
+        """
+        self._user_not_before[user_id] = float(int(time.time()))
+        stale = [k for k, e in self._cache.items() if e.payload.get("sub") == user_id]
+        for key in stale:
+            del self._cache[key]
+        logger.info("user_tokens_revoked", user_id=user_id, evicted=len(stale))
+
+    def _purge_revoked(self) -> None:
+        now = time.time()
+        expired = [k for k, exp in self._revoked.items() if exp <= now]
+        for key in expired:
+            del self._revoked[key]
+
+    def clear(self) -> None:
+        """Drop all cached payloads and revocations."""
+        self._cache.clear()
+        self._revoked.clear()
+        self._user_not_before.clear()
+
+    @property
+    def size(self) -> int:
+        """Current number of cached tokens."""
+        return len(self._cache)
+
+    @property
+    def hit_rate(self) -> float:
+        """Cache hit rate as percentage."""
+        total = self._hits + self._misses
+        if total == 0:
+            return 0.0
+        return round((self._hits / total) * 100, 1)
+
+    def to_dict(self) -> dict[str, Any]:
+        """Stats for monitoring.
+
+        Returns:
+            Cache statistics dictionary.
+        """
+        return {
+            "size": self.size,
+            "max_entries": self._max_entries,
+            "hits": self._hits,
+            "misses": self._misses,
+            "hit_rate_pct": self.hit_rate,
+            "revoked_tokens": len(self._revoked),
+            "revoked_users": len(self._user_not_before),
+        }
+
+
+class _TokenEntry:
+    """Internal cache entry — verified claims plus their expiry."""
+
+    __slots__ = ("exp", "payload")
+
+    def __init__(self, payload: dict[str, Any], exp: float) -> None:
+        """Initialize token entry.
+
+        Args:
+            payload: Verified JWT claims.
+            exp: Expiry as Unix seconds.
+        """
+        self.payload = payload
+        self.exp = exp
@@ -0,0 +1,437 @@
+"""Tracing — where an insight's latency went, from phone capture to publish.
+
+The client stamps every segment with an ID and its capture time
+(``id``/``captured_at`` in the JSON body, the trace table in a binary
+batch) and every ingest request with its send time and a device ID
+(``X-Trace-Sent-At``, ``X-Device-Id``). The server opens a
+:class:`BatchTrace` per ingest request; each stage inside it (parse,
+persist, screening, analysis) records a span through :func:`span`, and
+the background screening task inherits the trace through the context,
+so spans that finish after the response was sent still land on it.
+
+Client times are mapped to server time with a per-device clock offset,
+keyed by (user, device ID) so one user can't feed exchanges into
+another's estimate by reusing a device ID. Each ingest response carries
+the server's receive and respond times; the client echoes them with its
+own send/receive times on its next request
+(``X-Trace-Clock: t0,t1,t2,t3``) and :class:`ClockSync` keeps the NTP
+estimate of the lowest-RTT recent exchange. Until a device has one, the
+network leg is reported as unknown rather than guessed; the batching
+wait (capture → send) only needs the client's own clock.
+
+Traces are kept in memory per meeting for the waterfall view, bounded
+three ways: the last :data:`MAX_BATCHES_PER_MEETING` batches of a meeting,
+:data:`MAX_TRACES` across all meetings (least recently active meetings go
+first; a trace is ~1.5 KB, so ~30 MB at most), and meetings with no batch
+for :data:`TRACE_TTL_SECONDS` are dropped. Every span also feeds the
+``meetmind_stage_duration_seconds`` histograms for fleet-wide aggregates.
+"""
+
+from __future__ import annotations
+
+import time
+from collections import OrderedDict, deque
+from contextlib import contextmanager
+from contextvars import ContextVar
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, Any
+
+from meetmind.core import probes
+from meetmind.core.memory import deep_sizeof
+from meetmind.core.metrics import metrics
+
+if TYPE_CHECKING:
+    from collections.abc import Iterator, Mapping
+
+MAX_MEETINGS = 200
+MAX_BATCHES_PER_MEETING = 180  # 15 minutes of 5s batches
+MAX_TRACES = 20_000
+TRACE_TTL_SECONDS = 1800
+MAX_DEVICES = 10_000
+CLOCK_WINDOW = 8  # exchanges kept per device
+
+# Client-side legs, recorded as stages like the server spans
+CLIENT_BATCH_WAIT = "client_batch_wait"
+NETWORK_UPLINK = "network_uplink"
+
+_current: ContextVar[BatchTrace | None] = ContextVar("meetmind_trace", default=None)
+
+DeviceKey = tuple[str, str]  # (user_id, device_id)
+
+
+# ─── Clock Offset ───────────────────────────────────────────────
+
+
+@dataclass(frozen=True)
+class TraceContext:
+    """Trace headers of one ingest request (client epoch milliseconds)."""
+
+    device: str
+    sent_at_ms: float | None = None
+    clock: tuple[float, float, float, float] | None = None
+
+    @classmethod
+    def from_headers(cls, headers: Mapping[str, str], fallback_device: str) -> TraceContext:
+        """Parse the trace headers, ignoring malformed values."""
+        sent_at: float | None
+        try:
+            sent_at = float(headers["x-trace-sent-at"])
+        except (KeyError, ValueError):
+            sent_at = None
+        clock: tuple[float, float, float, float] | None = None
+        try:
+            t0, t1, t2, t3 = (float(v) for v in headers["x-trace-clock"].split(","))
+            clock = (t0, t1, t2, t3)
+        except (KeyError, ValueError):
+            pass
+        device = headers.get("x-device-id", "")[:64] or fallback_device
+        return cls(device=device, sent_at_ms=sent_at, clock=clock)
+
+
+class ClockSync:
+    """Per-device clock offset (server minus client) from NTP-style exchanges."""
+
+    def __init__(self, max_devices: int = MAX_DEVICES) -> None:
+        """Initialize with no devices."""
+        self._max_devices = max_devices
+        self._exchanges: OrderedDict[DeviceKey, deque[tuple[float, float]]] = OrderedDict()
+
+    def add_exchange(self, device: DeviceKey, t0: float, t1: float, t2: float, t3: float) -> None:
+        """Record one request/response round trip.
+
+        Args:
+            device: ``(user_id, device_id)`` of the client.
+            t0: Client send time (client clock).
+            t1: Server receive time (server clock).
+            t2: Server respond time (server clock).
+            t3: Client receive time (client clock).
+        """
+        rtt = (t3 - t0) - (t2 - t1)
+        if rtt < 0 or t2 < t1:
+            return  # clock jumped mid-exchange or a forged echo
+        offset = ((t1 - t0) + (t2 - t3)) / 2
+        samples = self._exchanges.get(device)
+        if samples is None:
+            samples = self._exchanges[device] = deque(maxlen=CLOCK_WINDOW)
+            if len(self._exchanges) > self._max_devices:
+                self._exchanges.popitem(last=False)
+        else:
+            self._exchanges.move_to_end(device)
+        samples.append((rtt, offset))
+
+    def estimate(self, device: DeviceKey) -> tuple[float, float] | None:
+        """``(offset_ms, rtt_ms)`` of the lowest-RTT recent exchange, if any."""
+        samples = self._exchanges.get(device)
+        if not samples:
+            return None
+        rtt, offset = min(samples)
+        return offset, rtt
+
+
+# ─── Batch Trace ────────────────────────────────────────────────
+
+
+@dataclass(frozen=True)
+class Span:
+    """A stage, relative to the server receiving the batch."""
+
+    name: str
+    start_ms: float
+    duration_ms: float
+
+
+class BatchTrace:
+    """Timeline of one ingest batch."""
+
+    def __init__(
+        self,
+        meeting_id: str,
+        context: TraceContext,
+        clock: tuple[float, float] | None,
+    ) -> None:
+        """Open a trace at the moment the request was received.
+
+        Args:
+            meeting_id: Meeting the batch belongs to.
+            context: Parsed trace headers.
+            clock: ``(offset_ms, rtt_ms)`` for the device, if known.
+        """
+        self.meeting_id = meeting_id
+        self.device = context.device
+        self.sent_at_ms = context.sent_at_ms
+        self.offset_ms = clock[0] if clock else None
+        self.rtt_ms = clock[1] if clock else None
+        self.received_at_ms = time.time() * 1000
+        self._received_ns = time.perf_counter_ns()
+        self.segment_ids: list[Any] = []
+        self.captured_at_ms: float | None = None  # oldest segment, client clock
+        self.spans: list[Span] = []
+
+    @property
+    def trace_id(self) -> str:
+        """``<meeting>:<first segment>`` (or the receive time without IDs)."""
+        first = self.segment_ids[0] if self.segment_ids else int(self.received_at_ms)
+        return f"{self.meeting_id}:{first}"
+
+    @property
+    def batch_wait_ms(self) -> float | None:
+        """Oldest capture → send, on the client's clock alone."""
+        if self.captured_at_ms is None or self.sent_at_ms is None:
+            return None
+        return max(0.0, self.sent_at_ms - self.captured_at_ms)
+
+    @property
+    def network_ms(self) -> float | None:
+        """Send → receive; needs the device's clock offset."""
+        if self.sent_at_ms is None or self.offset_ms is None:
+            return None
+        return max(0.0, self.received_at_ms - (self.sent_at_ms + self.offset_ms))
+
+    def set_segments(self, segments: list[dict[str, Any]]) -> None:
+        """Attach the batch's segment IDs and capture times and record the client legs."""
+        self.segment_ids = [seg["id"] for seg in segments if "id" in seg]
+        captured = [seg["captured_at"] for seg in segments if "captured_at" in seg]
+        try:
+            self.captured_at_ms = float(min(captured)) if captured else None
+        except (TypeError, ValueError):
+            self.captured_at_ms = None
+        if self.batch_wait_ms is not None:
+            metrics.stage(CLIENT_BATCH_WAIT).observe(self.batch_wait_ms / 1000)
+        if self.network_ms is not None:
+            metrics.stage(NETWORK_UPLINK).observe(self.network_ms / 1000)
+
+    def add_span(self, name: str, start_ns: int, duration_ns: int) -> None:
+        """Record a stage that started at ``perf_counter_ns() == start_ns``."""
+        self.spans.append(Span(name, (start_ns - self._received_ns) / 1e6, duration_ns / 1e6))
+
+    def response_timing(self) -> dict[str, Any]:
+        """Server times the client echoes back in ``X-Trace-Clock``."""
+        return {
+            "trace_id": self.trace_id,
+            "received_at": round(self.received_at_ms, 3),
+            "responded_at": round(time.time() * 1000, 3),
+        }
+
+    def to_dict(self) -> dict[str, Any]:
+        """Waterfall rows with t=0 at server receive (client legs are negative)."""
+        network, wait = self.network_ms, self.batch_wait_ms
+        client_start = None if wait is None or network is None else -(network + wait)
+        rows = [
+            {
+                "name": CLIENT_BATCH_WAIT,
+                "start_ms": _round(client_start),
+                "duration_ms": _round(wait),
+            },
+            {
+                "name": NETWORK_UPLINK,
+                "start_ms": _round(-network if network is not None else None),
+                "duration_ms": _round(network),
+            },
+        ]
+        rows += [
+            {
+                "name": s.name,
+                "start_ms": round(s.start_ms, 3),
+                "duration_ms": round(s.duration_ms, 3),
+            }
+            for s in self.spans
+        ]
+        end = max((s.start_ms + s.duration_ms for s in self.spans), default=0.0)
+        return {
+            "trace_id": self.trace_id,
+            "device": self.device,
+            "received_at": round(self.received_at_ms, 3),
+            "segments": len(self.segment_ids),
+            "clock_offset_ms": _round(self.offset_ms),
+            "clock_rtt_ms": _round(self.rtt_ms),
+            "server_ms": round(end, 3),
+            "end_to_end_ms": None if client_start is None else round(end - client_start, 3),
+            "spans": rows,
+        }
+
+
+def _round(value: float | None) -> float | None:
+    return None if value is None else round(value, 3)
+
+
+@contextmanager
+def span(name: str) -> Iterator[None]:
+    """Time a pipeline stage into its histogram and the current trace (if any)."""
+    trace = _current.get()
+    start = time.perf_counter_ns()
+    try:
+        yield
+    finally:
+        elapsed = time.perf_counter_ns() - start
+        metrics.stage(name).record_us(elapsed // 1000)
+        if trace is not None:
+            trace.add_span(name, start, elapsed)
+        if probes.STAGE_DONE.enabled:
+            probes.STAGE_DONE.fire(name, elapsed // 1000)
+
+
+def mark(name: str) -> None:
+    """Zero-length span on the current trace (e.g. the insight being published)."""
+    trace = _current.get()
+    if trace is not None:
+        trace.add_span(name, time.perf_counter_ns(), 0)
+
+
+# ─── Tracer ─────────────────────────────────────────────────────
+
+
+class Tracer:
+    """Recent batch traces per meeting plus the device clock estimates."""
+
+    def __init__(
+        self,
+        max_meetings: int = MAX_MEETINGS,
+        max_batches: int = MAX_BATCHES_PER_MEETING,
+        max_traces: int = MAX_TRACES,
+        ttl_seconds: float = TRACE_TTL_SECONDS,
+    ) -> None:
+        """Initialize an empty tracer."""
+        self.clock = ClockSync()
+        self._max_meetings = max_meetings
+        self._max_batches = max_batches
+        self._max_traces = max_traces
+        self._ttl_ms = ttl_seconds * 1000
+        self._meetings: OrderedDict[str, deque[BatchTrace]] = OrderedDict()
+        self._owners: dict[str, str | None] = {}
+        self._traces = 0  # across every meeting
+
+    def begin(self, meeting_id: str, owner: str | None, context: TraceContext) -> BatchTrace:
+        """Open the trace for an ingest request and make it current.
+
+        Args:
+            meeting_id: Meeting the batch belongs to.
+            owner: Authenticated user (only they can read the trace).
+            context: Parsed trace headers.
+
+        Returns:
+            The new trace; spans recorded in this context attach to it.
+        """
+        device = (owner or "", context.device)
+        if context.clock:
+            self.clock.add_exchange(device, *context.clock)
+        trace = BatchTrace(meeting_id, context, self.clock.estimate(device))
+
+        batches = self._meetings.get(meeting_id)
+        if batches is None:
+            batches = self._meetings[meeting_id] = deque(maxlen=self._max_batches)
+            self._owners[meeting_id] = owner
+        else:
+            self._meetings.move_to_end(meeting_id)
+        if len(batches) < self._max_batches:
+            self._traces += 1
+        batches.append(trace)
+        self._evict(trace.received_at_ms)
+        _current.set(trace)
+        return trace
+
+    def _evict(self, now_ms: float) -> None:
+        """Drop least recently active meetings while over a bound or idle too long."""
+        while len(self._meetings) > 1:
+            meeting_id, batches = next(iter(self._meetings.items()))
+            if (
+                len(self._meetings) <= self._max_meetings
+                and self._traces <= self._max_traces
+                and now_ms - batches[-1].received_at_ms <= self._ttl_ms
+            ):
+                return
+            self._meetings.popitem(last=False)
+            self._owners.pop(meeting_id, None)
+            self._traces -= len(batches)
+
+    def owner(self, meeting_id: str) -> str | None:
+        """User who owns a traced meeting (None when not traced)."""
+        return self._owners.get(meeting_id)
+
+    def waterfall(self, meeting_id: str) -> dict[str, Any]:
+        """Every recent batch of a meeting plus its stage breakdown."""
+        traces = list(self._meetings.get(meeting_id, ()))
+        return {
+            "meeting_id": meeting_id,
+            "batches": [t.to_dict() for t in traces],
+            "breakdown": breakdown(traces),
+        }
+
+    def breakdown(self) -> dict[str, Any]:
+        """Stage breakdown across every traced meeting in memory."""
+        return breakdown([t for batches in list(self._meetings.values()) for t in batches])
+
+    def memory_by_meeting(self) -> dict[str, int]:
+        """Bytes held by each meeting's retained traces."""
+        return {m: deep_sizeof(batches) for m, batches in list(self._meetings.items())}
+
+    def reset(self) -> None:
+        """Drop all traces and clock estimates (tests)."""
+        self._meetings.clear()
+        self._owners.clear()
+        self._traces = 0
+        self.clock = ClockSync()
+
+
+def breakdown(traces: list[BatchTrace]) -> dict[str, Any]:
+    """Per-stage count, p50/p95 and share of the summed end-to-end time.
+
+    Spans can nest (a persist inside analysis), so shares may add up to
+    more than 100%.
+    """
+    durations: dict[str, list[float]] = {}
+    total_end_to_end = 0.0
+    for trace in traces:
+        row = trace.to_dict()
+        if row["end_to_end_ms"] is not None:
+            total_end_to_end += row["end_to_end_ms"]
+        for s in row["spans"]:
+            if s["duration_ms"] is not None:
+                durations.setdefault(s["name"], []).append(s["duration_ms"])
+
+    stages: dict[str, dict[str, float]] = {}
+    for name, values in durations.items():
+        values.sort()
+        total = sum(values)
+        stages[name] = {
+            "count": len(values),
+            "p50_ms": round(values[len(values) // 2], 3),
+            "p95_ms": round(values[min(len(values) - 1, int(len(values) * 0.95))], 3),
+            "total_ms": round(total, 3),
+            "share": round(total / total_end_to_end, 4) if total_end_to_end else 0.0,
+        }
+    return {
+        "batches": len(traces),
+        "end_to_end_total_ms": round(total_end_to_end, 3),
+        "stages": dict(sorted(stages.items(), key=lambda item: -item[1]["total_ms"])),
+    }
+
+
+def render_waterfall(view: dict[str, Any], width: int = 60) -> str:
+    """Plain-text waterfall of :meth:`Tracer.waterfall` output."""
+    lines = [f"meeting {view['meeting_id']} — {len(view['batches'])} batch(es)"]
+    for batch in view["batches"]:
+        rows = [s for s in batch["spans"] if s["start_ms"] is not None]
+        lines.append("")
+        e2e = batch["end_to_end_ms"]
+        lines.append(
+            f"{batch['trace_id']}  e2e={'?' if e2e is None else f'{e2e:.0f}ms'}"
+            f"  server={batch['server_ms']:.0f}ms"
+        )
+        origin = min((s["start_ms"] for s in rows), default=0.0)
+        end = max((s["start_ms"] + s["duration_ms"] for s in rows), default=0.0)
+        scale = width / ((end - origin) or 1.0)
+        for s in batch["spans"]:
+            if s["start_ms"] is None:
+                duration = "?" if s["duration_ms"] is None else f"{s['duration_ms']:.0f}ms"
+                lines.append(f"  {s['name']:<20} {'':<{width}} {duration} (no clock offset yet)")
+                continue
+            offset = int((s["start_ms"] - origin) * scale)
+            bar = "█" * max(1, int(s["duration_ms"] * scale))
+            lines.append(
+                f"  {s['name']:<20} {' ' * offset + bar:<{width}} {s['duration_ms']:.0f}ms"
+            )
+    return "\n".join(lines) + "\n"
+
+
+# Global instance (one per process)
+tracer = Tracer()
@@ -5,6 +5,7 @@ the AI screening pipeline (every 30s → Haiku screening).
 """
 
 import time
+from typing import Any
 
 import structlog
 
@@ -135,6 +136,40 @@ class TranscriptManager:
         """
         return [seg.to_dict() for seg in self._segments]
 
+    def export_state(self) -> dict[str, Any]:
+        """Serialize the session state for a deploy snapshot.
+
+        Includes the unscreened buffer and time since the last screening,
+        so a restored session neither re-screens nor drops pending text.
+        """
+        return {
+            "meeting_id": self._meeting_id,
+            "interval": self._screening_interval,
+            "segments": [[s.text, s.timestamp, s.speaker] for s in self._segments],
+            "buffer": list(self._buffer),
+            "since_screening": time.monotonic() - self._last_screening_time,
+        }
+
+    @classmethod
+    def from_state(cls, state: dict[str, Any]) -> "TranscriptManager":
+        """Rebuild a manager from :meth:`export_state` output.
+
+        Args:
+            state: Exported state.
+
+        Returns:
+            Manager with the same transcript, buffer, and screening clock.
+        """
+        manager = cls(screening_interval=int(state["interval"]))
+        manager._meeting_id = str(state["meeting_id"])
+        manager._segments = [
+            TranscriptSegment(text=text, timestamp=ts, speaker=speaker)
+            for text, ts, speaker in state["segments"]
+        ]
+        manager._buffer = list(state["buffer"])
+        manager._last_screening_time = time.monotonic() - float(state["since_screening"])
+        return manager
+
     @property
     def segment_count(self) -> int:
         """Return total number of segments."""
@@ -0,0 +1,195 @@
+"""Transcript Codec — compact, versioned binary format for transcript ingest.
+
+The JSON ingest path validates every segment dict through pydantic and
+re-sends the speaker name with each segment. The binary batch is read in
+place from the request body (``memoryview`` + ``struct``) with one bounds
+check per field and interned speakers.
+
+Layout (version 1, little-endian)::
+
+    offset  size  field
+    0       4     magic  b"MMTS"
+    4       1     version (1)
+    5       1     flags (bit 0: trace table present; others reserved, 0)
+    6       2     segment count N
+    8       1     language length L
+    9       1     speaker count K
+    10      L     language (UTF-8)
+    ...     K x   speaker: u8 length + UTF-8 bytes
+    ...     N x 8 segment table: u32 text offset, u16 text length,
+                  u8 speaker index, u8 reserved
+    [flag 0 only]
+    ...     8     capture base: i64 client epoch milliseconds
+    ...     N x 8 trace table: u32 segment ID, u32 capture time minus base (ms)
+    ...     rest  text blob (UTF-8); offsets are relative to its start
+
+Traced segments decode with ``id`` and ``captured_at`` (epoch ms) for
+``core.tracing``; batches without the flag are unchanged from before.
+
+The Dart encoder lives in ``flutter_app/lib/services/transcript_codec.dart``.
+"""
+
+from __future__ import annotations
+
+import struct
+from typing import TYPE_CHECKING, Any
+
+if TYPE_CHECKING:
+    from collections.abc import Sequence
+
+CONTENT_TYPE = "application/vnd.meetmind.transcript"
+MAGIC = b"MMTS"
+VERSION = 1
+
+MAX_SEGMENTS = 2000
+MAX_BODY_BYTES = 1 << 20  # 1 MiB per batch
+MAX_SEGMENT_ID = (1 << 31) - 1  # ids are stored as segment_index (int4)
+
+_HEADER = struct.Struct("<4sBBHBB")
+_SEGMENT = struct.Struct("<IHBB")
+_TRACE_BASE = struct.Struct("<q")
+_TRACE = struct.Struct("<II")
+
+FLAG_TRACE = 0x01
+
+
+class TranscriptDecodeError(ValueError):
+    """Raised when a binary transcript batch is malformed."""
+
+
+def _clip(text: str, limit: int) -> bytes:
+    """UTF-8 encode, truncated to ``limit`` bytes on a character boundary."""
+    data = text.encode()
+    if len(data) <= limit:
+        return data
+    return data[:limit].decode(errors="ignore").encode()
+
+
+def encode_batch(
+    segments: Sequence[dict[str, Any]],
+    language: str = "es",
+) -> bytes:
+    """Encode transcript segments into a binary batch.
+
+    Mirrors the Dart encoder; used by tests and server-side tools.
+
+    Args:
+        segments: ``{"text", "speaker"}`` dicts, optionally with ``id`` and
+            ``captured_at`` (epoch ms) — then the trace table is written.
+        language: Language code.
+
+    Returns:
+        Encoded batch. Text over 64 KiB and speaker names over 255 bytes
+        are truncated.
+
+    Raises:
+        ValueError: If the batch has more than 255 distinct speakers.
+    """
+    speakers: dict[str, int] = {}
+    table = bytearray()
+    blob = bytearray()
+    for seg in segments:
+        speaker = seg.get("speaker", "unknown")
+        index = speakers.setdefault(speaker, len(speakers))
+        text = _clip(seg.get("text", ""), 0xFFFF)
+        table += _SEGMENT.pack(len(blob), len(text), index, 0)
+        blob += text
+
+    if len(speakers) > 0xFF:
+        raise ValueError("Too many distinct speakers in one batch")
+
+    flags = 0
+    trace = bytearray()
+    if segments and all("captured_at" in seg for seg in segments):
+        flags |= FLAG_TRACE
+        base = min(int(seg["captured_at"]) for seg in segments)
+        trace += _TRACE_BASE.pack(base)
+        for index, seg in enumerate(segments):
+            trace += _TRACE.pack(int(seg.get("id", index)), int(seg["captured_at"]) - base)
+
+    lang = _clip(language, 0xFF)
+    out = bytearray(_HEADER.pack(MAGIC, VERSION, flags, len(segments), len(lang), len(speakers)))
+    out += lang
+    for speaker in speakers:
+        name = _clip(speaker, 0xFF)
+        out.append(len(name))
+        out += name
+    return bytes(out + table + trace + blob)
+
+
+def decode_batch(body: bytes | bytearray | memoryview) -> tuple[list[dict[str, Any]], str]:
+    """Decode a binary transcript batch.
+
+    Args:
+        body: Raw request body.
+
+    Returns:
+        ``(segments, language)`` — segments as ``{"text", "speaker"}`` dicts
+        (plus ``id``/``captured_at`` when traced), the same shape the JSON
+        path produces.
+
+    Raises:
+        TranscriptDecodeError: On bad magic, unsupported version, size
+            limits, out-of-range offsets or segment ids, or invalid UTF-8.
+    """
+    view = memoryview(body)
+    size = len(view)
+    if size > MAX_BODY_BYTES:
+        raise TranscriptDecodeError("Batch too large")
+    if size < _HEADER.size:
+        raise TranscriptDecodeError("Truncated header")
+
+    magic, version, flags, count, lang_len, speaker_count = _HEADER.unpack_from(view)
+    if magic != MAGIC:
+        raise TranscriptDecodeError("Bad magic")
+    if version != VERSION:
+        raise TranscriptDecodeError(f"Unsupported version {version}")
+    if count > MAX_SEGMENTS:
+        raise TranscriptDecodeError("Too many segments")
+
+    try:
+        pos = _HEADER.size
+        language = str(view[pos : pos + lang_len], "utf-8")
+        pos += lang_len
+
+        speakers: list[str] = []
+        for _ in range(speaker_count):
+            name_len = view[pos]
+            speakers.append(str(view[pos + 1 : pos + 1 + name_len], "utf-8"))
+            pos += 1 + name_len
+
+        table_end = pos + count * _SEGMENT.size
+        blob_start = table_end
+        if flags & FLAG_TRACE:
+            blob_start += _TRACE_BASE.size + count * _TRACE.size
+        if blob_start > size:
+            raise TranscriptDecodeError("Truncated segment table")
+
+        blob = view[blob_start:]
+        blob_len = len(blob)
+        segments: list[dict[str, Any]] = []
+        for offset, length, speaker_idx, _ in _SEGMENT.iter_unpack(view[pos:table_end]):
+            if offset + length > blob_len:
+                raise TranscriptDecodeError("Segment text out of range")
+            if speaker_idx >= speaker_count:
+                raise TranscriptDecodeError("Unknown speaker index")
+            segments.append(
+                {
+                    "text": str(blob[offset : offset + length], "utf-8"),
+                    "speaker": speakers[speaker_idx],
+                }
+            )
+        if flags & FLAG_TRACE:
+            (base,) = _TRACE_BASE.unpack_from(view, table_end)
+            trace = _TRACE.iter_unpack(view[table_end + _TRACE_BASE.size : blob_start])
+            for seg, (segment_id, delta) in zip(segments, trace, strict=True):
+                if segment_id > MAX_SEGMENT_ID:
+                    raise TranscriptDecodeError(f"Segment id out of range: {segment_id}")
+                seg["id"] = segment_id
+                seg["captured_at"] = base + delta
+    except IndexError as e:
+        raise TranscriptDecodeError("Truncated batch") from e
+    except UnicodeDecodeError as e:
+        raise TranscriptDecodeError("Invalid UTF-8") from e
+
+    return segments, language or "es"
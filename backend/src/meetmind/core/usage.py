@@ -0,0 +1,289 @@
+"""Usage quotas — per-user monthly counters checked without touching the DB.
+
+Free-tier limits used to be enforced only by the app, and
+``session_budget_usd`` resets with every meeting ID. This module keeps,
+per user and calendar month (UTC), the minutes transcribed, the LLM
+dollars spent (fed by ``core.cost_ledger``) and the summaries generated,
+and checks them against the tier's quota on every ingest, copilot and
+summary request. Copilot and summaries are refused with a 402; ingest
+never is — a meeting in progress keeps its transcript, and only its AI
+screening stops (see :func:`exceeded`).
+
+The hot path is a dict lookup and three comparisons. Each user's counter
+holds the month total as last read from the database plus the local
+usage not yet flushed; counters are only touched on the event loop, so
+they need no lock. :meth:`UsageCounters.flush` runs every
+``usage_flush_seconds`` and at shutdown: one statement adds every user's
+local increments to ``usage_counters`` and returns the new totals (which
+include other instances' usage) and the user's current subscription tier.
+
+A user this process hasn't seen yet is let through while their row loads
+in the background, so quotas can overshoot by about one request per
+instance — the price of never awaiting the database on the request path.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import calendar
+import time
+from dataclasses import dataclass, field
+from typing import Any
+
+import structlog
+from fastapi import HTTPException
+
+from meetmind.config.settings import settings
+from meetmind.core import storage
+
+logger = structlog.get_logger(__name__)
+
+METRICS = ("minutes", "llm_usd", "summaries")
+MINUTES, LLM_USD, SUMMARIES = range(3)
+
+# Segments carry text, not audio duration; conversational speech runs ~150 wpm
+WORDS_PER_MINUTE = 150
+
+
+def month_key(now: float | None = None) -> str:
+    """``YYYY-MM`` (UTC) for an epoch time (default now)."""
+    return time.strftime("%Y-%m", time.gmtime(now))
+
+
+def _month_end(now: float) -> float:
+    """Epoch seconds at which the UTC month containing ``now`` ends."""
+    t = time.gmtime(now)
+    year, month = (t.tm_year + 1, 1) if t.tm_mon == 12 else (t.tm_year, t.tm_mon + 1)
+    return float(calendar.timegm((year, month, 1, 0, 0, 0)))
+
+
+def limits(tier: str) -> tuple[float, float, float]:
+    """Monthly (minutes, llm_usd, summaries) quota for a tier; 0 means unlimited."""
+    if tier == "free":
+        return (
+            settings.quota_free_minutes,
+            settings.quota_free_llm_usd,
+            settings.quota_free_summaries,
+        )
+    return (settings.quota_pro_minutes, settings.quota_pro_llm_usd, settings.quota_pro_summaries)
+
+
+def minutes_of(segments: list[dict[str, Any]]) -> float:
+    """Speaking time a batch of transcript segments represents."""
+    words = sum(len(str(seg.get("text", "")).split()) for seg in segments)
+    return words / WORDS_PER_MINUTE
+
+
+class QuotaExceededError(Exception):
+    """A user has used up one of their monthly quotas."""
+
+    def __init__(self, metric: str, used: float, limit: float) -> None:
+        """Initialize with the exhausted metric."""
+        super().__init__(f"Monthly {metric} quota reached ({used:g} of {limit:g})")
+        self.metric = metric
+        self.used = used
+        self.limit = limit
+
+
+@dataclass(slots=True)
+class _Counter:
+    """One user's month: totals as of the last DB read plus local usage."""
+
+    tier: str = "free"
+    loaded: bool = False
+    total: list[float] = field(default_factory=lambda: [0.0, 0.0, 0.0])
+    inflight: list[float] = field(default_factory=lambda: [0.0, 0.0, 0.0])  # being flushed
+    pending: list[float] = field(default_factory=lambda: [0.0, 0.0, 0.0])
+
+    def used(self, metric: int) -> float:
+        return self.total[metric] + self.inflight[metric] + self.pending[metric]
+
+
+# ─── Counters ───────────────────────────────────────────────────
+
+
+class UsageCounters:
+    """Per-user monthly usage with periodic persistence."""
+
+    def __init__(self) -> None:
+        """Initialize empty counters for the current month."""
+        now = time.time()
+        self._month = month_key(now)
+        self._month_ends = _month_end(now)
+        self._users: dict[str, _Counter] = {}
+        self._closing: dict[str, dict[str, _Counter]] = {}  # past months not yet flushed
+        self._loading: set[asyncio.Task[None]] = set()
+
+    def _current(self) -> dict[str, _Counter]:
+        """This month's counters, rolling over at the month boundary."""
+        now = time.time()
+        if now >= self._month_ends:
+            self._closing[self._month] = self._users
+            self._users = {}
+            self._month = month_key(now)
+            self._month_ends = _month_end(now)
+        return self._users
+
+    def _counter(self, user_id: str) -> _Counter:
+        users = self._current()
+        counter = users.get(user_id)
+        if counter is None:
+            counter = users[user_id] = _Counter()
+            if storage.pool_ready():
+                task = asyncio.get_running_loop().create_task(self._load_user(user_id))
+                self._loading.add(task)
+                task.add_done_callback(self._loading.discard)
+        return counter
+
+    def add(
+        self, user_id: str, *, minutes: float = 0.0, llm_usd: float = 0.0, summaries: int = 0
+    ) -> None:
+        """Count usage against a user's current month."""
+        pending = self._counter(user_id).pending
+        pending[MINUTES] += minutes
+        pending[LLM_USD] += llm_usd
+        pending[SUMMARIES] += summaries
+
+    def check(self, user_id: str, *, minutes: float = 0.0, summary: bool = False) -> None:
+        """Raise if the request would go over one of the user's quotas.
+
+        Every check includes LLM dollars (ingest triggers screening, copilot
+        and summaries are LLM calls). ``minutes`` and ``summary`` add the
+        request's own usage to the comparison.
+
+        Raises:
+            QuotaExceededError: With the first exhausted metric.
+        """
+        if not settings.quotas_enabled:
+            return
+        counter = self._counter(user_id)
+        if not counter.loaded:
+            return  # first sight in this process — its row is loading
+        quota = limits(counter.tier)
+        wanted = (minutes, 0.0, 1.0 if summary else 0.0)
+        for metric in (MINUTES, LLM_USD, SUMMARIES):
+            if metric != LLM_USD and not wanted[metric]:
+                continue
+            limit = quota[metric]
+            used = counter.used(metric)
+            if limit and (used >= limit or used + wanted[metric] > limit):
+                raise QuotaExceededError(METRICS[metric], round(used, 2), limit)
+
+    def usage(self, user_id: str) -> dict[str, Any]:
+        """A user's month so far and their quotas (0 = unlimited)."""
+        counter = self._counter(user_id)
+        quota = limits(counter.tier)
+        return {
+            "month": self._month,
+            "tier": counter.tier,
+            **{
+                name: {"used": round(counter.used(i), 4), "limit": quota[i]}
+                for i, name in enumerate(METRICS)
+            },
+        }
+
+    def _apply(self, users: dict[str, _Counter], rows: list[tuple[Any, ...]]) -> None:
+        for user_id, tier, minutes, llm_usd, summaries in rows:
+            counter = users.setdefault(user_id, _Counter())
+            counter.tier = tier
+            counter.total = [float(minutes), float(llm_usd), float(summaries)]
+            counter.loaded = True
+
+    async def _load_user(self, user_id: str) -> None:
+        month = self._month
+        try:
+            rows = await storage.load_usage(month, user_id)
+        except Exception as e:
+            logger.warning("usage_load_failed", user_id=user_id, error=str(e))
+            return
+        if month == self._month:
+            self._apply(self._users, rows)
+
+    async def load(self) -> int:
+        """Read every user's usage for the current month (at startup).
+
+        Returns:
+            Number of users loaded.
+        """
+        month = self._month
+        rows = await storage.load_usage(month)
+        if month == self._month:
+            self._apply(self._users, rows)
+        return len(rows)
+
+    async def flush(self) -> int:
+        """Persist local increments and refresh totals and tiers.
+
+        Increments move to ``inflight`` for the write (still counted by
+        checks); a failed write returns them to ``pending``.
+
+        Returns:
+            Number of users whose usage was written.
+        """
+        self._current()
+        months = [*self._closing.items(), (self._month, self._users)]
+        flushed = 0
+        for month, users in months:
+            deltas: list[tuple[str, float, float, int]] = []
+            for user_id, counter in users.items():
+                if any(counter.pending):
+                    minutes, llm_usd, summaries = counter.pending
+                    deltas.append((user_id, minutes, llm_usd, int(summaries)))
+                    counter.inflight, counter.pending = counter.pending, [0.0, 0.0, 0.0]
+            try:
+                rows = await storage.add_usage(month, deltas)
+            except Exception as e:
+                logger.warning("usage_flush_failed", month=month, users=len(deltas), error=str(e))
+                for user_id, *_ in deltas:
+                    counter = users[user_id]
+                    counter.pending = [
+                        a + b for a, b in zip(counter.pending, counter.inflight, strict=True)
+                    ]
+                    counter.inflight = [0.0, 0.0, 0.0]
+                continue
+            for user_id, *_ in deltas:
+                users[user_id].inflight = [0.0, 0.0, 0.0]
+            self._apply(users, rows)
+            flushed += len(deltas)
+            self._closing.pop(month, None)
+        return flushed
+
+    async def run(self, interval: float) -> None:
+        """Flush every ``interval`` seconds until cancelled."""
+        while True:
+            await asyncio.sleep(interval)
+            await self.flush()
+
+
+counters = UsageCounters()
+
+
+def exceeded(user_id: str | None, *, minutes: float = 0.0) -> str | None:
+    """:meth:`UsageCounters.check` for transcript ingest.
+
+    Returns:
+        Why the user is over quota (the 402 detail elsewhere), or None.
+    """
+    if not user_id:
+        return None
+    try:
+        counters.check(user_id, minutes=minutes)
+    except QuotaExceededError as e:
+        logger.info("quota_exceeded", user_id=user_id, metric=e.metric, limit=e.limit)
+        return str(e)
+    return None
+
+
+def enforce(user_id: str | None, *, minutes: float = 0.0, summary: bool = False) -> None:
+    """:meth:`UsageCounters.check` for an endpoint.
+
+    Raises:
+        HTTPException: 402 naming the exhausted quota.
+    """
+    if not user_id:
+        return
+    try:
+        counters.check(user_id, minutes=minutes, summary=summary)
+    except QuotaExceededError as e:
+        logger.info("quota_exceeded", user_id=user_id, metric=e.metric, limit=e.limit)
+        raise HTTPException(status_code=402, detail=str(e)) from e
@@ -3,6 +3,9 @@
 from __future__ import annotations
 
 import asyncio
+import contextlib
+import hmac
+import tracemalloc
 import uuid
 from contextlib import asynccontextmanager
 from typing import TYPE_CHECKING, Any
@@ -23,19 +26,27 @@ if _sentry_dsn:
         enable_tracing=True,
     )
 from fastapi import Depends, FastAPI, HTTPException, Request
-from pydantic import BaseModel, EmailStr, field_validator
+from fastapi.encoders import jsonable_encoder
+from pydantic import BaseModel, ConfigDict, EmailStr, Field, field_validator
 from slowapi import Limiter, _rate_limit_exceeded_handler
 from slowapi.errors import RateLimitExceeded
 from slowapi.util import get_remote_address
 from starlette.middleware.cors import CORSMiddleware
+from starlette.responses import JSONResponse, Response, StreamingResponse
 
 if TYPE_CHECKING:
-    from collections.abc import AsyncGenerator
+    from collections.abc import AsyncGenerator, AsyncIterator
 
 from meetmind.api.meeting_api import meeting_manager
-from meetmind.config.logging import setup_logging
+from meetmind.config.logging import (
+    log_buffer_bytes,
+    logging_stats,
+    setup_logging,
+    shutdown_logging,
+)
 from meetmind.config.settings import settings
-from meetmind.core import storage
+from meetmind.core import cost_ledger, memory, probes, storage, tracing, usage
+from meetmind.core import event_hub as events
 from meetmind.core.auth import (
     create_access_token,
     create_refresh_token,
@@ -43,11 +54,29 @@ from meetmind.core.auth import (
     decode_token,
     get_current_user,
     hash_password,
+    revoke_user_tokens,
+    token_cache,
     verify_apple_token,
     verify_google_token,
     verify_password,
 )
+from meetmind.core.event_hub import event_hub, parse_last_event_id, sse_stream
+from meetmind.core.metrics import MetricsMiddleware, metrics
+from meetmind.core.readiness import readiness
+from meetmind.core.tracing import TraceContext, render_waterfall, tracer
+from meetmind.core.transcript_codec import (
+    MAX_SEGMENT_ID,
+    TranscriptDecodeError,
+    decode_batch,
+)
+from meetmind.utils.cpu_features import host_features
 from meetmind.utils.email_service import email_service
+from meetmind.utils.http_compression import CompressionMiddleware, load_dictionary
+from meetmind.utils.pdf_report import (
+    report_filename,
+    report_renderable,
+    stream_meeting_report,
+)
 
 logger = structlog.get_logger(__name__)
 
@@ -75,6 +104,9 @@ class AuthTokenResponse(BaseModel):
 # Module-level dependency to satisfy B008 (no function calls in defaults)
 _auth_dep = Depends(get_current_user)
 
+# Concurrent PDF report renders (each one streams a whole transcript)
+_report_exports = asyncio.Semaphore(settings.report_export_concurrency)
+
 
 class RefreshRequest(BaseModel):
     """Token refresh request."""
@@ -109,31 +141,124 @@ class EmailLoginRequest(BaseModel):
 # ─── Lifespan ────────────────────────────────────────────────────
 
 
-@asynccontextmanager
-async def lifespan(app: FastAPI) -> AsyncGenerator[None, None]:
-    """Application lifespan — setup logging, DB, and AI agents on startup."""
-    setup_logging()
+_DB_RETRY_MAX_SECONDS = 30.0
+
+
+async def _warm_up_database() -> None:
+    """Open the pool (retrying until reachable), then migrate if needed."""
+    delay = 0.5
+    while True:
+        try:
+            await storage.open_pool()
+            readiness.mark_ready("database")
+            break
+        except Exception as e:
+            readiness.mark_failed("database", str(e))
+            await asyncio.sleep(delay)
+            delay = min(delay * 2, _DB_RETRY_MAX_SECONDS)
 
-    # Initialize PostgreSQL + pgvector
     try:
-        await asyncio.wait_for(storage.init_db(), timeout=10)
-        logger.info("database_ready")
-    except TimeoutError:
-        logger.warning("database_init_failed", error="connection timeout (10s)")
+        await storage.migrate()
+        readiness.mark_ready("schema")
     except Exception as e:
-        logger.warning("database_init_failed", error=str(e))
+        readiness.mark_failed("schema", str(e))
+        return
+
+    with contextlib.suppress(Exception):
+        purged = await storage.purge_session_snapshots()
+        if purged:
+            logger.info("session_snapshots_purged", count=purged)
+
+    try:
+        logger.info("usage_counters_loaded", users=await usage.counters.load())
+    except Exception as e:
+        logger.warning("usage_load_failed", error=str(e))
+
 
-    # Initialize AI agents (graceful fallback if no credentials)
+async def _warm_up_agents() -> None:
+    """Build the LLM provider and agents off the event loop (SDK clients are slow to create)."""
     try:
-        meeting_manager.init_agents()
-        logger.info("ai_agents_ready")
+        await asyncio.to_thread(meeting_manager.init_agents)
+        readiness.mark_ready("agents")
     except Exception as e:
-        logger.warning("ai_agents_failed", error=str(e))
+        # Graceful fallback — AI endpoints degrade without credentials
+        readiness.mark_failed("agents", str(e))
+
+
+def _register_memory_accounting() -> None:
+    """Register every long-lived structure with the memory accountant."""
+    accountant = memory.accountant
+    accountant.register("sessions", meeting_manager.memory_by_session)
+    accountant.register("event_hub", event_hub.memory_by_user)
+    accountant.register("traces", tracer.memory_by_meeting)
+    accountant.register("token_cache", lambda: memory.deep_sizeof(token_cache))
+    accountant.register("log_buffer", log_buffer_bytes)
+    accountant.register("metrics", lambda: memory.deep_sizeof(metrics))
+    accountant.register("probe_recorder", lambda: memory.deep_sizeof(probes.recorder))
+
+
+async def _sample_memory() -> None:
+    """Sample subsystem sizes periodically so high-water marks catch peaks.
+
+    Walking every structure takes tens of ms, so it runs in a thread;
+    the sizers copy what they iterate (see ``core.memory``).
+    """
+    while True:
+        await asyncio.sleep(settings.memory_sample_seconds)
+        sample = await asyncio.to_thread(memory.accountant.sample, 3)
+        logger.debug(
+            "memory_sampled",
+            rss_bytes=sample["rss_bytes"],
+            **{name: s["bytes"] for name, s in sample["subsystems"].items()},
+        )
+
+
+@asynccontextmanager
+async def lifespan(app: FastAPI) -> AsyncGenerator[None, None]:
+    """Application lifespan — live immediately, warm up components in the background.
+
+    Nothing here blocks on the network: the database and AI agents come
+    up in a background task and report to ``readiness``. Requests that
+    arrive first wait on the same pool via ``storage.get_pool()``.
+    """
+    setup_logging()
+    logger.info("platform_detected", **host_features().to_dict())
+    logger.info(
+        "probes_installed",
+        **probes.install(record=settings.probes_record, perf_map=settings.perf_map),
+    )
+    if settings.memory_tracemalloc:
+        tracemalloc.start()
+    _register_memory_accounting()
+    sampler = asyncio.create_task(_sample_memory())
+    ledger_flusher = asyncio.create_task(cost_ledger.ledger.run(settings.cost_ledger_flush_seconds))
+    usage_flusher = asyncio.create_task(usage.counters.run(settings.usage_flush_seconds))
+    change_flusher = asyncio.create_task(storage.run_change_flush(settings.change_flush_seconds))
+
+    readiness.register("database")
+    readiness.register("schema")
+    readiness.register("agents", required=False)
+    warm_up = asyncio.gather(_warm_up_database(), _warm_up_agents())
 
     yield
 
-    # Cleanup
+    # Cleanup — uvicorn has stopped accepting connections and finished
+    # in-flight requests; hand live sessions to the next process.
+    warm_up.cancel()
+    sampler.cancel()
+    ledger_flusher.cancel()
+    usage_flusher.cancel()
+    change_flusher.cancel()
+    with contextlib.suppress(asyncio.CancelledError):
+        await warm_up
+    if storage.pool_ready():
+        await meeting_manager.drain(timeout=settings.drain_timeout_seconds)
+        await cost_ledger.ledger.flush()
+        await usage.counters.flush()
+        await storage.flush_changes()
+    await email_service.close()
     await storage.close_db()
+    shutdown_logging()
 
 
 # ─── Rate Limiter ────────────────────────────────────────────────
@@ -151,6 +276,7 @@ app = FastAPI(
 app.state.limiter = limiter
 app.add_exception_handler(RateLimitExceeded, _rate_limit_exceeded_handler)  # type: ignore[arg-type]
 
+
 app.add_middleware(
     CORSMiddleware,
     allow_origins=[o.strip() for o in settings.cors_origins.split(",")],
@@ -162,24 +288,58 @@ app.add_middleware(
         "Accept",
         "Origin",
         "X-Requested-With",
+        "Content-Encoding",
+        "If-None-Match",
+        "X-Live-Events",
+        "X-Device-Id",
+        "X-Trace-Sent-At",
+        "X-Trace-Clock",
     ],
+    expose_headers=["ETag"],
+)
+
+# Added after CORS so it wraps it: preflight and error responses are
+# compressed too, and request bodies are decoded before anything reads them.
+compression_dictionary = load_dictionary(
+    settings.compression_dictionary_path, level=settings.compression_zstd_level
+)
+app.add_middleware(
+    CompressionMiddleware,
+    dictionary=compression_dictionary,
+    minimum_size=settings.compression_min_bytes,
 )
 
+# Outermost, so the timing covers compression and CORS as well
+if settings.metrics_enabled:
+    app.add_middleware(MetricsMiddleware, registry=metrics)
+
 
 # ─── Health ──────────────────────────────────────────────────────
 
 
 @app.get("/health")
 async def health_check() -> dict[str, object]:
-    """Health check endpoint with database connectivity verification."""
+    """Liveness check with per-component readiness.
+
+    Always answers while the process is up — it never waits for the
+    database to be created. Use ``/health/ready`` to gate traffic.
+    """
     result: dict[str, object] = {
         "status": "healthy",
         "environment": settings.environment,
+        "platform": host_features().to_dict(),
+        **readiness.to_dict(),
     }
+    if stats := logging_stats():
+        result["logging"] = stats
+    if not storage.pool_ready():
+        result["status"] = "starting"
+        result["database"] = readiness.status("database") or "pending"
+        return result
     try:
         pool = await storage.get_pool()
         async with pool.acquire() as conn:
-            await conn.fetchval("SELECT 1")
+            await asyncio.wait_for(conn.fetchval("SELECT 1"), timeout=2)
         result["database"] = "connected"
     except Exception as e:
         result["status"] = "degraded"
@@ -188,6 +348,120 @@ async def health_check() -> dict[str, object]:
     return result
 
 
+@app.get("/health/ready", response_model=None)
+async def readiness_check() -> dict[str, object] | JSONResponse:
+    """Readiness probe — 503 until the database and schema are up."""
+    state = readiness.to_dict()
+    if not state["ready"]:
+        return JSONResponse(state, status_code=503)
+    return state
+
+
+@app.get("/metrics", include_in_schema=False)
+async def prometheus_metrics(request: Request) -> Response:
+    """Latency histograms in the Prometheus text format.
+
+    Raises:
+        HTTPException: If metrics are disabled or the scrape token is wrong.
+    """
+    _check_metrics_access(request)
+    return Response(
+        metrics.render_prometheus(), media_type="text/plain; version=0.0.4; charset=utf-8"
+    )
+
+
+@app.get("/metrics/traces", include_in_schema=False)
+async def trace_breakdown(request: Request) -> dict[str, Any]:
+    """Where ingest → insight time goes, across every traced meeting in memory.
+
+    Raises:
+        HTTPException: If metrics are disabled or the scrape token is wrong.
+    """
+    _check_metrics_access(request)
+    return tracer.breakdown()
+
+
+@app.get("/metrics/probes", include_in_schema=False)
+async def probe_capture(request: Request, limit: int = 200) -> dict[str, Any]:
+    """Probe catalogue and what the in-process recorder has captured.
+
+    Raises:
+        HTTPException: If metrics are disabled or the scrape token is wrong.
+    """
+    _check_metrics_access(request)
+    return {"probes": probes.catalogue(), **probes.recorder.snapshot(limit=limit)}
+
+
+@app.get("/metrics/memory", include_in_schema=False)
+async def memory_breakdown(request: Request, top: int = 10) -> dict[str, Any]:
+    """Bytes per subsystem (with high-water marks and the largest sessions/users).
+
+    Raises:
+        HTTPException: If metrics are disabled or the scrape token is wrong.
+    """
+    _check_metrics_access(request)
+    return await asyncio.to_thread(memory.accountant.report, top)
+
+
+@app.get("/metrics/costs", include_in_schema=False)
+async def cost_breakdown(request: Request, top: int = 20) -> dict[str, Any]:
+    """Most expensive meetings this process has ledgered (LLM + CPU, USD).
+
+    Raises:
+        HTTPException: If metrics are disabled or the scrape token is wrong.
+    """
+    _check_metrics_access(request)
+    totals = sorted(cost_ledger.ledger.totals.items(), key=lambda kv: kv[1], reverse=True)
+    return {
+        "meetings": len(totals),
+        "total_usd": round(sum(usd for _, usd in totals), 6),
+        "top": {meeting_id: round(usd, 6) for meeting_id, usd in totals[:top]},
+    }
+
+
+@app.post("/metrics/probes", include_in_schema=False)
+async def probe_recording(request: Request, record: bool) -> dict[str, Any]:
+    """Start (clearing the last capture) or stop the probe recorder.
+
+    Raises:
+        HTTPException: If metrics are disabled or the scrape token is wrong.
+    """
+    _check_metrics_access(request)
+    if record:
+        probes.recorder.start()
+    else:
+        probes.recorder.stop()
+    return {"recording": probes.recorder.active}
+
+
+def _check_metrics_access(request: Request) -> None:
+    """Gate the operator endpoints on ``metrics_enabled`` and the scrape token."""
+    if not settings.metrics_enabled:
+        raise HTTPException(status_code=404, detail="Not Found")
+    if settings.metrics_token and not hmac.compare_digest(
+        request.headers.get("authorization", ""), f"Bearer {settings.metrics_token}"
+    ):
+        raise HTTPException(status_code=401, detail="Invalid metrics token")
+
+
+@app.get("/api/compression/dictionary")
+async def compression_dictionary_file() -> Response:
+    """Serve the shared compression dictionary.
+
+    Browsers that support Compression Dictionary Transport store it and
+    advertise ``dcz`` on later ``/api/*`` requests, so JSON responses are
+    zstd-compressed against it. Not authenticated — it holds no user data.
+    """
+    return Response(
+        content=compression_dictionary.data,
+        media_type="application/octet-stream",
+        headers={
+            "Use-As-Dictionary": f'match="/api/*", id="{compression_dictionary.id}"',
+            "Cache-Control": "public, max-age=86400",
+        },
+    )
+
+
 # ─── Auth ────────────────────────────────────────────────────────
 
 
@@ -394,6 +668,7 @@ async def auth_delete_account(
     deleted = await storage.delete_user_account(current_user["user_id"])
     if not deleted:
         raise HTTPException(status_code=404, detail="Account not found")
+    revoke_user_tokens(current_user["user_id"])
     return {"status": "deleted", "message": "Account and all data permanently removed"}
 
 
@@ -426,31 +701,149 @@ async def list_meetings(
     return {"meetings": meetings, "limit": limit, "offset": offset}
 
 
-@app.get("/api/meetings/{meeting_id}")
+@app.get("/api/meetings/sync")
+@limiter.limit("60/minute")
+async def sync_meetings(
+    request: Request,
+    since: int = 0,
+    limit: int = 200,
+    after: str | None = None,
+    current_user: dict[str, Any] = _auth_dep,
+) -> dict[str, Any]:
+    """Get meeting list changes since the client's last sync.
+
+    Clients keep the returned ``cursor`` and send it back as ``since``;
+    an unchanged history costs one indexed query and a tiny response.
+    A full snapshot is paged: while ``has_more``, send the page's
+    ``cursor`` and ``after`` back to get the next one.
+
+    Args:
+        since: Cursor from the previous sync; 0 for a full snapshot.
+        limit: Maximum changes per page (capped at 500).
+        after: ``after`` from the previous snapshot page.
+        current_user: Injected by auth dependency.
+
+    Returns:
+        Dict with changed meetings, deleted IDs, next cursor, and has_more
+        (plus ``after`` on snapshot pages).
+    """
+    return await storage.sync_meetings(
+        current_user["user_id"],
+        since=max(since, 0),
+        limit=min(max(limit, 1), 500),
+        after=after,
+    )
+
+
+def _meeting_etag(version: int) -> str:
+    """Weak ETag for a meeting version (weak: bodies vary by Content-Encoding)."""
+    return f'W/"v{version}"'
+
+
+@app.get("/api/meetings/{meeting_id}", response_model=None)
 @limiter.limit("30/minute")
 async def get_meeting(
     request: Request,
     meeting_id: str,
     current_user: dict[str, Any] = _auth_dep,
-) -> dict[str, Any]:
+) -> dict[str, Any] | Response:
     """Get a single meeting with transcript, insights, and summary.
 
+    Supports ``If-None-Match``: when the client already has the current
+    version, returns 304 without loading or serializing the meeting.
+
     Args:
         meeting_id: The unique meeting identifier.
         current_user: Injected by auth dependency.
 
     Returns:
-        Complete meeting data.
+        Complete meeting data (with an ETag), or an empty 304.
 
     Raises:
         HTTPException: If meeting not found or not owned by user.
     """
+    if_none_match = request.headers.get("if-none-match")
+    if if_none_match:
+        current = await storage.get_meeting_version(meeting_id)
+        if not current or (current["user_id"] and current["user_id"] != current_user["user_id"]):
+            raise HTTPException(status_code=404, detail="Meeting not found")
+        etag = _meeting_etag(current["version"])
+        if etag in (tag.strip() for tag in if_none_match.split(",")):
+            return Response(status_code=304, headers={"ETag": etag})
+
     meeting = await storage.get_meeting(meeting_id)
     if not meeting:
         raise HTTPException(status_code=404, detail="Meeting not found")
     if meeting.get("user_id") and meeting["user_id"] != current_user["user_id"]:
         raise HTTPException(status_code=404, detail="Meeting not found")
-    return meeting
+    return JSONResponse(
+        jsonable_encoder(meeting),
+        headers={"ETag": _meeting_etag(meeting.get("version", 0))},
+    )
+
+
+@app.get("/api/meetings/{meeting_id}/report.pdf")
+@limiter.limit("10/minute")
+async def get_meeting_report_pdf(
+    request: Request,
+    meeting_id: str,
+    full: bool = True,
+    current_user: dict[str, Any] = _auth_dep,
+) -> StreamingResponse:
+    """Stream the meeting's executive report as a PDF.
+
+    Pages are rendered and sent one at a time while the transcript is
+    read in keyset pages, so memory stays bounded for long meetings.
+
+    Args:
+        meeting_id: The unique meeting identifier.
+        full: Include AI insights and the transcript appendix.
+        current_user: Injected by auth dependency.
+
+    Returns:
+        Streaming ``application/pdf`` response.
+
+    Raises:
+        HTTPException: 404 if meeting not found or not owned by user;
+            422 if it has text outside the PDF fonts' Western European
+            character set (the app renders those reports itself).
+    """
+    meeting = await storage.get_meeting(meeting_id, include_segments=False)
+    if not meeting:
+        raise HTTPException(status_code=404, detail="Meeting not found")
+    if meeting.get("user_id") and meeting["user_id"] != current_user["user_id"]:
+        raise HTTPException(status_code=404, detail="Meeting not found")
+
+    # Checked up front — the response can't turn into an error once the
+    # PDF has started streaming. Only segments with characters above
+    # Latin-1 can fail, so only those are read.
+    suspects = storage.iter_segments(meeting_id, beyond_latin1=True) if full else None
+    async with _report_exports:
+        renderable = await report_renderable(meeting, suspects)
+    if not renderable:
+        raise HTTPException(
+            status_code=422,
+            detail="Report has text the server PDF fonts can't render",
+        )
+
+    segments = storage.iter_segments(meeting_id) if full else None
+    filename = report_filename(str(meeting.get("title") or "meeting"))
+    return StreamingResponse(
+        _export_slot(stream_meeting_report(meeting, segments, full_export=full)),
+        media_type="application/pdf",
+        headers={"Content-Disposition": f'attachment; filename="{filename}"'},
+    )
+
+
+async def _export_slot(chunks: AsyncIterator[bytes]) -> AsyncIterator[bytes]:
+    """Render a report only while holding one of the export slots.
+
+    Taken when the body starts streaming, so a download that never
+    starts holds nothing.
+    """
+    async with _report_exports:
+        async for chunk in chunks:
+            yield chunk
 
 
 @app.delete("/api/meetings/{meeting_id}")
@@ -606,6 +999,8 @@ async def reset_password(request: Request, body: ResetPasswordRequest) -> dict[s
             user_id,
         )
 
+    # Sessions opened with the old password must not outlive the reset
+    revoke_user_tokens(user_id)
     logger.info("password_reset_completed", user_id=user_id)
     return {"message": "Password has been reset successfully."}
 
@@ -657,6 +1052,10 @@ async def update_action_item(
     updated = await storage.update_action_item(item_id, status)
     if not updated:
         raise HTTPException(status_code=404, detail="Action item not found")
+    # Other devices of the same user update their checklists live
+    event_hub.publish(
+        current_user["user_id"], events.ACTION_ITEM, {"id": item_id, "status": status}
+    )
     return {"id": item_id, "status": status}
 
 
@@ -677,13 +1076,36 @@ async def get_stats(
     return await storage.get_stats(user_id=current_user["user_id"])
 
 
+@app.get("/api/usage")
+@limiter.limit("30/minute")
+async def get_usage(
+    request: Request,
+    current_user: dict[str, Any] = _auth_dep,
+) -> dict[str, Any]:
+    """This month's usage against the user's quotas (server-side counters).
+
+    Returns:
+        Month, tier, and used/limit for minutes, LLM dollars and summaries.
+    """
+    return usage.counters.usage(current_user["user_id"])
+
+
 # ─── Meeting AI (REST — replaces WebSocket) ─────────────────────
 
 
+class TranscriptSegment(BaseModel):
+    """One client segment; keys other than ``id`` pass through as sent."""
+
+    model_config = ConfigDict(extra="allow")
+
+    # Stored as the segment's index, a Postgres int
+    id: int | None = Field(default=None, ge=0, le=MAX_SEGMENT_ID)
+
+
 class TranscriptRequest(BaseModel):
     """Transcript ingestion request."""
 
-    segments: list[dict[str, Any]]
+    segments: list[TranscriptSegment]
     language: str = "es"
 
 
@@ -707,26 +1129,167 @@ async def ingest_transcript(
     request: Request,
     meeting_id: str,
     body: TranscriptRequest,
+    persist_only: bool = False,
     current_user: dict[str, Any] = _auth_dep,
 ) -> dict[str, Any]:
     """Ingest transcript segments and trigger AI screening.
 
     Called periodically by the client with on-device STT results.
+    Segments carrying a client ``id`` are stored once per meeting, so a
+    retried batch is neither duplicated nor screened again. A client that
+    reads ``/api/events`` sends ``X-Live-Events: 1`` to have screening
+    results pushed there instead of waiting for them in the response.
 
     Args:
         meeting_id: The meeting to add transcript to.
         body: Transcript segments and language.
+        persist_only: Only store the segments (late uploads for a meeting
+            that has ended): no live session, no screening.
         current_user: Injected by auth dependency.
 
     Returns:
-        Screening/analysis results if triggered.
+        Screening/analysis results if triggered, plus the server timing
+        the client echoes for clock-offset estimation. Over a monthly
+        quota the segments are still stored but not screened, and
+        ``quota_exceeded`` says why: a 402 here would leave the client
+        retrying a meeting that's already in progress.
     """
-    return await meeting_manager.ingest_transcript(
-        meeting_id=meeting_id,
-        segments=body.segments,
-        language=body.language,
-        user_id=current_user.get("user_id"),
+    user_id = current_user.get("user_id")
+    trace = _begin_trace(request, meeting_id, current_user)
+    segments = [seg.model_dump(exclude_unset=True) for seg in body.segments]
+    trace.set_segments(segments)
+    result = await _ingest(
+        meeting_id, segments, body.language, user_id, persist_only, _wants_push(request)
     )
+    return {**result, "trace": trace.response_timing()}
+
+
+@app.post("/api/meetings/{meeting_id}/transcript/binary")
+@limiter.limit("30/minute")
+async def ingest_transcript_binary(
+    request: Request,
+    meeting_id: str,
+    persist_only: bool = False,
+    current_user: dict[str, Any] = _auth_dep,
+) -> dict[str, Any]:
+    """Ingest a binary transcript batch (see ``core.transcript_codec``).
+
+    Same behavior as the JSON endpoint, without per-segment JSON parsing
+    and pydantic validation.
+
+    Args:
+        meeting_id: The meeting to add transcript to.
+        persist_only: Only store the segments (see the JSON endpoint).
+        current_user: Injected by auth dependency.
+
+    Returns:
+        Screening/analysis results if triggered, plus trace timing.
+
+    Raises:
+        HTTPException: If the batch is malformed.
+    """
+    trace = _begin_trace(request, meeting_id, current_user)
+    body = await request.body()
+    try:
+        with (
+            tracing.span("request_parse"),
+            cost_ledger.meeting(meeting_id),
+            cost_ledger.cpu("parse"),
+        ):
+            segments, language = decode_batch(body)
+    except TranscriptDecodeError as e:
+        raise HTTPException(status_code=400, detail=f"Invalid transcript batch: {e}") from e
+
+    user_id = current_user.get("user_id")
+    trace.set_segments(segments)
+    result = await _ingest(
+        meeting_id, segments, language, user_id, persist_only, _wants_push(request)
+    )
+    return {**result, "trace": trace.response_timing()}
+
+
+async def _ingest(
+    meeting_id: str,
+    segments: list[dict[str, Any]],
+    language: str,
+    user_id: str | None,
+    persist_only: bool,
+    push: bool,
+) -> dict[str, Any]:
+    """Hand a decoded batch to the live session or, late, to storage only."""
+    minutes = usage.minutes_of(segments)
+    if persist_only:
+        current = await storage.get_meeting_version(meeting_id)
+        if current and current["user_id"] and current["user_id"] != user_id:
+            raise HTTPException(status_code=404, detail="Meeting not found")
+        result = await meeting_manager.persist_transcript(
+            meeting_id=meeting_id,
+            segments=segments,
+            language=language,
+            user_id=user_id,
+        )
+    else:
+        over = usage.exceeded(user_id, minutes=minutes)
+        result = await meeting_manager.ingest_transcript(
+            meeting_id=meeting_id,
+            segments=segments,
+            language=language,
+            user_id=user_id,
+            screen=over is None,
+            push=push,
+        )
+        if over:
+            result["quota_exceeded"] = over
+    if user_id:
+        usage.counters.add(user_id, minutes=minutes)
+    return result
+
+
+def _wants_push(request: Request) -> bool:
+    """Whether the sending client reads the live event stream."""
+    return request.headers.get("x-live-events") == "1"
+
+
+def _begin_trace(
+    request: Request, meeting_id: str, current_user: dict[str, Any]
+) -> tracing.BatchTrace:
+    """Open the ingest trace from the client's trace headers."""
+    user_id = current_user.get("user_id")
+    context = TraceContext.from_headers(request.headers, fallback_device=user_id or "anonymous")
+    return tracer.begin(meeting_id, user_id, context)
+
+
+@app.get("/api/meetings/{meeting_id}/trace", response_model=None)
+@limiter.limit("30/minute")
+async def meeting_trace(
+    request: Request,
+    meeting_id: str,
+    format: str = "json",  # noqa: A002 — query parameter name
+    current_user: dict[str, Any] = _auth_dep,
+) -> dict[str, Any] | Response:
+    """Latency waterfall of a meeting's recent ingest batches.
+
+    Each batch shows the client batching wait, the network leg (once the
+    device's clock offset is known) and every server span, with a stage
+    breakdown across the meeting's batches.
+
+    Args:
+        meeting_id: The meeting to inspect.
+        format: ``json`` or ``text`` (a plain-text waterfall).
+        current_user: Injected by auth dependency.
+
+    Returns:
+        The waterfall as JSON or text.
+
+    Raises:
+        HTTPException: If this process holds no trace of the user's meeting.
+    """
+    if tracer.owner(meeting_id) != current_user["user_id"]:
+        raise HTTPException(status_code=404, detail="No trace for this meeting")
+    view = tracer.waterfall(meeting_id)
+    if format == "text":
+        return Response(render_waterfall(view), media_type="text/plain; charset=utf-8")
+    return view
 
 
 @app.post("/api/meetings/{meeting_id}/copilot")
@@ -746,11 +1309,16 @@ async def copilot_query(
 
     Returns:
         AI answer with metadata.
+
+    Raises:
+        HTTPException: 402 if a monthly quota is used up.
     """
+    usage.enforce(current_user.get("user_id"))
     return await meeting_manager.run_copilot(
         meeting_id=meeting_id,
         question=body.question,
         transcript_context=body.transcript_context,
+        user_id=current_user.get("user_id"),
     )
 
 
@@ -760,7 +1328,6 @@ async def generate_summary(
     request: Request,
     meeting_id: str,
     body: SummaryRequest,
-    background_tasks: BackgroundTasks,
     current_user: dict[str, Any] = _auth_dep,
 ) -> dict[str, Any]:
     """Generate a post-meeting summary and email it to the user.
@@ -768,24 +1335,29 @@ async def generate_summary(
     Args:
         meeting_id: The meeting to summarize.
         body: Full transcript and language.
-        background_tasks: FastAPI background task runner.
         current_user: Injected by auth dependency.
 
     Returns:
         Summary with key points, action items, and decisions.
+
+    Raises:
+        HTTPException: 402 if a monthly quota is used up.
     """
+    usage.enforce(current_user["user_id"], summary=True)
     result = await meeting_manager.run_summary(
         meeting_id=meeting_id,
         full_transcript=body.full_transcript,
         language=body.language,
+        user_id=current_user["user_id"],
     )
+    if not result.get("error"):
+        usage.counters.add(current_user["user_id"], summaries=1)
 
-    # Fire-and-forget email — never blocks the API response
+    # Queued email — delivery happens on the send queue, never blocks the response
     user = await storage.get_user(current_user["user_id"])
     if user and user.get("email_notifications_enabled", True):
         meeting = await storage.get_meeting(meeting_id)
-        background_tasks.add_task(
-            email_service.send_meeting_summary,
+        await email_service.send_meeting_summary(
             user_email=user["email"],
             user_name=user.get("name", ""),
             meeting_id=meeting_id,
@@ -799,6 +1371,43 @@ async def generate_summary(
     return result
 
 
+# ─── Live Events ─────────────────────────────────────────────────
+
+
+@app.get("/api/events")
+@limiter.limit("30/minute")
+async def live_events(
+    request: Request,
+    current_user: dict[str, Any] = _auth_dep,
+) -> StreamingResponse:
+    """Server-Sent Events stream of the user's live meeting events.
+
+    One connection per device carries every meeting: screening results,
+    insights, summary progress, and action-item updates are pushed as
+    soon as they are produced. Reconnecting clients send
+    ``Last-Event-ID`` to receive events missed in between.
+
+    Args:
+        current_user: Injected by auth dependency.
+
+    Returns:
+        ``text/event-stream`` response.
+    """
+    sub = event_hub.subscribe(
+        current_user["user_id"],
+        last_event_id=parse_last_event_id(request.headers.get("last-event-id")),
+    )
+    return StreamingResponse(
+        sse_stream(
+            sub,
+            heartbeat_s=settings.event_heartbeat_seconds,
+            is_disconnected=request.is_disconnected,
+        ),
+        media_type="text/event-stream",
+        headers={"Cache-Control": "no-cache", "X-Accel-Buffering": "no"},
+    )
+
+
 # ─── User Settings ───────────────────────────────────────────────
 
 
@@ -15,6 +15,7 @@ import boto3
 import structlog
 
 from meetmind.config.settings import settings
+from meetmind.core.cost_ledger import ledger
 
 logger = structlog.get_logger(__name__)
 
@@ -52,7 +53,8 @@ class BedrockProvider:
             system_prompt: System instruction.
 
         Returns:
-            Dict with 'content', 'input_tokens', 'output_tokens', 'latency_ms'.
+            Dict with 'content', 'input_tokens' (uncached), 'cached_tokens',
+            'output_tokens', 'latency_ms'.
         """
         start_time = time.monotonic()
 
@@ -78,8 +80,11 @@ class BedrockProvider:
         result = json.loads(response["body"].read())
         latency_ms = (time.monotonic() - start_time) * 1000
 
-        input_tokens = result.get("usage", {}).get("input_tokens", 0)
-        output_tokens = result.get("usage", {}).get("output_tokens", 0)
+        usage = result.get("usage", {})
+        input_tokens = usage.get("input_tokens", 0)  # excludes cache reads and writes
+        output_tokens = usage.get("output_tokens", 0)
+        cached_tokens = usage.get("cache_read_input_tokens", 0)
+        cache_write_tokens = usage.get("cache_creation_input_tokens", 0)
 
         self._total_input_tokens += input_tokens
         self._total_output_tokens += output_tokens
@@ -90,9 +95,20 @@ class BedrockProvider:
             model_id=model_id,
             input_tokens=input_tokens,
             output_tokens=output_tokens,
+            cached_tokens=cached_tokens,
+            cache_write_tokens=cache_write_tokens,
             latency_ms=round(latency_ms, 1),
             total_requests=self._total_requests,
         )
+        ledger.record_llm(
+            "bedrock",
+            model_id,
+            input_tokens=input_tokens,
+            output_tokens=output_tokens,
+            cached_tokens=cached_tokens,
+            cache_write_tokens=cache_write_tokens,
+            latency_ms=latency_ms,
+        )
 
         content = ""
         if result.get("content"):
@@ -102,6 +118,7 @@ class BedrockProvider:
             "content": content,
             "input_tokens": input_tokens,
             "output_tokens": output_tokens,
+            "cached_tokens": cached_tokens,
             "latency_ms": round(latency_ms, 1),
             "model_id": model_id,
         }
@@ -14,6 +14,7 @@ import structlog
 from openai import AsyncOpenAI
 
 from meetmind.config.settings import settings
+from meetmind.core.cost_ledger import ledger
 
 logger = structlog.get_logger(__name__)
 
@@ -56,7 +57,8 @@ class OpenAIProvider:
             system_prompt: System instruction.
 
         Returns:
-            Dict with 'content', 'input_tokens', 'output_tokens', 'latency_ms'.
+            Dict with 'content', 'input_tokens' (uncached), 'cached_tokens',
+            'output_tokens', 'latency_ms'.
         """
         start_time = time.monotonic()
 
@@ -80,8 +82,12 @@ class OpenAIProvider:
 
         input_tokens = 0
         output_tokens = 0
+        cached_tokens = 0
         if response.usage:
-            input_tokens = response.usage.prompt_tokens
+            details = response.usage.prompt_tokens_details
+            cached_tokens = (details.cached_tokens or 0) if details else 0
+            # prompt_tokens includes the cached part; bill it separately
+            input_tokens = response.usage.prompt_tokens - cached_tokens
             output_tokens = response.usage.completion_tokens
 
         self._total_input_tokens += input_tokens
@@ -93,14 +99,24 @@ class OpenAIProvider:
             model_id=model_id,
             input_tokens=input_tokens,
             output_tokens=output_tokens,
+            cached_tokens=cached_tokens,
             latency_ms=round(latency_ms, 1),
             total_requests=self._total_requests,
         )
+        ledger.record_llm(
+            "openai",
+            model_id,
+            input_tokens=input_tokens,
+            output_tokens=output_tokens,
+            cached_tokens=cached_tokens,
+            latency_ms=latency_ms,
+        )
 
         return {
             "content": content,
             "input_tokens": input_tokens,
             "output_tokens": output_tokens,
+            "cached_tokens": cached_tokens,
             "latency_ms": round(latency_ms, 1),
             "model_id": model_id,
         }
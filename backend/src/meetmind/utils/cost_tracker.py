@@ -1,8 +1,8 @@
 """Cost Tracker — per-connection token usage and USD cost tracking.
 
 Tracks token consumption with model-level granularity, calculates
-estimated USD cost using Bedrock pricing, and enforces configurable
-session budget limits.
+estimated USD cost from the active provider's price table, and enforces
+configurable session budget limits.
 """
 
 from __future__ import annotations
@@ -20,12 +20,62 @@ class BudgetExceededError(Exception):
     """Raised when session budget limit is reached."""
 
 
-# Bedrock pricing per 1M tokens (USD) — Jan 2025
-BEDROCK_PRICING: dict[str, dict[str, float]] = {
-    "haiku": {"input": 0.25, "output": 1.25},
-    "sonnet": {"input": 3.00, "output": 15.00},
-    "opus": {"input": 15.00, "output": 75.00},
+# Per-provider pricing per 1M tokens (USD). ``cached_input`` is the rate
+# for prompt tokens served from the provider's prompt cache, ``cache_write``
+# for prompt tokens written to it (Anthropic bills writes at 1.25x input;
+# OpenAI-compatible endpoints cache for free and don't report writes).
+PRICING: dict[str, dict[str, dict[str, float]]] = {
+    # Bedrock — Jan 2025
+    "bedrock": {
+        "haiku": {"input": 0.25, "output": 1.25, "cached_input": 0.03, "cache_write": 0.30},
+        "sonnet": {"input": 3.00, "output": 15.00, "cached_input": 0.30, "cache_write": 3.75},
+        "opus": {"input": 15.00, "output": 75.00, "cached_input": 1.50, "cache_write": 18.75},
+    },
+    # OpenAI-compatible endpoint (Groq by default, or OpenAI itself)
+    "openai": {
+        "llama-3.1-8b-instant": {"input": 0.05, "output": 0.08, "cached_input": 0.05},
+        "llama-3.3-70b-versatile": {"input": 0.59, "output": 0.79, "cached_input": 0.59},
+        "gpt-4o-mini": {"input": 0.15, "output": 0.60, "cached_input": 0.075},
+        "gpt-4o": {"input": 2.50, "output": 10.00, "cached_input": 1.25},
+    },
 }
+BEDROCK_PRICING = PRICING["bedrock"]
+# Unlisted models are priced at the provider's most expensive listed tier
+_FALLBACK_TIER = {"bedrock": "sonnet", "openai": "gpt-4o"}
+
+
+def price_tier(provider: str, model_id: str) -> str:
+    """Price-table key for a model on a provider.
+
+    Bedrock models map to their family tier; other providers use the
+    longest listed model name contained in the ID (so ``gpt-4o-mini-2024``
+    is ``gpt-4o-mini``, not ``gpt-4o``), else the provider's fallback.
+    """
+    if provider == "bedrock":
+        return _classify_model(model_id)
+    table = PRICING.get(provider, {})
+    model_lower = model_id.lower()
+    matches = [name for name in table if name in model_lower]
+    return max(matches, key=len) if matches else _FALLBACK_TIER.get(provider, model_lower)
+
+
+def price_usd(
+    provider: str,
+    tier: str,
+    input_tokens: int,
+    output_tokens: int,
+    cached_tokens: int = 0,
+    cache_write_tokens: int = 0,
+) -> float:
+    """USD for one call (``input_tokens`` excludes cache reads and writes)."""
+    table = PRICING.get(provider, BEDROCK_PRICING)
+    pricing = table.get(tier) or table[_FALLBACK_TIER.get(provider, "sonnet")]
+    return (
+        input_tokens * pricing["input"]
+        + cached_tokens * pricing["cached_input"]
+        + cache_write_tokens * pricing.get("cache_write", pricing["input"])
+        + output_tokens * pricing["output"]
+    ) / 1_000_000
 
 
 def _classify_model(model_id: str) -> str:
@@ -53,14 +103,18 @@ class ModelUsage:
     input_tokens: int = 0
     output_tokens: int = 0
     requests: int = 0
+    cached_tokens: int = 0
+    provider: str = "bedrock"
 
     @property
     def cost_usd(self) -> float:
         """Calculate USD cost for this model tier."""
-        pricing = BEDROCK_PRICING.get(self.tier, BEDROCK_PRICING["sonnet"])
-        input_cost = (self.input_tokens / 1_000_000) * pricing["input"]
-        output_cost = (self.output_tokens / 1_000_000) * pricing["output"]
-        return round(input_cost + output_cost, 6)
+        return round(
+            price_usd(
+                self.provider, self.tier, self.input_tokens, self.output_tokens, self.cached_tokens
+            ),
+            6,
+        )
 
 
 class CostTracker:
@@ -70,13 +124,15 @@ class CostTracker:
     USD cost estimates. Sends budget warnings when approaching limits.
     """
 
-    def __init__(self, budget_usd: float = 1.00) -> None:
+    def __init__(self, budget_usd: float = 1.00, provider: str = "bedrock") -> None:
         """Initialize cost tracker.
 
         Args:
             budget_usd: Maximum USD budget for this session.
+            provider: Whose price table applies (``settings.llm_provider``).
         """
         self._budget_usd = budget_usd
+        self._provider = provider
         self._usage: dict[str, ModelUsage] = {}
         self._start_time = time.monotonic()
         self._total_requests = 0
@@ -87,25 +143,28 @@ class CostTracker:
         model_id: str,
         input_tokens: int,
         output_tokens: int,
+        cached_tokens: int = 0,
     ) -> None:
         """Record token usage from an LLM call.
 
         Args:
-            model_id: Bedrock model identifier.
-            input_tokens: Number of input tokens consumed.
+            model_id: Provider model identifier.
+            input_tokens: Number of uncached input tokens consumed.
             output_tokens: Number of output tokens generated.
+            cached_tokens: Input tokens served from the prompt cache.
 
         Raises:
             BudgetExceededError: If session budget would be exceeded.
         """
-        tier = _classify_model(model_id)
+        tier = price_tier(self._provider, model_id)
 
         if tier not in self._usage:
-            self._usage[tier] = ModelUsage(tier=tier)
+            self._usage[tier] = ModelUsage(tier=tier, provider=self._provider)
 
         usage = self._usage[tier]
         usage.input_tokens += input_tokens
         usage.output_tokens += output_tokens
+        usage.cached_tokens += cached_tokens
         usage.requests += 1
         self._total_requests += 1
 
@@ -169,6 +228,43 @@ class CostTracker:
         """Session duration in seconds."""
         return round(time.monotonic() - self._start_time, 1)
 
+    def export_state(self) -> dict[str, Any]:
+        """Serialize counters for a deploy snapshot."""
+        return {
+            "budget": self._budget_usd,
+            "provider": self._provider,
+            "usage": [
+                [u.tier, u.input_tokens, u.output_tokens, u.requests, u.cached_tokens]
+                for u in self._usage.values()
+            ],
+            "requests": self._total_requests,
+            "savings": self._compression_savings,
+            "elapsed": time.monotonic() - self._start_time,
+        }
+
+    @classmethod
+    def from_state(cls, state: dict[str, Any]) -> CostTracker:
+        """Rebuild a tracker from :meth:`export_state` output.
+
+        Args:
+            state: Exported state.
+
+        Returns:
+            Tracker with the same usage, budget, and session clock.
+        """
+        # Snapshots from before provider pricing were all Bedrock-priced
+        provider = str(state.get("provider", "bedrock"))
+        tracker = cls(budget_usd=float(state["budget"]), provider=provider)
+        for tier, input_tokens, output_tokens, requests, *rest in state["usage"]:
+            cached = int(rest[0]) if rest else 0
+            tracker._usage[tier] = ModelUsage(
+                tier, input_tokens, output_tokens, requests, cached, provider
+            )
+        tracker._total_requests = int(state["requests"])
+        tracker._compression_savings = int(state["savings"])
+        tracker._start_time = time.monotonic() - float(state["elapsed"])
+        return tracker
+
     def to_dict(self) -> dict[str, Any]:
         """Convert to dictionary for WebSocket broadcasting.
 
@@ -189,6 +285,7 @@ class CostTracker:
                 tier: {
                     "input_tokens": u.input_tokens,
                     "output_tokens": u.output_tokens,
+                    "cached_tokens": u.cached_tokens,
                     "requests": u.requests,
                     "cost_usd": u.cost_usd,
                 }
@@ -0,0 +1,91 @@
+"""CPU features — which instruction-set tier this instance runs on.
+
+The backend image is built for both x86-64 and arm64 (Graviton), and the
+compiled dependencies (zstandard, asyncpg, uvloop, httptools) pick their
+fastest code path at import time. This module reports what the host
+offers so ``/health`` and the startup log show which tier a given
+instance type actually gets — e.g. AVX-512 on c6i, SVE on c7g, plain
+SSE4 on older t3 hosts.
+"""
+
+from __future__ import annotations
+
+import os
+import platform
+from dataclasses import dataclass
+from functools import cache
+from pathlib import Path
+
+# Best tier first; a tier applies when all of its flags are present
+_X86_TIERS: list[tuple[str, frozenset[str]]] = [
+    ("avx512", frozenset({"avx512f", "avx512bw", "avx512vl"})),
+    ("avx2", frozenset({"avx2", "fma", "bmi2"})),
+    ("sse4", frozenset({"sse4_2", "popcnt"})),
+]
+_ARM_TIERS: list[tuple[str, frozenset[str]]] = [
+    ("sve2", frozenset({"sve2"})),
+    ("sve", frozenset({"sve"})),
+    ("neon", frozenset({"asimd"})),
+]
+
+
+@dataclass(frozen=True)
+class CpuFeatures:
+    """Host architecture and best available ISA tier."""
+
+    arch: str  # "x86_64" | "arm64" | raw machine name
+    isa: str  # e.g. "avx2", "neon", "baseline"
+    cpus: int
+
+    def to_dict(self) -> dict[str, object]:
+        """Convert to dictionary for the health endpoint."""
+        return {"arch": self.arch, "isa": self.isa, "cpus": self.cpus}
+
+
+def parse_cpuinfo_flags(cpuinfo: str) -> frozenset[str]:
+    """Extract the first CPU's feature flags from ``/proc/cpuinfo`` text.
+
+    x86 kernels list them under ``flags``, arm64 kernels under ``Features``.
+    """
+    for line in cpuinfo.splitlines():
+        key, _, value = line.partition(":")
+        if key.strip() in ("flags", "Features"):
+            return frozenset(value.split())
+    return frozenset()
+
+
+def detect(machine: str | None = None, cpuinfo: str | None = None) -> CpuFeatures:
+    """Classify a host (defaults to the current one).
+
+    Args:
+        machine: ``platform.machine()`` value.
+        cpuinfo: ``/proc/cpuinfo`` contents (empty off Linux).
+
+    Returns:
+        Detected features; ``isa`` is ``"baseline"`` when nothing is known.
+    """
+    machine = (machine or platform.machine()).lower()
+    if cpuinfo is None:
+        try:
+            cpuinfo = Path("/proc/cpuinfo").read_text()
+        except OSError:
+            cpuinfo = ""
+    flags = parse_cpuinfo_flags(cpuinfo)
+
+    if machine in ("x86_64", "amd64"):
+        arch, tiers = "x86_64", _X86_TIERS
+    elif machine in ("aarch64", "arm64"):
+        # NEON is mandatory on arm64 even when /proc/cpuinfo is unavailable
+        arch, tiers = "arm64", _ARM_TIERS
+        flags = flags | {"asimd"}
+    else:
+        arch, tiers = machine, []
+
+    isa = next((name for name, needed in tiers if needed <= flags), "baseline")
+    return CpuFeatures(arch=arch, isa=isa, cpus=os.cpu_count() or 1)
+
+
+@cache
+def host_features() -> CpuFeatures:
+    """Features of the current host (probed once)."""
+    return detect()
@@ -0,0 +1,217 @@
+"""Email Send Queue — batched, bounded-concurrency SES delivery with retries.
+
+Summary emails used to go out one blocking boto3 call at a time on the
+event loop's default executor, so a burst of emails after a busy hour
+competed with every other ``run_in_executor`` user. Jobs now go through
+a bounded asyncio queue drained in batches onto a small dedicated thread
+pool, with exponential-backoff retries for throttling and transient
+network errors.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import contextlib
+import time
+from concurrent.futures import ThreadPoolExecutor
+from dataclasses import dataclass, field
+from typing import TYPE_CHECKING, Any
+
+import structlog
+from botocore.exceptions import BotoCoreError, ClientError
+
+from meetmind.core.metrics import metrics
+
+if TYPE_CHECKING:
+    from collections.abc import Callable
+
+logger = structlog.get_logger(__name__)
+
+# SES error codes worth retrying — everything else fails fast
+RETRYABLE_ERROR_CODES = frozenset(
+    {"Throttling", "ThrottlingException", "ServiceUnavailable", "InternalFailure"}
+)
+
+
+@dataclass(frozen=True)
+class EmailJob:
+    """A fully rendered email waiting to be sent."""
+
+    to_email: str
+    subject: str
+    html_body: str
+    plain_body: str
+    meeting_id: str = ""
+    queued_at: float = field(default_factory=time.perf_counter, compare=False)
+
+
+def is_retryable(exc: BaseException) -> bool:
+    """Decide whether a send failure is transient.
+
+    Args:
+        exc: Exception raised by the send function.
+
+    Returns:
+        True for throttling, SES 5xx, and connection-level errors.
+    """
+    if isinstance(exc, ClientError):
+        code = exc.response.get("Error", {}).get("Code", "")
+        return code in RETRYABLE_ERROR_CODES
+    return isinstance(exc, BotoCoreError | ConnectionError | TimeoutError)
+
+
+class EmailSendQueue:
+    """Bounded async queue that delivers emails in batches.
+
+    The send function is blocking (boto3) and runs on a dedicated
+    thread pool sized to ``concurrency``, never on the shared default
+    executor. Any object with the same call signature works, so tests
+    can plug in a local SES stand-in.
+    """
+
+    def __init__(
+        self,
+        send: Callable[[EmailJob], None],
+        *,
+        concurrency: int = 4,
+        batch_size: int = 10,
+        max_retries: int = 3,
+        backoff_base_s: float = 0.5,
+        max_queued: int = 1000,
+    ) -> None:
+        """Initialize the send queue.
+
+        Args:
+            send: Blocking function that delivers one email.
+            concurrency: Maximum emails in flight at once.
+            batch_size: Maximum jobs pulled from the queue per batch.
+            max_retries: Retries per job for transient failures.
+            backoff_base_s: First retry delay; doubles on each attempt.
+            max_queued: Queue capacity before new jobs are rejected.
+        """
+        self._send = send
+        self._concurrency = concurrency
+        self._batch_size = batch_size
+        self._max_retries = max_retries
+        self._backoff_base_s = backoff_base_s
+        self._max_queued = max_queued
+        self._queue: asyncio.Queue[EmailJob] | None = None
+        self._executor: ThreadPoolExecutor | None = None
+        self._dispatcher: asyncio.Task[None] | None = None
+        self._sent = 0
+        self._failed = 0
+        self._retried = 0
+        self._rejected = 0
+
+    def _start(self) -> asyncio.Queue[EmailJob]:
+        """Lazily create the queue, thread pool, and dispatcher task."""
+        if self._queue is None or self._dispatcher is None or self._dispatcher.done():
+            self._queue = asyncio.Queue(maxsize=self._max_queued)
+            if self._executor is None:
+                self._executor = ThreadPoolExecutor(
+                    max_workers=self._concurrency,
+                    thread_name_prefix="email-send",
+                )
+            self._dispatcher = asyncio.create_task(self._run(self._queue))
+        return self._queue
+
+    async def submit(self, job: EmailJob) -> bool:
+        """Queue an email for delivery without waiting for it to send.
+
+        Args:
+            job: Rendered email.
+
+        Returns:
+            True if queued, False if the queue is full.
+        """
+        queue = self._start()
+        try:
+            queue.put_nowait(job)
+        except asyncio.QueueFull:
+            self._rejected += 1
+            logger.error("email_queue_full", meeting_id=job.meeting_id, queued=queue.qsize())
+            return False
+        return True
+
+    async def _run(self, queue: asyncio.Queue[EmailJob]) -> None:
+        """Dispatcher loop — pull a batch, send it, repeat."""
+        while True:
+            batch = [await queue.get()]
+            while len(batch) < self._batch_size and not queue.empty():
+                batch.append(queue.get_nowait())
+
+            await asyncio.gather(*(self._deliver(job) for job in batch))
+            for _ in batch:
+                queue.task_done()
+
+    async def _deliver(self, job: EmailJob) -> None:
+        """Send one job on the dedicated pool, retrying transient errors."""
+        metrics.stage("email_queue_wait").observe(time.perf_counter() - job.queued_at)
+        loop = asyncio.get_running_loop()
+        for attempt in range(self._max_retries + 1):
+            try:
+                await loop.run_in_executor(self._executor, self._send, job)
+            except Exception as e:
+                if attempt < self._max_retries and is_retryable(e):
+                    self._retried += 1
+                    await asyncio.sleep(self._backoff_base_s * (2**attempt))
+                    continue
+                self._failed += 1
+                logger.error(
+                    "email_send_failed",
+                    meeting_id=job.meeting_id,
+                    attempts=attempt + 1,
+                    error=str(e),
+                )
+                return
+            self._sent += 1
+            logger.info(
+                "email_sent",
+                meeting_id=job.meeting_id,
+                email=job.to_email[:3] + "***",  # partial for privacy
+                attempts=attempt + 1,
+            )
+            return
+
+    async def drain(self) -> None:
+        """Wait until every queued job has been sent or has failed."""
+        if self._queue is not None and self._dispatcher is not None:
+            await self._queue.join()
+
+    async def close(self, timeout: float = 10.0) -> None:
+        """Drain pending emails (bounded by ``timeout``) and stop workers.
+
+        Args:
+            timeout: Seconds to wait for the queue to drain.
+        """
+        if self._dispatcher is None:
+            return
+        try:
+            await asyncio.wait_for(self.drain(), timeout=timeout)
+        except TimeoutError:
+            pending = self._queue.qsize() if self._queue else 0
+            logger.warning("email_queue_close_timeout", pending=pending)
+        self._dispatcher.cancel()
+        with contextlib.suppress(asyncio.CancelledError):
+            await self._dispatcher
+        if self._executor is not None:
+            self._executor.shutdown(wait=False)
+        self._queue = None
+        self._dispatcher = None
+        self._executor = None
+
+    def to_dict(self) -> dict[str, Any]:
+        """Stats for monitoring.
+
+        Returns:
+            Queue statistics dictionary.
+        """
+        return {
+            "queued": self._queue.qsize() if self._queue else 0,
+            "sent": self._sent,
+            "failed": self._failed,
+            "retried": self._retried,
+            "rejected": self._rejected,
+            "concurrency": self._concurrency,
+            "batch_size": self._batch_size,
+        }
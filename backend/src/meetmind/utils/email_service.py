@@ -4,12 +4,13 @@ Sends transactional emails (meeting summary, password reset, etc.)
 using boto3. Credentials are resolved automatically:
   - locally: via aws_profile in settings / env
   - production: via App Runner instance IAM role (no access keys needed)
+
+Templates are compiled once per process (see utils/template.py) and
+sends go through a dedicated batched queue (see utils/email_queue.py).
 """
 
 from __future__ import annotations
 
-import asyncio
-import logging
 from datetime import datetime
 from email.mime.multipart import MIMEMultipart
 from email.mime.text import MIMEText
@@ -18,22 +19,38 @@ from typing import Any
 
 import boto3
 import structlog
-from botocore.exceptions import BotoCoreError, ClientError
 
 from meetmind.config.settings import settings
+from meetmind.utils.email_queue import EmailJob, EmailSendQueue
+from meetmind.utils.template import CompiledTemplate, escape, load_template
 
 logger = structlog.get_logger(__name__)
 
-# Load HTML template once at module level
 _TEMPLATE_PATH = Path(__file__).parent.parent / "templates" / "meeting_summary.html"
-_TEMPLATE: str | None = None
 
+_PRIORITY_COLORS = {"high": "#ef4444", "medium": "#f59e0b", "low": "#22c55e"}
 
-def _get_template() -> str:
-    global _TEMPLATE
-    if _TEMPLATE is None:
-        _TEMPLATE = _TEMPLATE_PATH.read_text(encoding="utf-8")
-    return _TEMPLATE
+# Row fragments compiled once — rendering is a join over pre-split parts
+_ACTION_ROW = CompiledTemplate(
+    """
+                <tr>
+                  <td style="padding:10px 0;border-bottom:1px solid #1f2937;">
+                    <span style="color:{{PRIORITY_COLOR}};margin-right:8px;">●</span>
+                    <span style="color:#e5e7eb;">{{TASK}}</span>
+                    {{ASSIGNEE_TAG}}{{DEADLINE_TAG}}
+                  </td>
+                </tr>"""
+)
+_ASSIGNEE_TAG = CompiledTemplate(
+    '<span style="color:#a78bfa;font-size:12px;margin-left:8px;">→ {{ASSIGNEE}}</span>'
+)
+_DEADLINE_TAG = CompiledTemplate(
+    '<span style="color:#6b7280;font-size:11px;margin-left:8px;">📅 {{DEADLINE}}</span>'
+)
+_LIST_ROW = CompiledTemplate(
+    '<p style="margin:6px 0;color:#d1d5db;">'
+    '<span style="color:#8b5cf6;margin-right:8px;">{{ICON}}</span>{{TEXT}}</p>'
+)
 
 
 def _format_duration(seconds: int | None) -> str:
@@ -67,43 +84,26 @@ def _render_action_items_html(items: list[Any]) -> str:
     rows = []
     for item in items:
         if isinstance(item, dict):
-            task = item.get("task", str(item))
             assignee = item.get("assignee", "")
             deadline = item.get("deadline", "")
-            priority = item.get("priority", "medium")
-            priority_color = {"high": "#ef4444", "medium": "#f59e0b", "low": "#22c55e"}.get(
-                priority, "#f59e0b"
-            )
-            assignee_tag = (
-                f'<span style="color:#a78bfa;font-size:12px;margin-left:8px;">→ {assignee}</span>'
-                if assignee
-                else ""
-            )
-            deadline_tag = (
-                f'<span style="color:#6b7280;font-size:11px;margin-left:8px;">📅 {deadline}</span>'
-                if deadline
-                else ""
-            )
-            rows.append(
-                f"""
-                <tr>
-                  <td style="padding:10px 0;border-bottom:1px solid #1f2937;">
-                    <span style="color:{priority_color};margin-right:8px;">●</span>
-                    <span style="color:#e5e7eb;">{task}</span>
-                    {assignee_tag}{deadline_tag}
-                  </td>
-                </tr>"""
-            )
+            values = {
+                "PRIORITY_COLOR": _PRIORITY_COLORS.get(item.get("priority", "medium"), "#f59e0b"),
+                "TASK": escape(item.get("task", str(item))),
+                "ASSIGNEE_TAG": (
+                    _ASSIGNEE_TAG.render({"ASSIGNEE": escape(assignee)}) if assignee else ""
+                ),
+                "DEADLINE_TAG": (
+                    _DEADLINE_TAG.render({"DEADLINE": escape(deadline)}) if deadline else ""
+                ),
+            }
         else:
-            rows.append(
-                f"""
-                <tr>
-                  <td style="padding:10px 0;border-bottom:1px solid #1f2937;">
-                    <span style="color:#f59e0b;margin-right:8px;">●</span>
-                    <span style="color:#e5e7eb;">{item}</span>
-                  </td>
-                </tr>"""
-            )
+            values = {
+                "PRIORITY_COLOR": "#f59e0b",
+                "TASK": escape(item),
+                "ASSIGNEE_TAG": "",
+                "DEADLINE_TAG": "",
+            }
+        rows.append(_ACTION_ROW.render(values))
     return f'<table width="100%" cellpadding="0" cellspacing="0">{"".join(rows)}</table>'
 
 
@@ -111,14 +111,15 @@ def _render_list_html(items: list[Any], icon: str = "▸") -> str:
     """Render a simple list as HTML."""
     if not items:
         return '<p style="color:#9ca3af;font-style:italic;">None detected.</p>'
-    rows = []
-    for item in items:
-        text = item.get("text", str(item)) if isinstance(item, dict) else str(item)
-        rows.append(
-            f'<p style="margin:6px 0;color:#d1d5db;">'
-            f'<span style="color:#8b5cf6;margin-right:8px;">{icon}</span>{text}</p>'
+    return "".join(
+        _LIST_ROW.render(
+            {
+                "ICON": icon,
+                "TEXT": escape(item.get("text", str(item)) if isinstance(item, dict) else item),
+            }
         )
-    return "".join(rows)
+        for item in items
+    )
 
 
 def _build_plain_text(
@@ -169,11 +170,18 @@ class SESEmailService:
     """Amazon SES email sender.
 
     Uses the instance IAM role in production (App Runner) —
-    no access keys required.
+    no access keys required. Pass ``client`` to use a local SES
+    stand-in (anything with ``send_raw_email``) in tests or dev.
     """
 
-    def __init__(self) -> None:
-        self._client = None
+    def __init__(self, client: Any = None) -> None:
+        self._client = client
+        self._queue = EmailSendQueue(
+            self._send_job,
+            concurrency=settings.ses_send_concurrency,
+            batch_size=settings.ses_send_batch_size,
+            max_retries=settings.ses_send_max_retries,
+        )
 
     def _get_client(self) -> Any:
         """Lazily initialize the SES client."""
@@ -199,13 +207,13 @@ class SESEmailService:
         summary: dict[str, Any],
         language: str = "es",
     ) -> bool:
-        """Send a meeting summary email via Amazon SES.
+        """Render a meeting summary email and queue it for SES delivery.
 
-        Runs the blocking boto3 call in a thread pool to avoid blocking
-        the async event loop.
+        Returns as soon as the email is queued; the send queue handles
+        batching, retries, and failure logging.
 
         Returns:
-            True if sent successfully, False on any error.
+            True if queued, False if email is disabled or rendering failed.
         """
         if not settings.ses_sender:
             logger.warning("ses_sender_not_configured", skip_email=True)
@@ -220,34 +228,35 @@ class SESEmailService:
                 duration_secs=duration_secs,
                 summary=summary,
             )
+        except Exception as e:
+            logger.error("email_render_failed", meeting_id=meeting_id, error=str(e))
+            return False
 
-            subject = self._build_subject(meeting_title, language)
-
-            # Run blocking boto3 in thread executor
-            loop = asyncio.get_event_loop()
-            await loop.run_in_executor(
-                None,
-                lambda: self._send_raw_email(
-                    to_email=user_email,
-                    subject=subject,
-                    html_body=html,
-                    plain_body=plain,
-                ),
+        queued = await self._queue.submit(
+            EmailJob(
+                to_email=user_email,
+                subject=self._build_subject(meeting_title, language),
+                html_body=html,
+                plain_body=plain,
+                meeting_id=meeting_id,
             )
-
+        )
+        if queued:
             logger.info(
-                "meeting_summary_email_sent",
+                "meeting_summary_email_queued",
                 meeting_id=meeting_id,
                 email=user_email[:3] + "***",  # partial for privacy
             )
-            return True
+        return queued
 
-        except (BotoCoreError, ClientError) as e:
-            logger.error("ses_send_failed", meeting_id=meeting_id, error=str(e))
-            return False
-        except Exception as e:
-            logger.error("email_unexpected_error", meeting_id=meeting_id, error=str(e))
-            return False
+    async def close(self) -> None:
+        """Flush queued emails and stop the send workers (app shutdown)."""
+        await self._queue.close()
+
+    @property
+    def queue(self) -> EmailSendQueue:
+        """The underlying send queue (stats, draining)."""
+        return self._queue
 
     def _build_subject(self, meeting_title: str, language: str) -> str:
         subjects = {
@@ -281,21 +290,21 @@ class SESEmailService:
             sentiment or "", ""
         )
 
-        # Build HTML from template
-        html = (
-            _get_template()
-            .replace("{{MEETING_TITLE}}", meeting_title)
-            .replace("{{MEETING_DATE}}", date_str)
-            .replace("{{DURATION}}", duration_str)
-            .replace("{{USER_NAME}}", user_name or "there")
-            .replace("{{OVERVIEW}}", overview or "No summary available.")
-            .replace("{{ACTION_ITEMS_HTML}}", _render_action_items_html(action_items))
-            .replace("{{DECISIONS_HTML}}", _render_list_html(decisions, "🔑"))
-            .replace("{{KEY_POINTS_HTML}}", _render_list_html(key_points, "💡"))
-            .replace("{{SENTIMENT_EMOJI}}", sentiment_emoji)
-            .replace("{{MEETING_ID}}", meeting_id)
-            .replace("{{APP_STORE_URL}}", "https://apps.apple.com/us/app/aura-meet/id6759219835")
-            .replace("{{SITE_URL}}", "https://aurameet.live")
+        html = load_template(_TEMPLATE_PATH).render(
+            {
+                "MEETING_TITLE": escape(meeting_title),
+                "MEETING_DATE": escape(date_str),
+                "DURATION": duration_str,
+                "USER_NAME": escape(user_name or "there"),
+                "OVERVIEW": escape(overview or "No summary available."),
+                "ACTION_ITEMS_HTML": _render_action_items_html(action_items),
+                "DECISIONS_HTML": _render_list_html(decisions, "🔑"),
+                "KEY_POINTS_HTML": _render_list_html(key_points, "💡"),
+                "SENTIMENT_EMOJI": sentiment_emoji,
+                "MEETING_ID": escape(meeting_id),
+                "APP_STORE_URL": "https://apps.apple.com/us/app/aura-meet/id6759219835",
+                "SITE_URL": "https://aurameet.live",
+            }
         )
 
         plain = _build_plain_text(
@@ -310,6 +319,15 @@ class SESEmailService:
 
         return html, plain
 
+    def _send_job(self, job: EmailJob) -> None:
+        """Blocking send of one queued job — runs on the queue's pool."""
+        self._send_raw_email(
+            to_email=job.to_email,
+            subject=job.subject,
+            html_body=job.html_body,
+            plain_body=job.plain_body,
+        )
+
     def _send_raw_email(
         self,
         *,
@@ -318,7 +336,7 @@ class SESEmailService:
         html_body: str,
         plain_body: str,
     ) -> None:
-        """Blocking SES send — call via run_in_executor."""
+        """Blocking SES send — called from the send queue's thread pool."""
         msg = MIMEMultipart("alternative")
         msg["Subject"] = subject
         msg["From"] = f"{settings.ses_sender_name} <{settings.ses_sender}>"
@@ -0,0 +1,521 @@
+"""HTTP Compression — dictionary zstd for JSON payloads, gzip fallback.
+
+Meeting detail responses and copilot requests are large, repetitive JSON:
+the same keys (``speaker``, ``timestamp_unix``, ``insight_type`` …) and
+category values appear in every segment and insight. A shared dictionary
+primes the compressor with that vocabulary, so even small payloads shrink.
+
+Content codings, in order of preference:
+
+- ``dcz`` — Compression Dictionary Transport (RFC 9842). Browsers that have
+  fetched ``/api/compression/dictionary`` advertise its SHA-256 in
+  ``Available-Dictionary``; the body is a zstd frame compressed against it.
+  Chrome decodes this natively, so the extension needs no WASM decoder.
+- ``zstd`` — plain zstd (RFC 8878), no dictionary.
+- ``gzip`` — everything else, including ``dart:io`` clients.
+
+Request bodies sent with ``Content-Encoding: gzip``, ``zstd`` or ``dcz`` are
+decoded before the route sees them, with a cap on the decoded size.
+
+zstd comes from the ``zstandard`` package (a required dependency — a
+missing install fails at import rather than quietly serving gzip).
+"""
+
+from __future__ import annotations
+
+import base64
+import gzip
+import hashlib
+import io
+import json
+import zlib
+from pathlib import Path
+from typing import TYPE_CHECKING, Any
+
+import structlog
+import zstandard
+from starlette.datastructures import Headers, MutableHeaders
+
+if TYPE_CHECKING:
+    from starlette.types import ASGIApp, Message, Receive, Scope, Send
+
+logger = structlog.get_logger(__name__)
+
+DCZ_MAGIC = b"\x5e\x2a\x4d\x18\x20\x00\x00\x00"  # zstd skippable frame, 32-byte payload
+DCZ_HEADER_SIZE = len(DCZ_MAGIC) + 32
+MAX_DECODED_BYTES = 8 << 20  # 8 MiB per request body
+COMPRESSIBLE_TYPES = ("application/json",)
+
+
+class DecompressionError(ValueError):
+    """Raised when a compressed request body cannot be decoded."""
+
+
+# ─── Dictionary ─────────────────────────────────────────────────
+
+
+def build_default_dictionary() -> bytes:
+    """Build the built-in dictionary from the API's JSON vocabulary.
+
+    A raw-content dictionary: serialized sample payloads with every key
+    and enum value the meeting endpoints emit, most common last (zstd
+    reaches the end of the dictionary with the shortest offsets).
+
+    Returns:
+        Dictionary bytes, deterministic across processes.
+    """
+    samples: list[Any] = [
+        {
+            "stats": {
+                "total_meetings": 0,
+                "total_hours": 0.0,
+                "total_insights": 0,
+                "pending_actions": 0,
+                "meetings_today": 0,
+                "meetings_this_week": 0,
+            }
+        },
+        {
+            "question": "",
+            "transcript_context": "",
+            "answer": "",
+            "model_used": "",
+            "latency_ms": 0,
+            "cost_usd": 0.0,
+        },
+        {
+            "action_items": [
+                {
+                    "id": 0,
+                    "meeting_id": "",
+                    "meeting_title": "",
+                    "assignee": "",
+                    "task": "",
+                    "deadline": "",
+                    "priority": "medium",
+                    "status": "pending",
+                }
+            ]
+        },
+        {
+            "summary": {
+                "title": "",
+                "overview": "",
+                "key_points": [],
+                "action_items": [{"task": "", "assignee": "", "deadline": "", "priority": "high"}],
+                "decisions": [],
+                "follow_ups": [],
+                "sentiment": "positive",
+                "full_markdown": "## Summary\n\n- ",
+            }
+        },
+        {
+            "meetings": [
+                {
+                    "id": "",
+                    "title": "Untitled Meeting",
+                    "language": "es",
+                    "status": "completed",
+                    "started_at": "2025-01-01T00:00:00+00:00",
+                    "ended_at": "2025-01-01T00:00:00+00:00",
+                    "duration_secs": 0,
+                    "total_segments": 0,
+                    "total_insights": 0,
+                    "cost_usd": 0.0,
+                }
+            ],
+            "total": 0,
+        },
+        {
+            "insights": [
+                {
+                    "insight_type": "insight",
+                    "title": "",
+                    "content": "",
+                    "category": category,
+                    "importance": importance,
+                    "timestamp_unix": 1700000000.0,
+                }
+                for category, importance in (
+                    ("decision", "high"),
+                    ("action", "medium"),
+                    ("risk", "high"),
+                    ("idea", "low"),
+                )
+            ]
+        },
+        {
+            "segments": [
+                {
+                    "speaker": "unknown",
+                    "text": "",
+                    "timestamp_unix": 1700000000.0,
+                    "segment_index": 0,
+                },
+                {"speaker": "user", "text": "", "timestamp_unix": 1700000000.0, "segment_index": 1},
+            ]
+        },
+    ]
+    return "\n".join(json.dumps(s, ensure_ascii=False) for s in samples).encode()
+
+
+class CompressionDictionary:
+    """A shared compression dictionary and its zstd contexts.
+
+    The dictionary is loaded as raw content on both sides, which is what
+    RFC 9842 clients do with whatever bytes the dictionary URL served.
+    """
+
+    def __init__(self, data: bytes, *, level: int = 3) -> None:
+        """Initialize from dictionary bytes.
+
+        Args:
+            data: Raw dictionary content.
+            level: zstd compression level.
+        """
+        self.data = data
+        self.sha256 = hashlib.sha256(data).digest()
+        self.id = self.sha256.hex()[:16]
+        # Structured-field byte sequence, as sent in Available-Dictionary
+        self.header_value = f":{base64.b64encode(self.sha256).decode()}:"
+        self._level = level
+        self._zstd_dict: Any = None
+        self._compressor: Any = None
+        self._dict_compressor: Any = None
+
+    def _dict(self) -> Any:
+        if self._zstd_dict is None:
+            self._zstd_dict = zstandard.ZstdCompressionDict(
+                self.data, dict_type=zstandard.DICT_TYPE_RAWCONTENT
+            )
+        return self._zstd_dict
+
+    def compress_zstd(self, body: bytes, *, use_dictionary: bool) -> bytes:
+        """Compress into a single zstd frame, optionally against the dictionary."""
+        if use_dictionary:
+            if self._dict_compressor is None:
+                self._dict_compressor = zstandard.ZstdCompressor(
+                    level=self._level, dict_data=self._dict()
+                )
+            return self._dict_compressor.compress(body)
+        if self._compressor is None:
+            self._compressor = zstandard.ZstdCompressor(level=self._level)
+        return self._compressor.compress(body)
+
+    def decompress_zstd(self, body: bytes, *, use_dictionary: bool, limit: int) -> bytes:
+        """Decompress a zstd stream, refusing output over ``limit`` bytes."""
+        dctx = (
+            zstandard.ZstdDecompressor(dict_data=self._dict())
+            if use_dictionary
+            else zstandard.ZstdDecompressor()
+        )
+        with dctx.stream_reader(io.BytesIO(body)) as reader:
+            data = reader.read(limit + 1)
+        if len(data) > limit:
+            raise DecompressionError("Decoded body too large")
+        return data
+
+
+def load_dictionary(path: str = "", *, level: int = 3) -> CompressionDictionary:
+    """Load a trained dictionary from disk, or fall back to the built-in one.
+
+    Args:
+        path: File written by ``scripts/train_compression_dict.py``.
+            Empty uses :func:`build_default_dictionary`.
+        level: zstd compression level.
+
+    Returns:
+        The dictionary to serve and compress with.
+    """
+    if path:
+        try:
+            data = Path(path).read_bytes()
+            logger.info("compression_dictionary_loaded", path=path, size=len(data))
+            return CompressionDictionary(data, level=level)
+        except OSError as e:
+            logger.warning("compression_dictionary_load_failed", path=path, error=str(e))
+    return CompressionDictionary(build_default_dictionary(), level=level)
+
+
+# ─── Negotiation ────────────────────────────────────────────────
+
+
+def _accepted(accept_encoding: str) -> set[str]:
+    """Content codings listed in Accept-Encoding with a non-zero q-value."""
+    codings: set[str] = set()
+    for part in accept_encoding.split(","):
+        name, _, params = part.strip().partition(";")
+        q = params.strip()
+        if q.startswith("q="):
+            try:
+                if float(q[2:]) <= 0:
+                    continue
+            except ValueError:
+                continue
+        if name:
+            codings.add(name.strip().lower())
+    return codings
+
+
+def negotiate(
+    accept_encoding: str,
+    available_dictionary: str | None,
+    dictionary: CompressionDictionary,
+) -> str | None:
+    """Pick the response content coding.
+
+    Args:
+        accept_encoding: The request's Accept-Encoding header.
+        available_dictionary: The request's Available-Dictionary header.
+        dictionary: The server's current dictionary.
+
+    Returns:
+        ``"dcz"``, ``"zstd"``, ``"gzip"``, or None for identity.
+    """
+    codings = _accepted(accept_encoding)
+    if (
+        "dcz" in codings
+        and available_dictionary
+        and available_dictionary.strip() == dictionary.header_value
+    ):
+        return "dcz"
+    if "zstd" in codings:
+        return "zstd"
+    if "gzip" in codings or "*" in codings:
+        return "gzip"
+    return None
+
+
+# ─── Codecs ─────────────────────────────────────────────────────
+
+
+def compress(body: bytes, encoding: str, dictionary: CompressionDictionary) -> bytes:
+    """Encode a response body.
+
+    Args:
+        body: Uncompressed body.
+        encoding: Result of :func:`negotiate`.
+        dictionary: Shared dictionary (used for ``dcz``).
+
+    Returns:
+        Encoded body.
+    """
+    if encoding == "dcz":
+        frame = dictionary.compress_zstd(body, use_dictionary=True)
+        return DCZ_MAGIC + dictionary.sha256 + frame
+    if encoding == "zstd":
+        return dictionary.compress_zstd(body, use_dictionary=False)
+    return gzip.compress(body, compresslevel=5, mtime=0)
+
+
+def decompress(
+    body: bytes,
+    encoding: str,
+    dictionary: CompressionDictionary,
+    *,
+    limit: int = MAX_DECODED_BYTES,
+) -> bytes:
+    """Decode a request body.
+
+    Args:
+        body: Encoded body.
+        encoding: The request's Content-Encoding.
+        dictionary: Shared dictionary (used for ``dcz``).
+        limit: Maximum decoded size in bytes.
+
+    Returns:
+        Decoded body.
+
+    Raises:
+        DecompressionError: On unsupported codings, corrupt data, a
+            dictionary mismatch, or output over ``limit``.
+    """
+    try:
+        if encoding == "gzip":
+            d = zlib.decompressobj(16 + zlib.MAX_WBITS)
+            data = d.decompress(body, limit + 1)
+            if len(data) > limit:
+                raise DecompressionError("Decoded body too large")
+            if not d.eof:
+                raise DecompressionError("Truncated gzip body")
+            return data
+        if encoding == "zstd":
+            return dictionary.decompress_zstd(body, use_dictionary=False, limit=limit)
+        if encoding == "dcz":
+            if body[: len(DCZ_MAGIC)] != DCZ_MAGIC:
+                raise DecompressionError("Bad dcz header")
+            if body[len(DCZ_MAGIC) : DCZ_HEADER_SIZE] != dictionary.sha256:
+                raise DecompressionError("Unknown dictionary")
+            return dictionary.decompress_zstd(
+                body[DCZ_HEADER_SIZE:], use_dictionary=True, limit=limit
+            )
+    except DecompressionError:
+        raise
+    except (zlib.error, EOFError, zstandard.ZstdError) as e:
+        raise DecompressionError(f"Corrupt {encoding} body") from e
+    raise DecompressionError(f"Unsupported content encoding: {encoding}")
+
+
+# ─── Middleware ─────────────────────────────────────────────────
+
+
+async def _send_error(send: Send, status: int, detail: str) -> None:
+    body = json.dumps({"detail": detail}).encode()
+    await send(
+        {
+            "type": "http.response.start",
+            "status": status,
+            "headers": [
+                (b"content-type", b"application/json"),
+                (b"content-length", str(len(body)).encode()),
+            ],
+        }
+    )
+    await send({"type": "http.response.body", "body": body})
+
+
+class CompressionMiddleware:
+    """ASGI middleware that compresses JSON responses and decodes request bodies.
+
+    Only complete ``application/json`` bodies are compressed; streamed
+    responses (SSE, PDF reports) pass through untouched so they keep
+    flushing chunk by chunk.
+    """
+
+    def __init__(
+        self,
+        app: ASGIApp,
+        *,
+        dictionary: CompressionDictionary,
+        minimum_size: int = 1024,
+        max_request_bytes: int = MAX_DECODED_BYTES,
+    ) -> None:
+        """Initialize the middleware.
+
+        Args:
+            app: The wrapped ASGI application.
+            dictionary: Shared dictionary for ``dcz``.
+            minimum_size: Smaller bodies are sent uncompressed.
+            max_request_bytes: Cap on decoded request bodies.
+        """
+        self.app = app
+        self.dictionary = dictionary
+        self.minimum_size = minimum_size
+        self.max_request_bytes = max_request_bytes
+
+    async def __call__(self, scope: Scope, receive: Receive, send: Send) -> None:
+        """Handle one ASGI connection."""
+        if scope["type"] != "http":
+            await self.app(scope, receive, send)
+            return
+
+        headers = Headers(scope=scope)
+        request_encoding = headers.get("content-encoding", "").strip().lower()
+        if request_encoding and request_encoding != "identity":
+            raw = bytearray()
+            more = True
+            while more:
+                message = await receive()
+                raw += message.get("body", b"")
+                more = message.get("more_body", False)
+                if len(raw) > self.max_request_bytes:
+                    await _send_error(send, 413, "Request body too large")
+                    return
+            try:
+                body = decompress(
+                    bytes(raw), request_encoding, self.dictionary, limit=self.max_request_bytes
+                )
+            except DecompressionError as e:
+                logger.warning("request_decompress_failed", encoding=request_encoding, error=str(e))
+                status = 415 if "Unsupported" in str(e) else 400
+                await _send_error(send, status, str(e))
+                return
+
+            # Rewrite the headers in place: outer middleware (metrics) reads
+            # the route the router stores in this same scope.
+            request_headers = MutableHeaders(scope=scope)
+            del request_headers["content-encoding"]
+            request_headers["content-length"] = str(len(body))
+            receive = _replay(body)
+
+        encoding = negotiate(
+            headers.get("accept-encoding", ""),
+            headers.get("available-dictionary"),
+            self.dictionary,
+        )
+        if encoding is None:
+            await self.app(scope, receive, send)
+            return
+        responder = _CompressingSender(send, encoding, self.dictionary, self.minimum_size)
+        await self.app(scope, receive, responder)
+
+
+def _replay(body: bytes) -> Receive:
+    """A receive callable that yields ``body`` once, then waits for disconnect."""
+    sent = False
+
+    async def receive() -> Message:
+        nonlocal sent
+        if not sent:
+            sent = True
+            return {"type": "http.request", "body": body, "more_body": False}
+        return {"type": "http.disconnect"}
+
+    return receive
+
+
+class _CompressingSender:
+    """Wraps ``send`` to compress a single-message JSON response body."""
+
+    def __init__(
+        self,
+        send: Send,
+        encoding: str,
+        dictionary: CompressionDictionary,
+        minimum_size: int,
+    ) -> None:
+        self._send = send
+        self._encoding = encoding
+        self._dictionary = dictionary
+        self._minimum_size = minimum_size
+        self._start: Message | None = None
+        self._passthrough = False
+
+    async def __call__(self, message: Message) -> None:
+        if self._passthrough:
+            await self._send(message)
+            return
+
+        if message["type"] == "http.response.start":
+            headers = Headers(raw=message.get("headers", []))
+            content_type = headers.get("content-type", "").split(";")[0].strip()
+            if content_type not in COMPRESSIBLE_TYPES or "content-encoding" in headers:
+                self._passthrough = True
+                await self._send(message)
+                return
+            self._start = message
+            return
+
+        if message["type"] != "http.response.body" or self._start is None:
+            await self._send(message)
+            return
+
+        start, self._start = self._start, None
+        body = message.get("body", b"")
+        headers = MutableHeaders(raw=start["headers"])
+        headers.add_vary_header("Accept-Encoding")
+
+        if message.get("more_body", False) or len(body) < self._minimum_size:
+            # Streamed or small — send as-is
+            self._passthrough = True
+            await self._send(start)
+            await self._send(message)
+            return
+
+        encoded = compress(body, self._encoding, self._dictionary)
+        headers["content-encoding"] = self._encoding
+        headers["content-length"] = str(len(encoded))
+        if self._encoding == "dcz":
+            headers.add_vary_header("Available-Dictionary")
+        await self._send(start)
+        await self._send({"type": "http.response.body", "body": encoded})
@@ -0,0 +1,424 @@
+"""Meeting Report PDF — server-side rendering of the executive report.
+
+Mirrors the sections of the app's on-device report (hero title, stats,
+executive summary, key points, decisions, action items, follow-ups, AI
+insights, transcript appendix) but lays pages out one at a time and
+yields each as soon as it is finished. Transcript segments are consumed
+from an async iterator, so a 3-hour meeting never sits in memory as a
+whole — only the current page and the writer's xref offsets do.
+"""
+
+from __future__ import annotations
+
+import json
+import re
+from datetime import datetime
+from typing import TYPE_CHECKING, Any
+
+from meetmind.utils.pdf_writer import (
+    HELVETICA,
+    HELVETICA_BOLD,
+    PAGE_HEIGHT,
+    PAGE_WIDTH,
+    Font,
+    PageCanvas,
+    PdfStreamWriter,
+    can_encode,
+    encode_text,
+    wrap_text,
+)
+
+if TYPE_CHECKING:
+    from collections.abc import AsyncIterable, AsyncIterator, Iterator
+
+# ─── Style ────────────────────────────────────────────────────────
+
+Color = tuple[float, float, float]
+
+
+def _rgb(value: int) -> Color:
+    return ((value >> 16 & 0xFF) / 255, (value >> 8 & 0xFF) / 255, (value & 0xFF) / 255)
+
+
+_PURPLE = _rgb(0x8B5CF6)
+_PURPLE_LIGHT = _rgb(0xF3F0FF)
+_GREEN = _rgb(0x06D6A0)
+_ORANGE = _rgb(0xF97316)
+_YELLOW = _rgb(0xEAB308)
+_RED = _rgb(0xEF4444)
+_BLUE = _rgb(0x3B82F6)
+_GREY50 = _rgb(0xF9FAFB)
+_GREY100 = _rgb(0xF3F4F6)
+_GREY500 = _rgb(0x6B7280)
+_GREY700 = _rgb(0x374151)
+_GREY900 = _rgb(0x111827)
+
+_MARGIN_X = 40.0
+_MARGIN_Y = 32.0
+_CONTENT_WIDTH = PAGE_WIDTH - 2 * _MARGIN_X
+_TOP = PAGE_HEIGHT - _MARGIN_Y - 24  # below the running header
+_BOTTOM = _MARGIN_Y + 24  # above the running footer
+_SPEAKER_COLUMN = 70.0
+
+_PRIORITY_COLORS = {"high": _RED, "medium": _YELLOW}
+_IMPORTANCE_COLORS = {"high": _RED, "medium": _ORANGE}
+
+
+# ─── Data Helpers ─────────────────────────────────────────────────
+
+
+def _extract_list(data: Any) -> list[str]:
+    """Normalize a summary list field (JSONB may arrive as a string)."""
+    if isinstance(data, str):
+        try:
+            data = json.loads(data)
+        except ValueError:
+            return [data] if data.strip() else []
+    if not isinstance(data, list):
+        return []
+    items: list[str] = []
+    for item in data:
+        if isinstance(item, dict):
+            text = item.get("text") or item.get("what") or item.get("task") or item.get("item")
+            items.append(str(text) if text else json.dumps(item, ensure_ascii=False))
+        elif item:
+            items.append(str(item))
+    return items
+
+
+def format_duration(duration_secs: int | None) -> str:
+    """Format a duration like the app report does (``12m 5s``)."""
+    secs = int(duration_secs or 0)
+    if secs <= 0:
+        return "< 1m"
+    return f"{secs // 60}m {secs % 60}s"
+
+
+def _format_date(value: Any) -> str:
+    if isinstance(value, datetime):
+        return value.strftime("%B %d, %Y  ·  %H:%M UTC")
+    return str(value) if value else ""
+
+
+def report_filename(title: str) -> str:
+    """Download filename matching the app's share sheet name.
+
+    Args:
+        title: Meeting title.
+
+    Returns:
+        ``aurameet_<safe_title>.pdf``.
+    """
+    safe = re.sub(r"[^\w\s-]", "", title, flags=re.ASCII)
+    safe = re.sub(r"\s+", "_", safe).lower()
+    return f"aurameet_{safe}.pdf"
+
+
+# ─── Layout ───────────────────────────────────────────────────────
+
+
+class _ReportLayout:
+    """Flow layout that fills pages top to bottom and emits finished ones."""
+
+    def __init__(self, writer: PdfStreamWriter) -> None:
+        self._writer = writer
+        self._ready: list[bytes] = []
+        self._canvas = self._start_page()
+        self._y = _TOP
+
+    def _start_page(self) -> PageCanvas:
+        canvas = PageCanvas()
+        canvas.text(_MARGIN_X, PAGE_HEIGHT - _MARGIN_Y, b"AURA MEET", HELVETICA_BOLD, 8, _PURPLE)
+        label = encode_text("AI Executive Report")
+        canvas.text(
+            PAGE_WIDTH - _MARGIN_X - HELVETICA.width(label, 8),
+            PAGE_HEIGHT - _MARGIN_Y,
+            label,
+            HELVETICA,
+            8,
+            _GREY500,
+        )
+        canvas.rect(_MARGIN_X, PAGE_HEIGHT - _MARGIN_Y - 8, _CONTENT_WIDTH, 0.5, _GREY100)
+        return canvas
+
+    def _finish_page(self) -> None:
+        page = encode_text(f"Page {self._writer.page_count + 1}")
+        self._canvas.rect(_MARGIN_X, _MARGIN_Y + 12, _CONTENT_WIDTH, 0.5, _GREY100)
+        self._canvas.text(_MARGIN_X, _MARGIN_Y, b"Generated by Aura Meet", HELVETICA, 7, _GREY500)
+        self._canvas.text(
+            PAGE_WIDTH - _MARGIN_X - HELVETICA.width(page, 7),
+            _MARGIN_Y,
+            page,
+            HELVETICA,
+            7,
+            _GREY500,
+        )
+        self._ready.append(self._writer.add_page(self._canvas.build()))
+
+    def ensure(self, height: float) -> None:
+        """Break to a new page unless ``height`` points still fit."""
+        if self._y - height < _BOTTOM:
+            self._finish_page()
+            self._canvas = self._start_page()
+            self._y = _TOP
+
+    def space(self, height: float) -> None:
+        """Vertical gap (dropped at a page break)."""
+        self._y -= height
+
+    def take(self) -> bytes:
+        """Return and clear the bytes of pages finished since the last call."""
+        chunk = b"".join(self._ready)
+        self._ready.clear()
+        return chunk
+
+    def close(self) -> bytes:
+        """Finish the last page and return all remaining page bytes."""
+        self._finish_page()
+        return self.take()
+
+    # ─── Blocks ───────────────────────────────────────────────
+
+    def text_block(
+        self,
+        text: str,
+        *,
+        font: Font = HELVETICA,
+        size: float = 9,
+        color: Color = _GREY700,
+        indent: float = 0.0,
+        leading: float = 1.45,
+    ) -> None:
+        """Wrapped paragraph; breaks pages between lines."""
+        line_height = size * leading
+        for line in wrap_text(encode_text(text), font, size, _CONTENT_WIDTH - indent):
+            self.ensure(line_height)
+            self._y -= line_height
+            self._canvas.text(_MARGIN_X + indent, self._y, line, font, size, color)
+
+    def bullet(self, text: str, color: Color, *, label: str = "") -> None:
+        """Bulleted item with an optional bold lead-in label."""
+        self.ensure(14)
+        self._canvas.rect(_MARGIN_X + 2, self._y - 9, 4, 4, color)
+        if label:
+            self.text_block(label, font=HELVETICA_BOLD, indent=12, color=_GREY900)
+        if text or not label:
+            self.text_block(text, indent=12)
+        self.space(4)
+
+    def section(self, title: str, color: Color) -> None:
+        """Section header with a colored accent bar."""
+        self.space(10)
+        self.ensure(40)  # keep the header with at least one line of content
+        self._y -= 14
+        self._canvas.rect(_MARGIN_X, self._y - 2, 3, 14, color)
+        self._canvas.text(_MARGIN_X + 10, self._y, encode_text(title), HELVETICA_BOLD, 12, _GREY900)
+        self.space(6)
+
+    def hero(self, title: str, date: str) -> None:
+        """Report title and date."""
+        self.text_block(title, font=HELVETICA_BOLD, size=22, color=_GREY900, leading=1.2)
+        if date:
+            self.space(4)
+            self.text_block(date, size=9, color=_GREY500)
+        self.space(12)
+
+    def stats(self, items: list[tuple[str, str, Color]]) -> None:
+        """Stats row: value over label, evenly spaced."""
+        self.ensure(50)
+        top = self._y
+        self._canvas.rect(_MARGIN_X, top - 46, _CONTENT_WIDTH, 46, _GREY50)
+        column = _CONTENT_WIDTH / len(items)
+        for i, (label, value, color) in enumerate(items):
+            center = _MARGIN_X + column * i + column / 2
+            value_b, label_b = encode_text(value), encode_text(label)
+            self._canvas.text(
+                center - HELVETICA_BOLD.width(value_b, 14) / 2,
+                top - 22,
+                value_b,
+                HELVETICA_BOLD,
+                14,
+                color,
+            )
+            self._canvas.text(
+                center - HELVETICA.width(label_b, 8) / 2, top - 36, label_b, HELVETICA, 8, _GREY500
+            )
+        self._y = top - 56
+
+    def transcript_line(self, speaker: str, text: str) -> None:
+        """Speaker tag in a fixed left column, wrapped text beside it."""
+        size = 8.5
+        line_height = size * 1.45
+        lines = wrap_text(encode_text(text), HELVETICA, size, _CONTENT_WIDTH - _SPEAKER_COLUMN)
+        self.ensure(line_height)
+        speaker_b = wrap_text(encode_text(speaker), HELVETICA_BOLD, 7, _SPEAKER_COLUMN - 12)[0]
+        self._canvas.rect(
+            _MARGIN_X, self._y - line_height - 2, _SPEAKER_COLUMN - 6, 11, _PURPLE_LIGHT
+        )
+        self._canvas.text(
+            _MARGIN_X + 4, self._y - line_height + 0.5, speaker_b, HELVETICA_BOLD, 7, _PURPLE
+        )
+        for line in lines:
+            self.ensure(line_height)
+            self._y -= line_height
+            self._canvas.text(_MARGIN_X + _SPEAKER_COLUMN, self._y, line, HELVETICA, size, _GREY700)
+        self.space(5)
+
+
+# ─── Sections ─────────────────────────────────────────────────────
+
+
+def _render_summary(layout: _ReportLayout, meeting: dict[str, Any], full_export: bool) -> None:
+    summary = meeting.get("summary") or {}
+    insights = meeting.get("insights") or []
+    action_items = meeting.get("action_items") or []
+
+    layout.hero(
+        str(meeting.get("title") or "Untitled Meeting"), _format_date(meeting.get("started_at"))
+    )
+    layout.stats(
+        [
+            ("Duration", format_duration(meeting.get("duration_secs")), _PURPLE),
+            ("Segments", str(meeting.get("total_segments") or 0), _GREEN),
+            ("Insights", str(len(insights)), _ORANGE),
+            ("Actions", str(len(action_items)), _BLUE),
+        ]
+    )
+
+    overview = summary.get("overview") or summary.get("summary")
+    if overview:
+        layout.section("Executive Summary", _PURPLE)
+        layout.text_block(str(overview), size=10)
+
+    if key_points := _extract_list(summary.get("key_points")):
+        layout.section("Key Points", _GREEN)
+        for point in key_points:
+            layout.bullet(point, _GREEN)
+
+    if decisions := _extract_list(summary.get("decisions")):
+        layout.section("Decisions", _ORANGE)
+        for decision in decisions:
+            layout.bullet(decision, _ORANGE)
+
+    if action_items:
+        layout.section("Action Items", _BLUE)
+        for item in action_items:
+            details = [
+                f"@{item['assignee']}" if item.get("assignee") else "",
+                f"Due {item['deadline']}" if item.get("deadline") else "",
+                "Done" if item.get("status") == "done" else "",
+            ]
+            color = (
+                _GREEN
+                if item.get("status") == "done"
+                else _PRIORITY_COLORS.get(str(item.get("priority") or "medium"), _GREY500)
+            )
+            layout.bullet(
+                "  ·  ".join(d for d in details if d),
+                color,
+                label=str(item.get("task") or ""),
+            )
+
+    if follow_ups := _extract_list(summary.get("follow_ups")):
+        layout.section("Follow-ups", _YELLOW)
+        for follow_up in follow_ups:
+            layout.bullet(follow_up, _YELLOW)
+
+    if full_export and insights:
+        layout.section("AI Insights", _ORANGE)
+        for insight in insights:
+            title = str(insight.get("title") or "Insight")
+            if insight.get("category"):
+                title = f"{title}  ·  {insight['category']}"
+            layout.bullet(
+                str(insight.get("content") or ""),
+                _IMPORTANCE_COLORS.get(str(insight.get("importance") or "medium"), _GREY500),
+                label=title,
+            )
+
+
+def _strings(value: Any) -> Iterator[str]:
+    if isinstance(value, str):
+        yield value
+    elif isinstance(value, dict):
+        for item in value.values():
+            yield from _strings(item)
+    elif isinstance(value, list | tuple):
+        for item in value:
+            yield from _strings(item)
+
+
+async def report_renderable(
+    meeting: dict[str, Any],
+    segments: AsyncIterator[dict[str, Any]] | None = None,
+) -> bool:
+    """Whether the report's text fits the standard fonts.
+
+    The report streams, so this has to be known before the first byte:
+    a meeting in a non-Latin script is refused up front (the app then
+    renders the report itself with embedded fonts) instead of failing
+    halfway through the transcript.
+
+    Args:
+        meeting: Meeting record as passed to :func:`stream_meeting_report`.
+        segments: Transcript segments to scan (consumed and closed).
+
+    Returns:
+        True if every string can be encoded without losing letters.
+    """
+    if not all(can_encode(text) for text in _strings(meeting)):
+        return False
+    if segments is None:
+        return True
+    try:
+        async for segment in segments:
+            if not (
+                can_encode(str(segment.get("text") or ""))
+                and can_encode(str(segment.get("speaker") or ""))
+            ):
+                return False
+    finally:
+        aclose = getattr(segments, "aclose", None)
+        if aclose is not None:
+            await aclose()
+    return True
+
+
+async def stream_meeting_report(
+    meeting: dict[str, Any],
+    segments: AsyncIterable[dict[str, Any]] | None = None,
+    *,
+    full_export: bool = True,
+) -> AsyncIterator[bytes]:
+    """Render a meeting report as a stream of PDF byte chunks.
+
+    Args:
+        meeting: Meeting record with summary, insights, and action items
+            (``storage.get_meeting(..., include_segments=False)``).
+        segments: Transcript segments in order, consumed lazily.
+        full_export: Include AI insights and the transcript appendix.
+
+    Yields:
+        Consecutive chunks of the PDF file, at most one page apart.
+    """
+    writer = PdfStreamWriter()
+    yield writer.begin()
+
+    layout = _ReportLayout(writer)
+    _render_summary(layout, meeting, full_export)
+    if chunk := layout.take():
+        yield chunk
+
+    if full_export and segments is not None:
+        started = False
+        async for segment in segments:
+            if not started:
+                layout.section("Appendix  ·  Full Transcript", _GREY500)
+                started = True
+            layout.transcript_line(
+                str(segment.get("speaker") or "Unknown"), str(segment.get("text") or "")
+            )
+            if chunk := layout.take():
+                yield chunk
+
+    yield layout.close() + writer.finish(title=str(meeting.get("title") or "Meeting Report"))
@@ -0,0 +1,413 @@
+"""PDF Writer — incremental, streaming PDF 1.4 output.
+
+Objects are serialized as soon as they are complete and handed back as
+bytes, so a caller can send each page to the client while the next one
+is laid out. Only the byte offset of every object is kept for the final
+cross-reference table — memory stays flat regardless of page count.
+
+Text uses the standard Helvetica / Helvetica-Bold fonts with WinAnsi
+encoding. Viewers ship those fonts, so no font program is embedded at
+all (smaller than any subset) and glyph widths come from the Adobe AFM
+metrics below. That covers Western European scripts only: text with
+other letters (Cyrillic, CJK, Arabic, most Central European accents)
+raises :class:`UnsupportedTextError` rather than being dropped, and the
+caller falls back to a renderer with embedded fonts.
+"""
+
+from __future__ import annotations
+
+import unicodedata
+import zlib
+from dataclasses import dataclass
+
+# US Letter in points
+PAGE_WIDTH = 612.0
+PAGE_HEIGHT = 792.0
+
+# ─── Font Metrics ─────────────────────────────────────────────────
+
+# AFM advance widths (1/1000 em) for WinAnsi codes 32..255
+_HELVETICA_WIDTHS = (
+    278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333, 278, 278,
+    556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278, 584, 584, 584, 556,
+    1015, 667, 667, 722, 722, 667, 611, 778, 722, 278, 500, 667, 556, 833, 722, 778,
+    667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 278, 278, 278, 469, 556,
+    333, 556, 556, 500, 556, 556, 278, 556, 556, 222, 222, 500, 222, 833, 556, 556,
+    556, 556, 333, 500, 278, 556, 500, 722, 500, 500, 500, 334, 260, 334, 584, 350,
+    556, 350, 222, 556, 333, 1000, 556, 556, 333, 1000, 667, 333, 1000, 350, 611, 350,
+    350, 222, 222, 333, 333, 350, 556, 1000, 333, 1000, 500, 333, 944, 350, 500, 667,
+    278, 333, 556, 556, 556, 556, 260, 556, 333, 737, 370, 556, 584, 333, 737, 333,
+    400, 584, 333, 333, 333, 556, 537, 278, 333, 333, 365, 556, 834, 834, 834, 611,
+    667, 667, 667, 667, 667, 667, 1000, 722, 667, 667, 667, 667, 278, 278, 278, 278,
+    722, 722, 778, 778, 778, 778, 778, 584, 778, 722, 722, 722, 722, 667, 667, 611,
+    556, 556, 556, 556, 556, 556, 889, 500, 556, 556, 556, 556, 278, 278, 278, 278,
+    556, 556, 556, 556, 556, 556, 556, 584, 611, 556, 556, 556, 556, 500, 556, 500,
+)  # fmt: skip
+
+_HELVETICA_BOLD_WIDTHS = (
+    278, 333, 474, 556, 556, 889, 722, 238, 333, 333, 389, 584, 278, 333, 278, 278,
+    556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 333, 333, 584, 584, 584, 611,
+    975, 722, 722, 722, 722, 667, 611, 778, 722, 278, 556, 722, 611, 833, 722, 778,
+    667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 333, 278, 333, 584, 556,
+    333, 556, 611, 556, 611, 556, 333, 611, 611, 278, 278, 556, 278, 889, 611, 611,
+    611, 611, 389, 556, 333, 611, 556, 778, 556, 556, 500, 389, 280, 389, 584, 350,
+    556, 350, 278, 556, 500, 1000, 556, 556, 333, 1000, 667, 333, 1000, 350, 611, 350,
+    350, 278, 278, 500, 500, 350, 556, 1000, 333, 1000, 556, 333, 944, 350, 500, 667,
+    278, 333, 556, 556, 556, 556, 280, 556, 333, 737, 370, 556, 584, 333, 737, 333,
+    400, 584, 333, 333, 333, 611, 556, 278, 333, 333, 365, 556, 834, 834, 834, 611,
+    722, 722, 722, 722, 722, 722, 1000, 722, 667, 667, 667, 667, 278, 278, 278, 278,
+    722, 722, 778, 778, 778, 778, 778, 584, 778, 722, 722, 722, 722, 667, 667, 611,
+    556, 556, 556, 556, 556, 556, 889, 556, 556, 556, 556, 556, 278, 278, 278, 278,
+    611, 611, 611, 611, 611, 611, 611, 584, 611, 611, 611, 611, 611, 556, 611, 556,
+)  # fmt: skip
+
+
+@dataclass(frozen=True)
+class Font:
+    """A standard (non-embedded) PDF font."""
+
+    base_font: str
+    resource: str  # name used in content streams, e.g. /F1
+    widths: tuple[int, ...]
+
+    def width(self, data: bytes, size: float) -> float:
+        """Advance width of WinAnsi-encoded text in points.
+
+        Args:
+            data: Text encoded with :func:`encode_text`.
+            size: Font size in points.
+
+        Returns:
+            Width in points.
+        """
+        widths = self.widths
+        return sum(widths[b - 32] for b in data) * size / 1000.0
+
+
+HELVETICA = Font("Helvetica", "F1", _HELVETICA_WIDTHS)
+HELVETICA_BOLD = Font("Helvetica-Bold", "F2", _HELVETICA_BOLD_WIDTHS)
+FONTS = (HELVETICA, HELVETICA_BOLD)
+
+# ─── Text Encoding & Layout ───────────────────────────────────────
+
+# Characters WinAnsi lacks but that have a close visual equivalent
+_FALLBACKS = str.maketrans({"→": "->", "←": "<-", "✓": "v", "\u00a0": " "})
+
+
+class UnsupportedTextError(ValueError):
+    """Text has letters the standard (WinAnsi) fonts cannot show."""
+
+
+def _winansi_only(text: str) -> str:
+    """Replace what WinAnsi lacks, or raise if that would lose words.
+
+    Emoji, pictographs and other symbols are removed and unusual spaces
+    become plain ones; letters, marks and digits are content.
+    """
+    kept: list[str] = []
+    for ch in text:
+        try:
+            ch.encode("cp1252")
+        except UnicodeEncodeError:
+            category = unicodedata.category(ch)[0]
+            if category in "LMN":
+                raise UnsupportedTextError(f"No WinAnsi glyph for {ch!r}") from None
+            if category == "Z":
+                kept.append(" ")
+            continue
+        kept.append(ch)
+    return "".join(kept)
+
+
+def encode_text(text: str) -> bytes:
+    """Encode text to WinAnsi for the standard fonts.
+
+    Control characters become spaces, accented Latin text is preserved,
+    and emoji and other symbols are removed.
+
+    Args:
+        text: Unicode text.
+
+    Returns:
+        WinAnsi (cp1252) bytes, every byte in the 32..255 range.
+
+    Raises:
+        UnsupportedTextError: If the text has letters outside WinAnsi.
+    """
+    text = unicodedata.normalize("NFC", text.translate(_FALLBACKS))
+    try:
+        data = text.encode("cp1252")
+    except UnicodeEncodeError:
+        data = _winansi_only(text).encode("cp1252")
+    if min(data, default=32) >= 32:
+        return data
+    return bytes(b if b >= 32 else 32 for b in data)
+
+
+def can_encode(text: str) -> bool:
+    """Whether :func:`encode_text` can render ``text`` without losing words."""
+    try:
+        encode_text(text)
+    except UnsupportedTextError:
+        return False
+    return True
+
+
+def escape_pdf_string(data: bytes) -> bytes:
+    """Escape a byte string for use inside a PDF ``( ... )`` literal."""
+    return data.replace(b"\\", b"\\\\").replace(b"(", b"\\(").replace(b")", b"\\)")
+
+
+def wrap_text(data: bytes, font: Font, size: float, max_width: float) -> list[bytes]:
+    """Greedy word wrap of encoded text to a maximum line width.
+
+    Words longer than a full line are broken between characters.
+
+    Args:
+        data: Text encoded with :func:`encode_text`.
+        font: Font used to measure.
+        size: Font size in points.
+        max_width: Available width in points.
+
+    Returns:
+        Lines of encoded text (at least one, possibly empty).
+    """
+    widths = font.widths
+    limit = max_width * 1000.0 / size  # compare in font units
+    space = widths[0]
+    lines: list[bytes] = []
+    line: list[bytes] = []
+    line_w = 0.0
+
+    for word in data.split():
+        word_w = sum(widths[b - 32] for b in word)
+        if word_w > limit:
+            # Hard-break an over-long token (URLs, IDs)
+            if line:
+                lines.append(b" ".join(line))
+                line, line_w = [], 0.0
+            start, acc = 0, 0.0
+            for i, b in enumerate(word):
+                acc += widths[b - 32]
+                if acc > limit and i > start:
+                    lines.append(word[start:i])
+                    start, acc = i, widths[b - 32]
+            word, word_w = word[start:], acc
+        needed = word_w if not line else line_w + space + word_w
+        if line and needed > limit:
+            lines.append(b" ".join(line))
+            line, line_w = [word], word_w
+        else:
+            line.append(word)
+            line_w = needed
+
+    if line or not lines:
+        lines.append(b" ".join(line))
+    return lines
+
+
+# ─── Page Content ─────────────────────────────────────────────────
+
+
+def _num(value: float) -> bytes:
+    """Format a number compactly for a content stream."""
+    return (b"%.2f" % value).rstrip(b"0").rstrip(b".")
+
+
+def _info_string(text: str) -> bytes:
+    """Encode document metadata as a UTF-16BE hex string (any script)."""
+    return b"<FEFF%s>" % text.encode("utf-16-be").hex().upper().encode()
+
+
+class PageCanvas:
+    """Accumulates drawing operators for one page."""
+
+    __slots__ = ("_ops",)
+
+    def __init__(self) -> None:
+        """Start an empty page."""
+        self._ops: list[bytes] = []
+
+    def text(
+        self,
+        x: float,
+        y: float,
+        data: bytes,
+        font: Font,
+        size: float,
+        color: tuple[float, float, float] = (0.0, 0.0, 0.0),
+    ) -> None:
+        """Draw a single line of encoded text with its baseline at ``y``."""
+        r, g, b = color
+        self._ops.append(
+            b"BT /%s %s Tf %s %s %s rg %s %s Td (%s) Tj ET\n"
+            % (
+                font.resource.encode(),
+                _num(size),
+                _num(r),
+                _num(g),
+                _num(b),
+                _num(x),
+                _num(y),
+                escape_pdf_string(data),
+            )
+        )
+
+    def rect(
+        self,
+        x: float,
+        y: float,
+        width: float,
+        height: float,
+        color: tuple[float, float, float],
+    ) -> None:
+        """Fill a rectangle whose lower-left corner is ``(x, y)``."""
+        r, g, b = color
+        self._ops.append(
+            b"%s %s %s rg %s %s %s %s re f\n"
+            % (_num(r), _num(g), _num(b), _num(x), _num(y), _num(width), _num(height))
+        )
+
+    def build(self) -> bytes:
+        """Return the raw (uncompressed) content stream."""
+        return b"".join(self._ops)
+
+
+# ─── Document Writer ──────────────────────────────────────────────
+
+_CATALOG_ID = 1
+_PAGES_ID = 2
+_FIRST_FREE_ID = 3 + len(FONTS)
+
+
+class PdfStreamWriter:
+    """Incremental PDF writer — each call returns the bytes to emit next.
+
+    Usage::
+
+        writer = PdfStreamWriter()
+        yield writer.begin()
+        for canvas in pages:
+            yield writer.add_page(canvas.build())
+        yield writer.finish(title="Report")
+
+    The page tree and catalog are written last (PDF allows objects in any
+    order), so the page count never needs to be known in advance.
+    """
+
+    def __init__(self, *, compress: bool = True) -> None:
+        """Initialize the writer.
+
+        Args:
+            compress: Deflate page content streams.
+        """
+        self._compress = compress
+        self._offset = 0
+        self._offsets: dict[int, int] = {}
+        self._page_ids: list[int] = []
+        self._next_id = _FIRST_FREE_ID
+
+    @property
+    def page_count(self) -> int:
+        """Number of pages written so far."""
+        return len(self._page_ids)
+
+    @property
+    def bytes_written(self) -> int:
+        """Total bytes emitted so far."""
+        return self._offset
+
+    def _emit(self, chunk: bytes) -> bytes:
+        self._offset += len(chunk)
+        return chunk
+
+    def _object(self, obj_id: int, body: bytes) -> bytes:
+        self._offsets[obj_id] = self._offset
+        return self._emit(b"%d 0 obj\n%s\nendobj\n" % (obj_id, body))
+
+    def _allocate(self) -> int:
+        obj_id = self._next_id
+        self._next_id += 1
+        return obj_id
+
+    def begin(self) -> bytes:
+        """Emit the file header and the shared font resources."""
+        parts = [self._emit(b"%PDF-1.4\n%\xe2\xe3\xcf\xd3\n")]
+        for i, font in enumerate(FONTS):
+            parts.append(
+                self._object(
+                    3 + i,
+                    b"<< /Type /Font /Subtype /Type1 /BaseFont /%s "
+                    b"/Encoding /WinAnsiEncoding >>" % font.base_font.encode(),
+                )
+            )
+        return b"".join(parts)
+
+    def add_page(self, content: bytes) -> bytes:
+        """Emit one page and its content stream.
+
+        Args:
+            content: Raw content stream from :meth:`PageCanvas.build`.
+
+        Returns:
+            Bytes for the content stream and page objects.
+        """
+        stream_id = self._allocate()
+        page_id = self._allocate()
+        self._page_ids.append(page_id)
+
+        if self._compress:
+            content = zlib.compress(content, 6)
+            header = b"<< /Length %d /Filter /FlateDecode >>" % len(content)
+        else:
+            header = b"<< /Length %d >>" % len(content)
+
+        fonts = b" ".join(b"/%s %d 0 R" % (f.resource.encode(), 3 + i) for i, f in enumerate(FONTS))
+        stream = self._object(stream_id, header + b"\nstream\n" + content + b"\nendstream")
+        page = self._object(
+            page_id,
+            b"<< /Type /Page /Parent %d 0 R /MediaBox [0 0 %s %s] "
+            b"/Resources << /Font << %s >> >> /Contents %d 0 R >>"
+            % (_PAGES_ID, _num(PAGE_WIDTH), _num(PAGE_HEIGHT), fonts, stream_id),
+        )
+        return stream + page
+
+    def finish(self, *, title: str = "", producer: str = "Aura Meet") -> bytes:
+        """Emit the page tree, catalog, cross-reference table, and trailer.
+
+        Args:
+            title: Document title for the info dictionary.
+            producer: Producer name for the info dictionary.
+
+        Returns:
+            Final bytes of the file.
+        """
+        kids = b" ".join(b"%d 0 R" % pid for pid in self._page_ids)
+        parts = [
+            self._object(
+                _PAGES_ID,
+                b"<< /Type /Pages /Kids [%s] /Count %d >>" % (kids, len(self._page_ids)),
+            ),
+            self._object(_CATALOG_ID, b"<< /Type /Catalog /Pages %d 0 R >>" % _PAGES_ID),
+        ]
+        info_id = self._allocate()
+        parts.append(
+            self._object(
+                info_id,
+                b"<< /Title %s /Producer %s >>" % (_info_string(title), _info_string(producer)),
+            )
+        )
+
+        xref_offset = self._offset
+        size = self._next_id
+        xref = [b"xref\n0 %d\n0000000000 65535 f \n" % size]
+        for obj_id in range(1, size):
+            xref.append(b"%010d 00000 n \n" % self._offsets[obj_id])
+        parts.append(self._emit(b"".join(xref)))
+        parts.append(
+            self._emit(
+                b"trailer\n<< /Size %d /Root %d 0 R /Info %d 0 R >>\nstartxref\n%d\n%%%%EOF\n"
+                % (size, _CATALOG_ID, info_id, xref_offset)
+            )
+        )
+        return b"".join(parts)
@@ -13,6 +13,8 @@ from typing import Any
 
 import structlog
 
+from meetmind.core import probes
+
 logger = structlog.get_logger(__name__)
 
 
@@ -69,18 +71,24 @@ class ResponseCache:
 
         if entry is None:
             self._misses += 1
+            if probes.CACHE_MISS.enabled:
+                probes.CACHE_MISS.fire("response")
             return None
 
         # Check TTL
         if time.monotonic() - entry.timestamp > self._ttl_seconds:
             del self._cache[key]
             self._misses += 1
+            if probes.CACHE_MISS.enabled:
+                probes.CACHE_MISS.fire("response")
             logger.debug("cache_expired", key=key[:8])
             return None
 
         # Move to end (LRU)
         self._cache.move_to_end(key)
         self._hits += 1
+        if probes.CACHE_HIT.enabled:
+            probes.CACHE_HIT.fire("response")
 
         logger.debug(
             "cache_hit",
@@ -0,0 +1,75 @@
+"""Compiled Templates — parse ``{{NAME}}`` placeholders once, render by join.
+
+The email templates were re-read and run through a dozen ``str.replace``
+passes per message. A template is now split once into literal fragments
+and slot names; rendering is a single ``"".join`` over the fragment list.
+"""
+
+from __future__ import annotations
+
+import html
+import re
+from functools import lru_cache
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    from collections.abc import Mapping
+    from pathlib import Path
+
+_PLACEHOLDER = re.compile(r"\{\{([A-Z0-9_]+)\}\}")
+
+
+class CompiledTemplate:
+    """A template pre-split into literal fragments and named slots.
+
+    Fragments alternate literal, slot, literal, ... so even indices are
+    literals and odd indices are slot names. Unknown slots render as their
+    original ``{{NAME}}`` text, matching the old ``str.replace`` behavior.
+    """
+
+    __slots__ = ("_fragments", "slots")
+
+    def __init__(self, source: str) -> None:
+        """Compile a template source string.
+
+        Args:
+            source: Template text with ``{{NAME}}`` placeholders.
+        """
+        self._fragments: list[str] = _PLACEHOLDER.split(source)
+        self.slots: frozenset[str] = frozenset(self._fragments[1::2])
+
+    def render(self, values: Mapping[str, str]) -> str:
+        """Render the template with the given slot values.
+
+        Values are inserted verbatim — escape untrusted text with
+        :func:`escape` before passing it in.
+
+        Args:
+            values: Slot name → replacement text.
+
+        Returns:
+            Rendered text.
+        """
+        parts = self._fragments[:]
+        for i in range(1, len(parts), 2):
+            name = parts[i]
+            parts[i] = values.get(name, f"{{{{{name}}}}}")
+        return "".join(parts)
+
+
+def escape(text: object) -> str:
+    """HTML-escape untrusted text (LLM output, user names) for templates."""
+    return html.escape(str(text), quote=True)
+
+
+@lru_cache(maxsize=16)
+def load_template(path: Path) -> CompiledTemplate:
+    """Read and compile a template file once per process.
+
+    Args:
+        path: Template file path.
+
+    Returns:
+        The compiled template.
+    """
+    return CompiledTemplate(path.read_text(encoding="utf-8"))
@@ -0,0 +1,144 @@
+"""Tests for the per-meeting cost ledger and provider-aware pricing."""
+
+from __future__ import annotations
+
+import asyncio
+from typing import TYPE_CHECKING
+from unittest.mock import AsyncMock, patch
+
+import pytest
+
+from meetmind.core import cost_ledger
+from meetmind.core.cost_ledger import KIND_CPU, KIND_LLM, CostLedger, LedgerRow
+from meetmind.utils.cost_tracker import CostTracker, price_tier, price_usd
+
+if TYPE_CHECKING:
+    from pathlib import Path
+
+
+# ─── Pricing ────────────────────────────────────────────────────
+
+
+def test_openai_models_priced_from_their_own_table() -> None:
+    """OpenAI-compatible models aren't billed at Bedrock rates; cache hits are cheaper."""
+    assert price_tier("openai", "gpt-4o-mini-2024-07-18") == "gpt-4o-mini"
+    assert price_tier("openai", "llama-3.3-70b-versatile") == "llama-3.3-70b-versatile"
+    assert price_tier("bedrock", "us.anthropic.claude-3-5-haiku-20241022-v1:0") == "haiku"
+
+    assert price_usd("openai", "gpt-4o", 1_000_000, 1_000_000) == pytest.approx(12.50)
+    assert price_usd("openai", "gpt-4o", 0, 0, cached_tokens=1_000_000) == pytest.approx(1.25)
+
+
+def test_cache_writes_billed_at_the_write_rate() -> None:
+    """Bedrock prompt-cache writes cost more than input and land in the ledger."""
+    assert price_usd("bedrock", "sonnet", 0, 0, cache_write_tokens=1_000_000) == pytest.approx(3.75)
+
+    ledger = CostLedger()
+    with cost_ledger.meeting("m-1"):
+        cost = ledger.record_llm(
+            "bedrock", "sonnet", input_tokens=1000, output_tokens=0, cache_write_tokens=4000
+        )
+    assert cost == pytest.approx((1000 * 3.00 + 4000 * 3.75) / 1_000_000)
+    assert ledger.totals["m-1"] == pytest.approx(cost)
+    assert ledger._rows[0].input_tokens == 5000
+
+
+def test_tracker_snapshot_from_before_provider_pricing() -> None:
+    """Old snapshots (no provider, no cached column) restore as Bedrock usage."""
+    tracker = CostTracker.from_state(
+        {
+            "budget": 1.0,
+            "usage": [["haiku", 1_000_000, 0, 3]],
+            "requests": 3,
+            "savings": 0,
+            "elapsed": 5.0,
+        }
+    )
+    assert tracker.total_cost_usd == pytest.approx(0.25)
+
+    restored = CostTracker.from_state(tracker.export_state())
+    assert restored.total_cost_usd == tracker.total_cost_usd
+
+
+# ─── Attribution ────────────────────────────────────────────────
+
+
+async def test_rows_attributed_to_the_current_meeting() -> None:
+    """Calls inside ``meeting()`` (and tasks spawned there) are billed to it."""
+    ledger = CostLedger()
+
+    async def background_call() -> None:
+        ledger.record_llm("openai", "gpt-4o", input_tokens=1000, output_tokens=100)
+
+    with cost_ledger.meeting("m-1"):
+        ledger.record_llm("openai", "gpt-4o-mini", input_tokens=500, output_tokens=10)
+        task = asyncio.create_task(background_call())
+    await task
+    ledger.record_llm("openai", "gpt-4o", input_tokens=1, output_tokens=1)
+
+    assert set(ledger.totals) == {"m-1"}
+    assert ledger.totals["m-1"] == pytest.approx(
+        price_usd("openai", "gpt-4o-mini", 500, 10) + price_usd("openai", "gpt-4o", 1000, 100)
+    )
+    assert [r.meeting_id for r in ledger._rows] == ["m-1", "m-1", ""]
+
+
+def test_cpu_stage_priced_per_vcpu_hour() -> None:
+    """CPU rows carry the stage and cost its CPU time at the configured rate."""
+    with cost_ledger.meeting("m-cpu"), cost_ledger.cpu("ingest"):
+        sum(i * i for i in range(200_000))
+
+    row = cost_ledger.ledger._rows[-1]
+    assert (row.kind, row.model, row.meeting_id) == (KIND_CPU, "ingest", "m-cpu")
+    assert row.latency_us > 0
+    assert row.cost_usd == pytest.approx(row.latency_us / 3.6e9 * 0.04048)
+
+
+# ─── Log ────────────────────────────────────────────────────────
+
+
+def test_log_roundtrip_and_torn_tail(tmp_path: Path) -> None:
+    """Blocks append and decode back; a half-written last block is ignored."""
+    rows = [
+        LedgerRow(1_000, KIND_LLM, "m-1", "bedrock", "sonnet-id", 10, 90, 5, 1_200, 0.0012),
+        LedgerRow(1_050, KIND_CPU, "m-1", "cpu", "ingest", latency_us=300, cost_usd=3e-9),
+        LedgerRow(2_000, KIND_LLM, "", "openai", "gpt-4o", 1, 0, 1, 900, 1.25e-5),
+    ]
+    path = cost_ledger.append_block(tmp_path, rows[:2])
+    cost_ledger.append_block(tmp_path, rows[2:])
+    assert cost_ledger.read_log(path) == rows
+
+    with path.open("ab") as f:
+        f.write(cost_ledger.encode_block(rows)[:-3])
+    assert cost_ledger.read_log(path) == rows
+
+    totals = cost_ledger.summarize(rows)
+    assert totals["m-1"]["llm_calls"] == 1
+    assert totals["m-1"]["tokens"] == 105
+    assert totals["(unattributed)"]["cost_usd"] == pytest.approx(1.25e-5)
+
+
+# ─── Rollup ─────────────────────────────────────────────────────
+
+
+@patch("meetmind.core.cost_ledger.storage")
+async def test_flush_rolls_up_and_retries(mock_storage: AsyncMock, tmp_path: Path) -> None:
+    """Each flush adds only new cost; a failed rollup is carried to the next."""
+    mock_storage.add_meeting_costs = AsyncMock(side_effect=[RuntimeError("db down"), 2])
+    ledger = CostLedger()
+    with cost_ledger.meeting("m-1"):
+        ledger.record_llm("bedrock", "haiku", input_tokens=1_000_000, output_tokens=0)
+    ledger.record_llm("bedrock", "haiku", input_tokens=5, output_tokens=5)
+
+    with patch.object(cost_ledger.settings, "cost_ledger_dir", str(tmp_path)):
+        assert await ledger.flush() == 2
+        with cost_ledger.meeting("m-2"):
+            ledger.record_llm("bedrock", "haiku", input_tokens=0, output_tokens=1_000_000)
+        assert await ledger.flush() == 1
+
+    (deltas,) = mock_storage.add_meeting_costs.await_args.args
+    assert dict(deltas) == {"m-1": pytest.approx(0.25), "m-2": pytest.approx(1.25)}
+    assert len(cost_ledger.read_log(next(tmp_path.iterdir()))) == 3
+
+    assert await ledger.flush() == 0  # nothing new, nothing rolled up
+    assert mock_storage.add_meeting_costs.await_count == 2
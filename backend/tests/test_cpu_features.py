@@ -0,0 +1,37 @@
+"""Tests for host CPU feature detection."""
+
+from meetmind.utils.cpu_features import detect, parse_cpuinfo_flags
+
+X86_CPUINFO = """processor\t: 0
+vendor_id\t: GenuineIntel
+flags\t\t: fpu sse4_1 sse4_2 popcnt avx avx2 fma bmi2 avx512f avx512bw avx512vl
+"""
+
+GRAVITON3_CPUINFO = """processor\t: 0
+BogoMIPS\t: 2100.00
+Features\t: fp asimd evtstrm aes pmull sha1 sha2 crc32 atomics sve
+"""
+
+
+def test_parse_flags_x86_and_arm() -> None:
+    """Both kernel spellings of the feature line are understood."""
+    assert "avx2" in parse_cpuinfo_flags(X86_CPUINFO)
+    assert "sve" in parse_cpuinfo_flags(GRAVITON3_CPUINFO)
+    assert parse_cpuinfo_flags("") == frozenset()
+
+
+def test_x86_tiers() -> None:
+    """The best complete tier wins; partial AVX-512 falls back to AVX2."""
+    assert detect("x86_64", X86_CPUINFO).isa == "avx512"
+    no_512 = X86_CPUINFO.replace(" avx512vl", "")
+    assert detect("x86_64", no_512).isa == "avx2"
+    assert detect("AMD64", "flags: sse4_2 popcnt").isa == "sse4"
+    assert detect("x86_64", "").isa == "baseline"
+
+
+def test_arm_tiers() -> None:
+    """Graviton3 reports SVE; NEON is assumed on any arm64 host."""
+    features = detect("aarch64", GRAVITON3_CPUINFO)
+    assert (features.arch, features.isa) == ("arm64", "sve")
+    assert detect("arm64", "").isa == "neon"
+    assert detect("riscv64", "").to_dict()["isa"] == "baseline"
@@ -0,0 +1,199 @@
+"""Tests for compiled email templates and the batched SES send queue."""
+
+from __future__ import annotations
+
+import threading
+from typing import Any
+from unittest.mock import patch
+
+from botocore.exceptions import ClientError
+
+from meetmind.utils.email_queue import EmailJob, EmailSendQueue, is_retryable
+from meetmind.utils.email_service import SESEmailService, _render_action_items_html
+from meetmind.utils.template import CompiledTemplate
+
+
+class FakeSES:
+    """Local SES stand-in — records messages, optionally fails first N calls."""
+
+    def __init__(self, fail_times: int = 0, code: str = "Throttling") -> None:
+        self.sent: list[dict[str, Any]] = []
+        self.calls = 0
+        self.threads: set[str] = set()
+        self._fail_times = fail_times
+        self._code = code
+        self._lock = threading.Lock()
+
+    def send_raw_email(self, **kwargs: Any) -> dict[str, str]:
+        with self._lock:
+            self.calls += 1
+            self.threads.add(threading.current_thread().name)
+            if self.calls <= self._fail_times:
+                raise ClientError({"Error": {"Code": self._code}}, "SendRawEmail")
+            self.sent.append(kwargs)
+        return {"MessageId": f"msg-{self.calls}"}
+
+
+def _job(n: int = 0) -> EmailJob:
+    return EmailJob(
+        to_email=f"user{n}@example.com",
+        subject="Summary",
+        html_body="<p>hi</p>",
+        plain_body="hi",
+        meeting_id=f"m-{n}",
+    )
+
+
+# ─── Compiled Templates ─────────────────────────────────────────
+
+
+def test_compiled_template_renders_slots() -> None:
+    """Slots are filled and literals preserved."""
+    tpl = CompiledTemplate("Hello {{NAME}}, see {{URL}} and {{URL}}.")
+    assert tpl.slots == frozenset({"NAME", "URL"})
+    assert tpl.render({"NAME": "Ana", "URL": "x.io"}) == "Hello Ana, see x.io and x.io."
+
+
+def test_compiled_template_keeps_unknown_slots() -> None:
+    """Missing values leave the placeholder untouched."""
+    tpl = CompiledTemplate("{{A}}-{{B}}")
+    assert tpl.render({"A": "1"}) == "1-{{B}}"
+
+
+def test_action_items_escaped() -> None:
+    """LLM-provided text is HTML-escaped in rendered rows."""
+    html = _render_action_items_html([{"task": "<script>x</script>", "assignee": "Bo & Al"}])
+    assert "&lt;script&gt;" in html
+    assert "Bo &amp; Al" in html
+    assert "<script>" not in html
+
+
+def test_render_email_fills_template() -> None:
+    """The full summary template has no unfilled placeholders."""
+    service = SESEmailService(client=FakeSES())
+    html, plain = service._render_email(
+        user_name="Ana",
+        meeting_id="m-1",
+        meeting_title="Roadmap",
+        meeting_date="2026-01-05T10:00:00Z",
+        duration_secs=3900,
+        summary={"overview": "Plan Q1", "action_items": [{"task": "Ship"}]},
+    )
+    assert "{{" not in html
+    assert "Roadmap" in html
+    assert "1h 5min" in html
+    assert "Ship" in plain
+
+
+# ─── Send Queue ─────────────────────────────────────────────────
+
+
+async def test_queue_sends_on_dedicated_pool() -> None:
+    """Queued jobs are delivered on the queue's own threads."""
+    ses = FakeSES()
+    service = SESEmailService(client=ses)
+    queue = EmailSendQueue(service._send_job, concurrency=2, batch_size=4)
+
+    for n in range(6):
+        assert await queue.submit(_job(n)) is True
+    await queue.close()
+
+    assert len(ses.sent) == 6
+    assert all(name.startswith("email-send") for name in ses.threads)
+    assert queue.to_dict()["sent"] == 6
+
+
+async def test_queue_retries_throttling() -> None:
+    """Throttling errors are retried with backoff until success."""
+    ses = FakeSES(fail_times=2, code="Throttling")
+    queue = EmailSendQueue(
+        SESEmailService(client=ses)._send_job, max_retries=3, backoff_base_s=0.001
+    )
+
+    await queue.submit(_job())
+    await queue.close()
+
+    assert len(ses.sent) == 1
+    stats = queue.to_dict()
+    assert stats["retried"] == 2
+    assert stats["failed"] == 0
+
+
+async def test_queue_fails_fast_on_rejection() -> None:
+    """Non-retryable SES errors are not retried."""
+    ses = FakeSES(fail_times=5, code="MessageRejected")
+    queue = EmailSendQueue(
+        SESEmailService(client=ses)._send_job, max_retries=3, backoff_base_s=0.001
+    )
+
+    await queue.submit(_job())
+    await queue.close()
+
+    assert ses.calls == 1
+    assert queue.to_dict()["failed"] == 1
+
+
+async def test_queue_rejects_when_full() -> None:
+    """Jobs beyond capacity are rejected instead of blocking."""
+    gate = threading.Event()
+    queue = EmailSendQueue(lambda _job: gate.wait(), max_queued=1, batch_size=1)
+
+    results = [await queue.submit(_job(n)) for n in range(4)]
+    gate.set()
+    await queue.close()
+
+    assert results.count(False) >= 1
+    assert queue.to_dict()["rejected"] >= 1
+
+
+def test_is_retryable() -> None:
+    """Retry classification covers throttling and network errors only."""
+    assert is_retryable(ClientError({"Error": {"Code": "Throttling"}}, "op")) is True
+    assert is_retryable(ClientError({"Error": {"Code": "MessageRejected"}}, "op")) is False
+    assert is_retryable(ConnectionError()) is True
+    assert is_retryable(ValueError()) is False
+
+
+# ─── Service ────────────────────────────────────────────────────
+
+
+async def test_send_meeting_summary_queues_email() -> None:
+    """send_meeting_summary renders and delivers through the queue."""
+    ses = FakeSES()
+    service = SESEmailService(client=ses)
+
+    with patch("meetmind.utils.email_service.settings") as mock_settings:
+        mock_settings.ses_sender = "noreply@aurameet.live"
+        mock_settings.ses_sender_name = "Aura Meet"
+        queued = await service.send_meeting_summary(
+            user_email="ana@example.com",
+            user_name="Ana",
+            meeting_id="m-1",
+            meeting_title="Standup",
+            meeting_date=None,
+            duration_secs=600,
+            summary={"overview": "All good"},
+            language="en",
+        )
+        await service.close()
+
+    assert queued is True
+    assert len(ses.sent) == 1
+    assert ses.sent[0]["Destinations"] == ["ana@example.com"]
+
+
+async def test_send_meeting_summary_disabled_without_sender() -> None:
+    """No sender configured → nothing is queued."""
+    service = SESEmailService(client=FakeSES())
+    with patch("meetmind.utils.email_service.settings") as mock_settings:
+        mock_settings.ses_sender = ""
+        queued = await service.send_meeting_summary(
+            user_email="ana@example.com",
+            user_name="Ana",
+            meeting_id="m-1",
+            meeting_title="Standup",
+            meeting_date=None,
+            duration_secs=None,
+            summary={},
+        )
+    assert queued is False
@@ -0,0 +1,275 @@
+"""Tests for the live event hub, SSE rendering, and pushed meeting results."""
+
+from __future__ import annotations
+
+import asyncio
+import json
+from unittest.mock import AsyncMock, MagicMock, patch
+
+from meetmind.api.meeting_api import MeetingManager
+from meetmind.core import event_hub as events
+from meetmind.core.event_hub import EventHub, parse_last_event_id, sse_stream
+
+
+def _decode(frame: bytes) -> tuple[str, dict[str, object]]:
+    lines = dict(line.split(": ", 1) for line in frame.decode().strip().split("\n"))
+    return lines["event"], json.loads(lines["data"])
+
+
+# ─── Hub ────────────────────────────────────────────────────────
+
+
+async def test_publish_fans_out_to_user_connections() -> None:
+    """Every connection of the owner receives the same frame; others don't."""
+    hub = EventHub()
+    phone = hub.subscribe("user-1")
+    laptop = hub.subscribe("user-1")
+    stranger = hub.subscribe("user-2")
+
+    delivered = hub.publish("user-1", events.INSIGHT, {"title": "Risk"}, meeting_id="m-1")
+
+    assert delivered == 2
+    first, second = await phone.next(timeout=0.1), await laptop.next(timeout=0.1)
+    assert first is second  # serialized once, shared
+    assert first is not None
+    event_type, data = _decode(first.frame)
+    assert event_type == "insight"
+    assert data["title"] == "Risk"
+    assert data["meeting_id"] == "m-1"
+    assert await stranger.next(timeout=0.01) is None
+
+
+async def test_slow_subscriber_drops_oldest() -> None:
+    """A full queue drops its oldest events instead of blocking publish."""
+    hub = EventHub(max_queued=2)
+    sub = hub.subscribe("user-1")
+
+    for n in range(5):
+        hub.publish("user-1", events.SCREENING, {"n": n})
+
+    received = [await sub.next(timeout=0.1) for _ in range(2)]
+    assert [_decode(e.frame)[1]["n"] for e in received if e] == [3, 4]
+    assert sub.dropped == 3
+
+
+async def test_resume_with_last_event_id() -> None:
+    """Reconnecting clients get buffered events after their last ID."""
+    hub = EventHub(replay_size=10)
+    first = hub.publish("user-1", events.SCREENING, {"n": 1})
+    hub.publish("user-1", events.SCREENING, {"n": 2})
+    hub.publish("user-1", events.SCREENING, {"n": 3})
+    assert first == 0  # nobody connected yet
+
+    sub = hub.subscribe("user-1", last_event_id=1)
+
+    received = [await sub.next(timeout=0.1) for _ in range(2)]
+    assert [_decode(e.frame)[1]["n"] for e in received if e] == [2, 3]
+
+
+def test_unsubscribe_and_stats() -> None:
+    """Closing the last connection removes the user."""
+    hub = EventHub()
+    sub = hub.subscribe("user-1")
+    assert hub.has_subscribers("user-1") is True
+
+    sub.close()
+    sub.close()  # idempotent
+
+    assert hub.has_subscribers("user-1") is False
+    assert hub.has_subscribers(None) is False
+    assert hub.to_dict()["connections"] == 0
+
+
+def test_publish_without_owner_is_noop() -> None:
+    """Meetings without an owner publish nothing."""
+    hub = EventHub()
+    assert hub.publish(None, events.SUMMARY, {}) == 0
+    assert hub.to_dict()["published"] == 0
+
+
+def test_parse_last_event_id() -> None:
+    """Invalid header values are ignored."""
+    assert parse_last_event_id("42") == 42
+    assert parse_last_event_id("abc") is None
+    assert parse_last_event_id(None) is None
+
+
+# ─── SSE Stream ─────────────────────────────────────────────────
+
+
+async def test_sse_stream_heartbeat_and_close() -> None:
+    """Idle streams send heartbeats and detach when the client leaves."""
+    hub = EventHub()
+    sub = hub.subscribe("user-1")
+    disconnected = AsyncMock(side_effect=[False, True])
+    stream = sse_stream(sub, heartbeat_s=0.01, is_disconnected=disconnected)
+
+    frames = [frame async for frame in stream]
+
+    assert frames == [b"retry: 3000\n\n", b": ping\n\n"]
+    assert hub.has_subscribers("user-1") is False
+
+
+# ─── Meeting Manager ────────────────────────────────────────────
+
+
+def _manager_with_agents() -> MeetingManager:
+    manager = MeetingManager()
+    screening = MagicMock(
+        relevant=True, reason="decision", input_tokens=1, output_tokens=1, cached_tokens=0
+    )
+    screening.to_dict.return_value = {"relevant": True, "reason": "decision"}
+    insight = MagicMock(input_tokens=1, output_tokens=1, cached_tokens=0)
+    insight.to_dict.return_value = {"title": "Budget", "category": "decision"}
+
+    manager._screening_agent = MagicMock(screen=AsyncMock(return_value=screening))
+    manager._analysis_agent = MagicMock(analyze=AsyncMock(return_value=insight))
+    return manager
+
+
+@patch("meetmind.core.transcript.TranscriptManager.should_screen", return_value=True)
+@patch("meetmind.api.meeting_api.storage")
+async def test_screening_pushed_when_subscribed(mock_storage: MagicMock, _: MagicMock) -> None:
+    """With the client reading the live stream, screening runs detached and is pushed."""
+    mock_storage.create_meeting = AsyncMock()
+    mock_storage.save_segments = AsyncMock()
+    mock_storage.save_insight = AsyncMock()
+    hub = EventHub()
+    manager = _manager_with_agents()
+
+    with patch("meetmind.api.meeting_api.event_hub", hub):
+        sub = hub.subscribe("user-1")
+        result = await manager.ingest_transcript(
+            "m-1", [{"text": "We approve the budget", "speaker": "A"}], user_id="user-1", push=True
+        )
+        assert result["screening_pending"] is True
+        assert result["screening"] is None
+
+        screening = await sub.next(timeout=1.0)
+        insight = await sub.next(timeout=1.0)
+
+    assert screening is not None
+    assert insight is not None
+    assert _decode(screening.frame)[0] == "screening"
+    event_type, data = _decode(insight.frame)
+    assert event_type == "insight"
+    assert data["title"] == "Budget"
+
+
+@patch("meetmind.core.transcript.TranscriptManager.should_screen", return_value=True)
+@patch("meetmind.api.meeting_api.storage")
+async def test_screening_inline_without_subscribers(mock_storage: MagicMock, _: MagicMock) -> None:
+    """Without a live connection, results stay in the response as before."""
+    mock_storage.create_meeting = AsyncMock()
+    mock_storage.save_segments = AsyncMock()
+    mock_storage.save_insight = AsyncMock()
+    manager = _manager_with_agents()
+
+    with patch("meetmind.api.meeting_api.event_hub", EventHub()):
+        result = await manager.ingest_transcript(
+            "m-2", [{"text": "We approve the budget", "speaker": "A"}], user_id="user-1"
+        )
+
+    assert "screening_pending" not in result
+    assert result["screening"]["analysis"]["title"] == "Budget"
+
+
+@patch("meetmind.core.transcript.TranscriptManager.should_screen", return_value=True)
+@patch("meetmind.api.meeting_api.storage")
+async def test_other_device_subscribed_keeps_results_inline(
+    mock_storage: MagicMock, _: MagicMock
+) -> None:
+    """A stream open on another device doesn't detach this client's screening."""
+    mock_storage.create_meeting = AsyncMock()
+    mock_storage.save_segments = AsyncMock()
+    mock_storage.save_insight = AsyncMock()
+    hub = EventHub()
+    manager = _manager_with_agents()
+
+    with patch("meetmind.api.meeting_api.event_hub", hub):
+        hub.subscribe("user-1")  # the laptop — not the phone that's ingesting
+        result = await manager.ingest_transcript(
+            "m-5", [{"text": "We approve the budget", "speaker": "A"}], user_id="user-1"
+        )
+
+    assert "screening_pending" not in result
+    assert result["screening"]["analysis"]["title"] == "Budget"
+
+
+@patch("meetmind.core.transcript.TranscriptManager.should_screen", return_value=True)
+@patch("meetmind.api.meeting_api.storage")
+async def test_one_screening_in_flight_per_meeting(mock_storage: MagicMock, _: MagicMock) -> None:
+    """Batches arriving mid-screening are buffered, not screened in parallel."""
+    mock_storage.create_meeting = AsyncMock()
+    mock_storage.save_segments = AsyncMock()
+    mock_storage.save_insight = AsyncMock()
+    hub = EventHub()
+    manager = _manager_with_agents()
+    release = asyncio.Event()
+    screen = manager._screening_agent.screen
+    result = screen.return_value
+
+    async def slow_screen(*args: object, **kwargs: object) -> object:
+        await release.wait()
+        return result
+
+    screen.side_effect = slow_screen
+
+    with patch("meetmind.api.meeting_api.event_hub", hub):
+        hub.subscribe("user-1")
+        for text in ("First point", "Second point", "Third point"):
+            await manager.ingest_transcript("m-6", [{"text": text}], user_id="user-1", push=True)
+        await asyncio.sleep(0)  # let the background screening start
+        assert screen.await_count == 1
+        assert manager._transcripts["m-6"].buffer_size == 2
+
+        release.set()
+        await asyncio.gather(*manager._background)
+        assert manager._screening == set()
+
+        await manager.ingest_transcript("m-6", [{"text": "Fourth"}], user_id="user-1", push=True)
+        await asyncio.gather(*manager._background)
+
+    assert screen.await_count == 2
+    assert "Second point" in screen.await_args.args[0]
+
+
+@patch("meetmind.core.transcript.TranscriptManager.should_screen", return_value=True)
+@patch("meetmind.api.meeting_api.storage")
+async def test_retried_batch_not_screened_again(mock_storage: MagicMock, _: MagicMock) -> None:
+    """Segments the DB already holds (by client id) are skipped on retry."""
+    mock_storage.create_meeting = AsyncMock()
+    mock_storage.save_segments = AsyncMock(side_effect=[{1, 2}, set()])
+    mock_storage.save_insight = AsyncMock()
+    manager = _manager_with_agents()
+    batch = [
+        {"id": 1, "text": "We approve the budget", "speaker": "A"},
+        {"id": 2, "text": "Launch is in May", "speaker": "B"},
+    ]
+
+    with patch("meetmind.api.meeting_api.event_hub", EventHub()):
+        first = await manager.ingest_transcript("m-3", batch, user_id="user-1")
+        retry = await manager.ingest_transcript("m-3", batch, user_id="user-1")
+
+    assert first["segments_added"] == 2
+    assert retry == {"segments_added": 0, "screening": None}
+    assert manager._transcripts["m-3"].segment_count == 2
+    manager._screening_agent.screen.assert_awaited_once()
+
+
+@patch("meetmind.api.meeting_api.storage")
+async def test_persist_only_skips_session_and_screening(mock_storage: MagicMock) -> None:
+    """Late uploads for an ended meeting are stored without a live session."""
+    mock_storage.create_meeting = AsyncMock()
+    mock_storage.save_segments = AsyncMock(return_value={7})
+    manager = _manager_with_agents()
+
+    result = await manager.persist_transcript(
+        "m-4",
+        [{"id": 7, "text": "Late words", "speaker": "A"}, {"id": 6, "text": "Seen"}],
+        user_id="user-1",
+    )
+
+    assert result == {"segments_added": 1, "screening": None}
+    assert "m-4" not in manager._transcripts
+    manager._screening_agent.screen.assert_not_awaited()
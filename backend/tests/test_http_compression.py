@@ -0,0 +1,215 @@
+"""Tests for dictionary zstd / gzip HTTP compression."""
+
+from __future__ import annotations
+
+import gzip
+import json
+from unittest.mock import AsyncMock, patch
+
+import pytest
+from fastapi.testclient import TestClient
+
+from meetmind.utils import http_compression
+from meetmind.utils.http_compression import (
+    DCZ_HEADER_SIZE,
+    DCZ_MAGIC,
+    CompressionDictionary,
+    DecompressionError,
+    build_default_dictionary,
+    compress,
+    decompress,
+    load_dictionary,
+    negotiate,
+)
+
+DICTIONARY = CompressionDictionary(build_default_dictionary())
+
+MEETING = {
+    "id": "m-1",
+    "title": "Weekly sync",
+    "segments": [
+        {"speaker": "Ana", "text": f"Point {i}", "timestamp_unix": 1.0 + i, "segment_index": i}
+        for i in range(40)
+    ],
+    "insights": [
+        {"insight_type": "insight", "title": "Risk", "category": "risk", "importance": "high"}
+    ],
+}
+
+
+# ─── Negotiation ────────────────────────────────────────────────
+
+
+def test_negotiate_prefers_dictionary_when_hash_matches() -> None:
+    """dcz is only chosen when the client holds our exact dictionary."""
+    accept = "gzip, deflate, br, zstd, dcz"
+    assert negotiate(accept, DICTIONARY.header_value, DICTIONARY) == "dcz"
+    assert negotiate(accept, ":AAAA:", DICTIONARY) == "zstd"
+    assert negotiate(accept, None, DICTIONARY) == "zstd"
+
+
+def test_negotiate_fallbacks() -> None:
+    """gzip for dart:io-style clients, identity when nothing matches or q=0."""
+    assert negotiate("gzip", None, DICTIONARY) == "gzip"
+    assert negotiate("zstd;q=0, gzip;q=0.5", None, DICTIONARY) == "gzip"
+    assert negotiate("br", None, DICTIONARY) is None
+    assert negotiate("", None, DICTIONARY) is None
+
+
+# ─── Codecs ─────────────────────────────────────────────────────
+
+
+@pytest.mark.parametrize(
+    "encoding",
+    ["dcz", "zstd", "gzip"],
+)
+def test_roundtrip(encoding: str) -> None:
+    """Every coding decodes back to the original body."""
+    body = json.dumps(MEETING).encode()
+    assert decompress(compress(body, encoding, DICTIONARY), encoding, DICTIONARY) == body
+
+
+def test_dcz_framing_and_dictionary_gain() -> None:
+    """dcz bodies carry the dictionary hash and beat plain zstd on small JSON."""
+    body = json.dumps(MEETING["insights"]).encode()
+    dcz = compress(body, "dcz", DICTIONARY)
+    plain = compress(body, "zstd", DICTIONARY)
+
+    assert dcz[: len(DCZ_MAGIC)] == DCZ_MAGIC
+    assert dcz[len(DCZ_MAGIC) : DCZ_HEADER_SIZE] == DICTIONARY.sha256
+    assert len(dcz) - DCZ_HEADER_SIZE < len(plain)
+
+
+def test_dcz_readable_by_reference_decoder() -> None:
+    """The frame decodes with the dictionary loaded as raw content."""
+    body = json.dumps(MEETING).encode()
+    frame = compress(body, "dcz", DICTIONARY)[DCZ_HEADER_SIZE:]
+    zstandard = http_compression.zstandard
+    zdict = zstandard.ZstdCompressionDict(
+        build_default_dictionary(), dict_type=zstandard.DICT_TYPE_RAWCONTENT
+    )
+    assert zstandard.ZstdDecompressor(dict_data=zdict).decompress(frame) == body
+
+
+def test_decompress_rejects_bad_input() -> None:
+    """Corrupt data, foreign dictionaries, bombs, and unknown codings fail cleanly."""
+    other = CompressionDictionary(b"another dictionary")
+    body = json.dumps(MEETING).encode()
+
+    with pytest.raises(DecompressionError, match="Corrupt"):
+        decompress(b"not gzip", "gzip", DICTIONARY)
+    with pytest.raises(DecompressionError, match="Unknown dictionary"):
+        decompress(compress(body, "dcz", other), "dcz", DICTIONARY)
+    with pytest.raises(DecompressionError, match="too large"):
+        decompress(gzip.compress(b"0" * 10_000), "gzip", DICTIONARY, limit=1000)
+    with pytest.raises(DecompressionError, match="too large"):
+        decompress(compress(b"0" * 10_000, "zstd", DICTIONARY), "zstd", DICTIONARY, limit=1000)
+    with pytest.raises(DecompressionError, match="Unsupported"):
+        decompress(body, "br", DICTIONARY)
+
+
+def test_load_dictionary_falls_back_to_builtin(tmp_path: object) -> None:
+    """A missing trained file keeps the built-in dictionary."""
+    assert load_dictionary("/nonexistent/dict").data == build_default_dictionary()
+    path = tmp_path / "trained.dict"  # type: ignore[operator]
+    path.write_bytes(b"trained")
+    assert load_dictionary(str(path)).data == b"trained"
+
+
+# ─── Middleware ─────────────────────────────────────────────────
+
+
+def _authed_client() -> TestClient:
+    from meetmind.core.auth import create_access_token
+    from meetmind.main import app
+
+    client = TestClient(app, raise_server_exceptions=False)
+    token = create_access_token("test-user-id", "test@example.com")
+    client.headers.update({"Authorization": f"Bearer {token}"})
+    return client
+
+
+@patch("meetmind.main.storage")
+def test_meeting_detail_served_with_dictionary(mock_storage: AsyncMock) -> None:
+    """Clients advertising the dictionary get a dcz body."""
+    from meetmind.main import compression_dictionary
+
+    mock_storage.get_meeting = AsyncMock(return_value={**MEETING, "user_id": "test-user-id"})
+
+    response = _authed_client().get(
+        "/api/meetings/m-1",
+        headers={
+            "Accept-Encoding": "dcz, zstd, gzip",
+            "Available-Dictionary": compression_dictionary.header_value,
+        },
+    )
+
+    assert response.status_code == 200
+    assert response.headers["content-encoding"] == "dcz"
+    assert "Available-Dictionary" in response.headers["vary"]
+    assert json.loads(decompress(response.content, "dcz", compression_dictionary)) == {
+        **MEETING,
+        "user_id": "test-user-id",
+    }
+
+
+@patch("meetmind.main.storage")
+def test_meeting_detail_served_with_zstd(mock_storage: AsyncMock) -> None:
+    """Clients without the dictionary still get zstd over gzip."""
+    mock_storage.get_meeting = AsyncMock(return_value={**MEETING, "user_id": "test-user-id"})
+
+    response = _authed_client().get("/api/meetings/m-1", headers={"Accept-Encoding": "gzip, zstd"})
+
+    assert response.status_code == 200
+    assert response.headers["content-encoding"] == "zstd"
+    assert json.loads(decompress(response.content, "zstd", DICTIONARY))["title"] == "Weekly sync"
+
+
+@patch("meetmind.main.storage")
+def test_small_responses_not_compressed(mock_storage: AsyncMock) -> None:
+    """Payloads under the threshold go out as-is."""
+    mock_storage.get_meeting = AsyncMock(return_value={"id": "m-1", "user_id": "test-user-id"})
+
+    response = _authed_client().get("/api/meetings/m-1", headers={"Accept-Encoding": "zstd"})
+
+    assert response.status_code == 200
+    assert "content-encoding" not in response.headers
+    assert response.json()["id"] == "m-1"
+
+
+@patch("meetmind.main.meeting_manager")
+def test_gzip_request_body_decoded(mock_manager: AsyncMock) -> None:
+    """Compressed copilot requests reach the route as plain JSON."""
+    mock_manager.run_copilot = AsyncMock(return_value={"answer": "ok"})
+    payload = {"question": "What was decided?", "transcript_context": "Ana: budget " * 200}
+
+    response = _authed_client().post(
+        "/api/meetings/m-1/copilot",
+        content=gzip.compress(json.dumps(payload).encode()),
+        headers={"Content-Type": "application/json", "Content-Encoding": "gzip"},
+    )
+
+    assert response.status_code == 200
+    kwargs = mock_manager.run_copilot.await_args.kwargs
+    assert kwargs["transcript_context"] == payload["transcript_context"]
+
+
+def test_unsupported_request_encoding_rejected() -> None:
+    """Unknown request codings get 415 so clients can retry uncompressed."""
+    response = _authed_client().post(
+        "/api/meetings/m-1/copilot",
+        content=b"{}",
+        headers={"Content-Type": "application/json", "Content-Encoding": "br"},
+    )
+    assert response.status_code == 415
+
+
+def test_dictionary_endpoint() -> None:
+    """The dictionary is served with Use-As-Dictionary for /api/* requests."""
+    from meetmind.main import app, compression_dictionary
+
+    response = TestClient(app).get("/api/compression/dictionary")
+
+    assert response.status_code == 200
+    assert response.content == compression_dictionary.data
+    assert 'match="/api/*"' in response.headers["use-as-dictionary"]
@@ -1,8 +1,20 @@
 """Tests for structured logging configuration."""
 
+import json
+import threading
+from unittest.mock import patch
+
+import pytest
 import structlog
 
-from meetmind.config.logging import get_logger, setup_logging
+from meetmind.config.log_buffer import (
+    EventSampler,
+    LogRingBuffer,
+    capture_event,
+    parse_sample_rates,
+)
+from meetmind.config.logging import get_logger, setup_logging, shutdown_logging
+from meetmind.config.settings import settings
 
 
 def test_setup_logging_configures_structlog() -> None:
@@ -26,3 +38,116 @@ def test_get_logger_returns_bound_logger() -> None:
     assert hasattr(log, "info")
     assert hasattr(log, "error")
     assert hasattr(log, "warning")
+
+
+# ─── Buffered Logging ───────────────────────────────────────────
+
+
+def test_parse_sample_rates() -> None:
+    """Rates are clamped to [0, 1] and malformed entries skipped."""
+    assert parse_sample_rates("a=0.5, b=2,c=x,=1,d=-1") == {"a": 0.5, "b": 1.0, "d": 0.0}
+
+
+def test_sampler_drops_sampled_events_but_keeps_errors() -> None:
+    """Zero-rate events are dropped at info, never at error."""
+    sampler = EventSampler({"noisy": 0.0})
+
+    with pytest.raises(structlog.DropEvent):
+        sampler(None, "info", {"event": "noisy"})
+    assert sampler(None, "error", {"event": "noisy"}) == {"event": "noisy"}
+    assert sampler.sampled_out == 1
+
+
+def test_sampler_rate_cap_reports_suppressed() -> None:
+    """Events over the per-second cap are dropped and counted on the next kept one."""
+    sampler = EventSampler(rate_limit=2)
+
+    with patch("meetmind.config.log_buffer.time.monotonic", return_value=100.0):
+        sampler(None, "info", {"event": "tick"})
+        sampler(None, "info", {"event": "tick"})
+        for _ in range(3):
+            with pytest.raises(structlog.DropEvent):
+                sampler(None, "info", {"event": "tick"})
+    with patch("meetmind.config.log_buffer.time.monotonic", return_value=101.0):
+        kept = sampler(None, "info", {"event": "tick"})
+
+    assert kept["suppressed"] == 3
+    assert sampler.rate_limited == 3
+
+
+def test_ring_buffer_renders_on_flush_and_counts_overflow() -> None:
+    """Events are rendered only when drained; overwritten ones are reported."""
+    lines: list[str] = []
+    ring = LogRingBuffer(
+        [structlog.stdlib.add_log_level, structlog.processors.JSONRenderer()],
+        capacity=2,
+        write=lines.append,
+    )
+    for n in range(3):
+        ring.push(capture_event(None, "info", {"event": "e", "n": n})[0][0])
+
+    assert lines == []  # nothing formatted on the push path
+    assert ring.flush() == 3
+
+    out = lines[0].strip().split("\n")
+    assert [json.loads(line)["n"] for line in out[:2]] == [1, 2]
+    assert json.loads(out[0])["level"] == "info"
+    assert "timestamp" in json.loads(out[0])
+    overflow = json.loads(out[2])
+    assert (overflow["event"], overflow["dropped"]) == ("log_buffer_overflow", 1)
+    assert overflow["level"] == "warning"
+
+
+def test_ring_buffer_render_failure_stays_json() -> None:
+    """An event the renderer chokes on is reported as a JSON record."""
+    lines: list[str] = []
+
+    def fragile(_logger: object, _name: str, event_dict: dict[str, object]) -> str:
+        if event_dict.get("bad"):
+            raise ValueError("boom")
+        return json.dumps(event_dict)
+
+    ring = LogRingBuffer([fragile], write=lines.append)
+    ring.push({"event": "broken", "bad": True, "_ts": 0.0})
+    ring.push({"event": "fine", "_ts": 0.0})
+    assert ring.flush() == 2
+
+    failed, ok = (json.loads(line) for line in lines[0].strip().split("\n"))
+    assert failed["event"] == "log_render_failed"
+    assert (failed["source"], failed["error"]) == ("broken", "boom")
+    assert ok["event"] == "fine"
+
+
+def test_ring_snapshot_while_another_thread_pushes() -> None:
+    """Memory accounting can copy the ring while events keep arriving."""
+    ring = LogRingBuffer([structlog.processors.JSONRenderer()], capacity=512)
+    stop = threading.Event()
+
+    def producer() -> None:
+        while not stop.is_set():
+            ring.push({"event": "e", "_ts": 0.0})
+
+    thread = threading.Thread(target=producer)
+    thread.start()
+    try:
+        for _ in range(200):
+            assert all(event["event"] == "e" for event in ring.snapshot())
+    finally:
+        stop.set()
+        thread.join()
+
+
+def test_buffered_logging_writes_from_background_thread(capsys: pytest.CaptureFixture[str]) -> None:
+    """With log_async, events reach stdout after the writer drains the ring."""
+    with (
+        patch.object(settings, "log_async", True),
+        patch.object(settings, "environment", "production"),
+    ):
+        setup_logging()
+        get_logger("test_module").warning("buffered_event", meeting_id="m-1")
+        shutdown_logging()
+
+    record = json.loads(capsys.readouterr().out.strip().split("\n")[-1])
+    assert record["event"] == "buffered_event"
+    assert record["level"] == "warning"
+    assert record["meeting_id"] == "m-1"
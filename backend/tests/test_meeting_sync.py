@@ -0,0 +1,216 @@
+"""Tests for meeting delta sync and conditional detail fetches."""
+
+from __future__ import annotations
+
+from contextlib import asynccontextmanager, nullcontext
+from typing import TYPE_CHECKING, Any
+from unittest.mock import AsyncMock, MagicMock, patch
+
+from fastapi.testclient import TestClient
+
+from meetmind.core import storage
+
+if TYPE_CHECKING:
+    from collections.abc import AsyncIterator
+
+
+def _authed_client() -> TestClient:
+    from meetmind.core.auth import create_access_token
+    from meetmind.main import app
+
+    client = TestClient(app, raise_server_exceptions=False)
+    token = create_access_token("test-user-id", "test@example.com")
+    client.headers.update({"Authorization": f"Bearer {token}"})
+    return client
+
+
+def _pool_with(conn: MagicMock) -> MagicMock:
+    @asynccontextmanager
+    async def acquire() -> AsyncIterator[MagicMock]:
+        yield conn
+
+    return MagicMock(acquire=acquire)
+
+
+# ─── Storage ────────────────────────────────────────────────────
+
+
+async def test_sync_splits_changes_and_tombstones() -> None:
+    """Changed meetings come back as list rows; deletes as bare IDs."""
+    row: dict[str, Any] = {
+        "title": "Standup",
+        "language": "en",
+        "status": "completed",
+        "started_at": None,
+        "ended_at": None,
+        "duration_secs": 60,
+        "total_segments": 3,
+        "total_insights": 1,
+        "cost_usd": 0.01,
+    }
+    conn = MagicMock()
+    conn.fetch = AsyncMock(
+        return_value=[
+            {"meeting_id": "m-1", "version": 11, "deleted": False, **row},
+            {"meeting_id": "m-2", "version": 12, "deleted": True, **dict.fromkeys(row)},
+        ]
+    )
+
+    with patch.object(storage, "get_pool", AsyncMock(return_value=_pool_with(conn))):
+        result = await storage.sync_meetings("user-1", since=10, limit=2)
+
+    assert result["cursor"] == 12
+    assert result["meetings"] == [{"id": "m-1", "version": 11, **row}]
+    assert result["deleted"] == ["m-2"]
+    assert result["has_more"] is True
+
+
+async def test_sync_without_changes_keeps_cursor() -> None:
+    """An unchanged history returns the same cursor and nothing else."""
+    conn = MagicMock(fetch=AsyncMock(return_value=[]))
+
+    with patch.object(storage, "get_pool", AsyncMock(return_value=_pool_with(conn))):
+        result = await storage.sync_meetings("user-1", since=42)
+
+    assert result == {"cursor": 42, "meetings": [], "deleted": [], "has_more": False}
+
+
+async def test_snapshot_pages_by_id_under_one_cursor() -> None:
+    """A snapshot is paged by meeting ID; later pages keep the first cursor."""
+    conn = MagicMock(
+        fetchval=AsyncMock(return_value=30),
+        fetch=AsyncMock(return_value=[{"id": "a", "version": 3}, {"id": "b", "version": 0}]),
+    )
+
+    with patch.object(storage, "get_pool", AsyncMock(return_value=_pool_with(conn))):
+        first = await storage.sync_meetings("user-1", since=0, limit=2)
+        conn.fetch.return_value = [{"id": "c", "version": 29}]
+        last = await storage.sync_meetings("user-1", since=30, limit=2, after="b")
+
+    assert first["cursor"] == 30
+    assert first["has_more"] is True
+    assert first["after"] == "b"
+    assert last == {
+        "cursor": 30,
+        "meetings": [{"id": "c", "version": 29}],
+        "deleted": [],
+        "has_more": False,
+        "after": None,
+    }
+    conn.fetchval.assert_awaited_once()  # the cursor is read for the first page only
+    assert [c.args[2] for c in conn.fetch.await_args_list] == [None, "b"]
+
+
+async def test_live_writes_bump_versions_once_per_flush() -> None:
+    """Segment and insight writes are bumped together, under the owner locks."""
+    conn = MagicMock(
+        fetch=AsyncMock(return_value=[{"client_seq": 1}]),
+        fetchrow=AsyncMock(return_value={"id": 5}),
+        execute=AsyncMock(),
+        executemany=AsyncMock(),
+        transaction=MagicMock(return_value=nullcontext()),
+    )
+    storage._pending_changes.clear()
+
+    with patch.object(storage, "get_pool", AsyncMock(return_value=_pool_with(conn))):
+        await storage.save_segments("m-1", [{"id": 1, "text": "hi"}])
+        await storage.save_insight("m-1", {"title": "Risk"})
+        await storage.save_segments("m-2", [{"id": 1, "text": "hi"}])
+        await storage.add_meeting_costs([("m-1", 0.01), ("m-3", 0.02)])
+        conn.execute.assert_not_awaited()
+
+        assert await storage.flush_changes() == 3
+        assert await storage.flush_changes() == 0
+
+    lock, bump = conn.execute.await_args_list
+    assert "pg_advisory_xact_lock" in lock.args[0]
+    assert "nextval('meeting_version_seq')" in bump.args[0]
+    assert bump.args[1] == ["m-1", "m-2", "m-3"]
+
+
+async def test_failed_flush_keeps_changes_queued() -> None:
+    """Bumps that couldn't be written are retried on the next flush."""
+    storage._pending_changes.clear()
+    storage.mark_changed("m-1")
+
+    with patch.object(storage, "get_pool", AsyncMock(side_effect=OSError("db down"))):
+        assert await storage.flush_changes() == 0
+
+    assert storage._pending_changes == {"m-1"}
+    storage._pending_changes.clear()
+
+
+# ─── Endpoints ──────────────────────────────────────────────────
+
+
+@patch("meetmind.main.storage")
+def test_sync_endpoint_clamps_paging(mock_storage: MagicMock) -> None:
+    """The cursor and page size are sanitized before reaching storage."""
+    mock_storage.sync_meetings = AsyncMock(
+        return_value={"cursor": 5, "meetings": [], "deleted": [], "has_more": False}
+    )
+
+    response = _authed_client().get("/api/meetings/sync?since=-3&limit=10000")
+
+    assert response.status_code == 200
+    assert response.json()["cursor"] == 5
+    mock_storage.sync_meetings.assert_awaited_once_with(
+        "test-user-id", since=0, limit=500, after=None
+    )
+
+
+@patch("meetmind.main.storage")
+def test_detail_returns_etag(mock_storage: MagicMock) -> None:
+    """Full fetches carry the meeting version as a weak ETag."""
+    mock_storage.get_meeting = AsyncMock(
+        return_value={"id": "m-1", "user_id": "test-user-id", "version": 7}
+    )
+
+    response = _authed_client().get("/api/meetings/m-1")
+
+    assert response.status_code == 200
+    assert response.headers["etag"] == 'W/"v7"'
+    assert response.json()["version"] == 7
+
+
+@patch("meetmind.main.storage")
+def test_detail_not_modified_skips_loading(mock_storage: MagicMock) -> None:
+    """A matching If-None-Match returns 304 without loading the meeting."""
+    mock_storage.get_meeting_version = AsyncMock(
+        return_value={"user_id": "test-user-id", "version": 7}
+    )
+    mock_storage.get_meeting = AsyncMock()
+
+    response = _authed_client().get("/api/meetings/m-1", headers={"If-None-Match": 'W/"v7"'})
+
+    assert response.status_code == 304
+    assert response.content == b""
+    mock_storage.get_meeting.assert_not_awaited()
+
+
+@patch("meetmind.main.storage")
+def test_detail_stale_etag_refetches(mock_storage: MagicMock) -> None:
+    """An outdated ETag gets the full meeting and the new ETag."""
+    mock_storage.get_meeting_version = AsyncMock(
+        return_value={"user_id": "test-user-id", "version": 8}
+    )
+    mock_storage.get_meeting = AsyncMock(
+        return_value={"id": "m-1", "user_id": "test-user-id", "version": 8}
+    )
+
+    response = _authed_client().get("/api/meetings/m-1", headers={"If-None-Match": 'W/"v7"'})
+
+    assert response.status_code == 200
+    assert response.headers["etag"] == 'W/"v8"'
+
+
+@patch("meetmind.main.storage")
+def test_conditional_fetch_checks_ownership(mock_storage: MagicMock) -> None:
+    """Another user's meeting is a 404 even when the ETag would match."""
+    mock_storage.get_meeting_version = AsyncMock(
+        return_value={"user_id": "someone-else", "version": 7}
+    )
+
+    response = _authed_client().get("/api/meetings/m-1", headers={"If-None-Match": 'W/"v7"'})
+
+    assert response.status_code == 404
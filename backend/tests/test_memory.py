@@ -0,0 +1,105 @@
+"""Tests for per-subsystem memory accounting."""
+
+from __future__ import annotations
+
+import sys
+import threading
+from unittest.mock import AsyncMock, patch
+
+from fastapi.testclient import TestClient
+
+from meetmind.api.meeting_api import MeetingManager
+from meetmind.core.memory import MemoryAccountant, _module_of, deep_sizeof
+from meetmind.core.transcript import TranscriptManager
+
+# ─── Sizing ─────────────────────────────────────────────────────
+
+
+def test_deep_sizeof_follows_containers_and_own_objects() -> None:
+    """Nested data and package objects are walked; shared objects count once."""
+    text = "x" * 10_000
+    transcript = TranscriptManager()
+    transcript.add_chunk(text, speaker="Ana")
+
+    assert deep_sizeof(transcript) > 10_000
+    assert deep_sizeof([text, text]) < 10_000 + sys.getsizeof(text) // 2 + 200
+
+    seen: set[int] = set()
+    first = deep_sizeof({"a": text}, seen)
+    assert deep_sizeof({"b": text}, seen) < first - 10_000
+
+
+def test_deep_sizeof_counts_foreign_objects_shallowly() -> None:
+    """Third-party/stdlib objects don't drag their whole graph in."""
+    lock = threading.Lock()
+    assert deep_sizeof(lock) == sys.getsizeof(lock, 0)
+
+
+def test_allocating_module_names() -> None:
+    """Allocation sites map to our module or the third-party package."""
+    assert _module_of("/app/src/meetmind/core/tracing.py") == "meetmind.core.tracing"
+    assert _module_of("/venv/lib/python3.12/site-packages/asyncpg/pool.py") == "asyncpg"
+    assert _module_of("/usr/lib/python3.12/asyncio/queues.py") == "asyncio"
+
+
+# ─── Accountant ─────────────────────────────────────────────────
+
+
+def test_high_water_and_breakdown() -> None:
+    """Per-key sizers are summed and ranked; peaks survive shrinking."""
+    accountant = MemoryAccountant()
+    sizes = {"m-1": 500, "m-2": 2000}
+    accountant.register("sessions", lambda: dict(sizes))
+    accountant.register("cache", lambda: 100)
+
+    first = accountant.sample(top=1)["subsystems"]
+    assert first["sessions"] == {
+        "bytes": 2500,
+        "high_water_bytes": 2500,
+        "count": 2,
+        "top": {"m-2": 2000},
+    }
+    assert list(first) == ["sessions", "cache"]
+
+    sizes.pop("m-2")
+    assert accountant.sample()["subsystems"]["sessions"]["high_water_bytes"] == 2500
+
+
+def test_broken_sizer_is_skipped() -> None:
+    """One failing subsystem doesn't hide the others."""
+    accountant = MemoryAccountant()
+    accountant.register("broken", lambda: 1 // 0)
+    accountant.register("ok", lambda: 10)
+
+    sample = accountant.sample()
+    assert list(sample["subsystems"]) == ["ok"]
+    assert sample["rss_bytes"] > 0
+
+
+@patch("meetmind.api.meeting_api.storage")
+async def test_sessions_sized_per_meeting(mock_storage: AsyncMock) -> None:
+    """The largest live session is the one with the longest transcript."""
+    mock_storage.take_session_snapshot = AsyncMock(return_value=None)
+    mock_storage.create_meeting = AsyncMock()
+    mock_storage.save_segments = AsyncMock()
+
+    manager = MeetingManager()
+    await manager.ingest_transcript("small", [{"text": "hi"}])
+    await manager.ingest_transcript("large", [{"text": "word " * 5000}])
+
+    usage = manager.memory_by_session()
+    assert usage["large"] > usage["small"] + 20_000
+
+
+# ─── Endpoint ───────────────────────────────────────────────────
+
+
+def test_memory_endpoint_lists_subsystems() -> None:
+    """The debug endpoint reports every registered subsystem and the RSS."""
+    from meetmind.main import _register_memory_accounting, app
+
+    _register_memory_accounting()
+    body = TestClient(app).get("/metrics/memory").json()
+
+    assert {"sessions", "event_hub", "traces", "token_cache", "metrics"} <= set(body["subsystems"])
+    assert body["rss_bytes"] >= body["accounted_bytes"] > 0
@@ -0,0 +1,143 @@
+"""Tests for HDR latency histograms and the /metrics endpoint."""
+
+from __future__ import annotations
+
+import gzip
+import re
+import threading
+from unittest.mock import patch
+
+import pytest
+from fastapi.testclient import TestClient
+
+from meetmind.core.metrics import (
+    LatencyHistogram,
+    MetricsRegistry,
+    bucket_index,
+    bucket_upper_us,
+    metrics,
+)
+
+# ─── Histogram ──────────────────────────────────────────────────
+
+
+def test_buckets_bound_relative_error() -> None:
+    """Every value maps to a bucket whose upper bound is within 1.6%."""
+    for value in [*range(300), 1_000, 12_345, 999_999, 3_600_000_000]:
+        upper = bucket_upper_us(bucket_index(value))
+        assert value <= upper <= value * 1.016 + 1
+
+
+def test_quantiles_match_distribution() -> None:
+    """p50/p99 of 1..10000µs land within bucket precision."""
+    histogram = LatencyHistogram()
+    for us in range(1, 10_001):
+        histogram.record_us(us)
+
+    snap = histogram.snapshot()
+    assert snap.count == 10_000
+    assert snap.quantile(0.5) == pytest.approx(0.005, rel=0.016)
+    assert snap.quantile(0.99) == pytest.approx(0.0099, rel=0.016)
+    assert snap.quantile(1.0) == pytest.approx(0.01)
+    assert snap.count_at_or_below(0.001) == pytest.approx(1_000, rel=0.016)
+
+
+def test_threads_record_to_own_shards_and_merge() -> None:
+    """Concurrent writers never share a shard; scrape sees every sample."""
+    histogram = LatencyHistogram()
+
+    def work() -> None:
+        for _ in range(5_000):
+            histogram.record_us(250)
+
+    threads = [threading.Thread(target=work) for _ in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    histogram.record_us(250)
+
+    assert len(histogram._shards) == 5
+    assert histogram.snapshot().count == 20_001
+
+
+# ─── Exposition ─────────────────────────────────────────────────
+
+
+def test_prometheus_histogram_is_cumulative() -> None:
+    """Buckets are cumulative and +Inf equals _count."""
+    registry = MetricsRegistry()
+    for seconds in (0.0005, 0.02, 0.3, 4.0):
+        registry.stage("screening").observe(seconds)
+
+    text = registry.render_prometheus()
+    buckets = [
+        int(n)
+        for n in re.findall(
+            r'meetmind_stage_duration_seconds_bucket\{stage="screening",le="[^"]+"\} (\d+)', text
+        )
+    ]
+    assert buckets == sorted(buckets)
+    assert buckets[0] == 1
+    assert buckets[-1] == 4
+    assert 'meetmind_stage_duration_seconds_count{stage="screening"} 4' in text
+    assert 'meetmind_stage_duration_quantile_seconds{stage="screening",quantile="0.99"}' in text
+
+
+def test_metrics_endpoint_labels_by_route_template() -> None:
+    """HTTP timings use the route template, not the raw path."""
+    from meetmind.main import app
+
+    metrics.reset()
+    client = TestClient(app, raise_server_exceptions=False)
+    client.get("/api/meetings/some-meeting-id")  # 401, still timed
+
+    response = client.get("/metrics")
+
+    assert response.status_code == 200
+    assert response.headers["content-type"].startswith("text/plain")
+    assert 'route="/api/meetings/{meeting_id}"' in response.text
+    assert "some-meeting-id" not in response.text
+
+
+def test_metrics_token_required_when_configured() -> None:
+    """A configured scrape token is enforced."""
+    from meetmind.main import app
+
+    client = TestClient(app)
+    with patch("meetmind.main.settings.metrics_token", "scrape-secret"):
+        assert client.get("/metrics").status_code == 401
+        ok = client.get("/metrics", headers={"Authorization": "Bearer scrape-secret"})
+        assert ok.status_code == 200
+
+
+def test_metrics_route_survives_compressed_request() -> None:
+    """A compressed request body is still labelled by its route template."""
+    from meetmind.main import app
+
+    metrics.reset()
+    client = TestClient(app, raise_server_exceptions=False)
+    client.post(
+        "/api/meetings/some-meeting-id/transcript",
+        content=gzip.compress(b'{"segments": []}'),
+        headers={"Content-Encoding": "gzip", "Content-Type": "application/json"},
+    )
+
+    text = client.get("/metrics").text
+    assert 'route="/api/meetings/{meeting_id}/transcript"' in text
+    assert 'method="POST",route="unmatched"' not in text
+
+
+def test_metrics_collapse_unknown_methods() -> None:
+    """Arbitrary request methods share one series instead of minting labels."""
+    from meetmind.main import app
+
+    metrics.reset()
+    client = TestClient(app, raise_server_exceptions=False)
+    client.request("BREW", "/api/meetings")
+    client.request("X-RANDOM-1234", "/api/meetings")
+
+    text = client.get("/metrics").text
+    assert 'method="other"' in text
+    assert "BREW" not in text
+    assert "X-RANDOM-1234" not in text
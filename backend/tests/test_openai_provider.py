@@ -13,6 +13,7 @@ def mock_openai_response() -> MagicMock:
     usage = MagicMock()
     usage.prompt_tokens = 15
     usage.completion_tokens = 25
+    usage.prompt_tokens_details = None
 
     message = MagicMock()
     message.content = "Test OpenAI response"
@@ -77,6 +78,28 @@ async def test_invoke_returns_content(
     assert provider._total_requests == 1
 
 
+@patch("meetmind.providers.openai_provider.AsyncOpenAI")
+@patch("meetmind.providers.openai_provider.settings")
+@pytest.mark.asyncio
+async def test_invoke_splits_cached_prompt_tokens(
+    mock_settings: MagicMock,
+    mock_client_cls: MagicMock,
+    mock_openai_response: MagicMock,
+) -> None:
+    """Cached prompt tokens are reported apart from (and not in) input_tokens."""
+    mock_settings.openai_api_key = "sk-test"
+    mock_openai_response.usage.prompt_tokens_details = MagicMock(cached_tokens=10)
+
+    mock_client = MagicMock()
+    mock_client.chat.completions.create = AsyncMock(return_value=mock_openai_response)
+    mock_client_cls.return_value = mock_client
+
+    result = await OpenAIProvider().invoke(model_id="gpt-4o", prompt="Hello")
+
+    assert result["input_tokens"] == 5
+    assert result["cached_tokens"] == 10
+
+
 @patch("meetmind.providers.openai_provider.AsyncOpenAI")
 @patch("meetmind.providers.openai_provider.settings")
 @pytest.mark.asyncio
@@ -0,0 +1,261 @@
+"""Tests for the streaming PDF writer and the meeting report endpoint."""
+
+from __future__ import annotations
+
+import re
+import zlib
+from typing import TYPE_CHECKING, Any
+from unittest.mock import AsyncMock, MagicMock, patch
+
+import pytest
+from fastapi.testclient import TestClient
+
+from meetmind.utils.pdf_report import format_duration, report_filename, stream_meeting_report
+from meetmind.utils.pdf_writer import (
+    HELVETICA,
+    PageCanvas,
+    PdfStreamWriter,
+    UnsupportedTextError,
+    encode_text,
+    wrap_text,
+)
+
+if TYPE_CHECKING:
+    from collections.abc import AsyncIterator
+
+
+def _meeting(**overrides: Any) -> dict[str, Any]:
+    meeting: dict[str, Any] = {
+        "id": "m-1",
+        "user_id": "test-user-id",
+        "title": "Roadmap (Q3) — review",
+        "started_at": None,
+        "duration_secs": 10800,
+        "total_segments": 3,
+        "summary": {
+            "overview": "We agreed on scope.",
+            "key_points": '["Budget approved"]',  # JSONB arrives as text
+            "decisions": [{"what": "Ship v2"}],
+            "follow_ups": ["Check hiring"],
+        },
+        "insights": [{"title": "Risk", "content": "Tight deadline", "importance": "high"}],
+        "action_items": [{"task": "Write spec", "assignee": "Ana", "status": "pending"}],
+    }
+    meeting.update(overrides)
+    return meeting
+
+
+async def _segments(count: int) -> AsyncIterator[dict[str, Any]]:
+    for i in range(count):
+        yield {"speaker": f"Speaker {i % 3}", "text": f"Segment number {i} about the plan."}
+
+
+async def _render(meeting: dict[str, Any], segment_count: int = 0) -> list[bytes]:
+    return [c async for c in stream_meeting_report(meeting, _segments(segment_count))]
+
+
+def _check_structure(pdf: bytes) -> int:
+    """Validate header, xref offsets, and trailer; return the page count."""
+    assert pdf.startswith(b"%PDF-1.4\n")
+    assert pdf.endswith(b"%%EOF\n")
+
+    startxref = int(re.search(rb"startxref\n(\d+)\n%%EOF\n$", pdf).group(1))  # type: ignore[union-attr]
+    assert pdf[startxref:].startswith(b"xref\n")
+
+    entries = re.findall(rb"(\d{10}) 00000 n \n", pdf[startxref:])
+    for obj_id, offset in enumerate(entries, start=1):
+        assert pdf[int(offset) :].startswith(b"%d 0 obj\n" % obj_id)
+
+    return int(re.search(rb"/Type /Pages /Kids \[[^\]]*\] /Count (\d+)", pdf).group(1))  # type: ignore[union-attr]
+
+
+# ─── Text Layout ────────────────────────────────────────────────
+
+
+def test_encode_text_drops_unsupported_glyphs() -> None:
+    """Latin accents survive; emoji and control characters do not."""
+    assert encode_text("Café 🚀\tok") == "Café  ok".encode("cp1252")
+    assert encode_text("a → b") == b"a -> b"
+
+
+def test_encode_text_refuses_non_latin_letters() -> None:
+    """Words the fonts can't show are an error, never silently dropped."""
+    with pytest.raises(UnsupportedTextError):
+        encode_text("Итоги встречи")
+    with pytest.raises(UnsupportedTextError):
+        encode_text("Spotkanie w Łodzi")
+
+
+def test_wrap_text_respects_width() -> None:
+    """Every wrapped line fits the requested width."""
+    data = encode_text("the quick brown fox jumps over the lazy dog " * 20)
+    lines = wrap_text(data, HELVETICA, 10, 200)
+
+    assert len(lines) > 1
+    assert all(HELVETICA.width(line, 10) <= 200 for line in lines)
+    assert b" ".join(lines) == b" ".join(data.split())
+
+
+def test_wrap_text_breaks_long_tokens() -> None:
+    """A token wider than the line is split between characters."""
+    lines = wrap_text(b"x" * 500, HELVETICA, 10, 100)
+
+    assert len(lines) > 1
+    assert b"".join(lines) == b"x" * 500
+
+
+def test_wrap_text_empty() -> None:
+    """Empty input yields a single empty line."""
+    assert wrap_text(b"", HELVETICA, 10, 100) == [b""]
+
+
+# ─── Writer ─────────────────────────────────────────────────────
+
+
+def test_writer_builds_valid_xref() -> None:
+    """Objects emitted incrementally are indexed at their byte offsets."""
+    writer = PdfStreamWriter()
+    chunks = [writer.begin()]
+    for n in range(3):
+        canvas = PageCanvas()
+        canvas.text(40, 700, b"Page (%d)" % n, HELVETICA, 12)
+        chunks.append(writer.add_page(canvas.build()))
+    chunks.append(writer.finish(title="Test"))
+
+    pdf = b"".join(chunks)
+    assert _check_structure(pdf) == 3
+    assert writer.bytes_written == len(pdf)
+
+
+def test_writer_escapes_and_compresses_content() -> None:
+    """Content streams are deflated and string literals escaped."""
+    writer = PdfStreamWriter()
+    canvas = PageCanvas()
+    canvas.text(40, 700, b"a(b)c\\", HELVETICA, 12)
+    writer.begin()
+    page = writer.add_page(canvas.build())
+
+    stream = page.split(b"stream\n", 1)[1].split(b"\nendstream", 1)[0]
+    assert b"(a\\(b\\)c\\\\) Tj" in zlib.decompress(stream)
+
+
+# ─── Meeting Report ─────────────────────────────────────────────
+
+
+async def test_report_streams_pages() -> None:
+    """A long transcript is emitted as many chunks, one page at a time."""
+    chunks = await _render(_meeting(), segment_count=2000)
+    pdf = b"".join(chunks)
+
+    pages = _check_structure(pdf)
+    assert pages > 10
+    assert len(chunks) >= pages
+    assert max(len(c) for c in chunks) < 16_000
+
+
+async def test_report_without_transcript() -> None:
+    """Summary-only export renders without consuming segments."""
+    meeting = _meeting(summary=None, insights=[], action_items=[])
+    chunks = [c async for c in stream_meeting_report(meeting, None, full_export=False)]
+
+    assert _check_structure(b"".join(chunks)) == 1
+
+
+def test_report_helpers() -> None:
+    """Duration and filename match the app's formatting."""
+    assert format_duration(0) == "< 1m"
+    assert format_duration(125) == "2m 5s"
+    assert report_filename("Roadmap (Q3) — review!") == "aurameet_roadmap_q3_review.pdf"
+
+
+# ─── Segment Paging ─────────────────────────────────────────────
+
+
+async def test_segments_paged_without_holding_a_connection() -> None:
+    """Each page is a keyset query on its own checkout; the pool is free between yields."""
+    from contextlib import asynccontextmanager
+
+    from meetmind.core import storage
+
+    held = 0
+    rows = [
+        {"speaker": "A", "text": f"t{i}", "timestamp_unix": i, "segment_index": i} for i in range(5)
+    ]
+    conn = MagicMock(fetch=AsyncMock(side_effect=[rows[:2], rows[2:4], rows[4:]]))
+
+    @asynccontextmanager
+    async def acquire() -> AsyncIterator[MagicMock]:
+        nonlocal held
+        held += 1
+        try:
+            yield conn
+        finally:
+            held -= 1
+
+    seen = []
+    with patch.object(storage, "get_pool", AsyncMock(return_value=MagicMock(acquire=acquire))):
+        async for segment in storage.iter_segments("m-1", batch_size=2):
+            assert held == 0
+            seen.append(segment["segment_index"])
+
+    assert seen == [0, 1, 2, 3, 4]
+    assert [c.args[2] for c in conn.fetch.await_args_list] == [-1, 1, 3]
+    assert all(c.args[4] is None for c in conn.fetch.await_args_list)
+
+
+# ─── Endpoint ───────────────────────────────────────────────────
+
+
+def _authed_client() -> TestClient:
+    from meetmind.core.auth import create_access_token
+    from meetmind.main import app
+
+    client = TestClient(app, raise_server_exceptions=False)
+    token = create_access_token("test-user-id", "test@example.com")
+    client.headers.update({"Authorization": f"Bearer {token}"})
+    return client
+
+
+@patch("meetmind.main.storage")
+def test_report_endpoint_streams_pdf(mock_storage: MagicMock) -> None:
+    """The endpoint streams a PDF built from the segment cursor."""
+    mock_storage.get_meeting = AsyncMock(return_value=_meeting())
+    mock_storage.iter_segments = MagicMock(side_effect=lambda *_, **__: _segments(50))
+
+    response = _authed_client().get("/api/meetings/m-1/report.pdf")
+
+    assert response.status_code == 200
+    assert response.headers["content-type"] == "application/pdf"
+    assert "aurameet_roadmap_q3_review.pdf" in response.headers["content-disposition"]
+    assert _check_structure(response.content) >= 1
+    mock_storage.get_meeting.assert_awaited_once_with("m-1", include_segments=False)
+    scan, render = mock_storage.iter_segments.call_args_list
+    assert scan.kwargs == {"beyond_latin1": True}  # only possible failures are re-read
+    assert render.kwargs == {}
+
+
+@patch("meetmind.main.storage")
+def test_report_endpoint_hides_foreign_meetings(mock_storage: MagicMock) -> None:
+    """Meetings owned by another user return 404."""
+    mock_storage.get_meeting = AsyncMock(return_value=_meeting(user_id="someone-else"))
+
+    response = _authed_client().get("/api/meetings/m-1/report.pdf")
+
+    assert response.status_code == 404
+
+
+@patch("meetmind.main.storage")
+def test_report_endpoint_refuses_non_latin_transcript(mock_storage: MagicMock) -> None:
+    """A transcript the fonts can't render is refused before streaming starts."""
+
+    async def russian(*_: Any, **__: Any) -> AsyncIterator[dict[str, Any]]:
+        yield {"speaker": "Speaker 0", "text": "Hello"}
+        yield {"speaker": "Speaker 1", "text": "Привет всем"}
+
+    mock_storage.get_meeting = AsyncMock(return_value=_meeting())
+    mock_storage.iter_segments = MagicMock(side_effect=russian)
+
+    response = _authed_client().get("/api/meetings/m-1/report.pdf")
+
+    assert response.status_code == 422
+    assert _authed_client().get("/api/meetings/m-1/report.pdf?full=false").status_code == 200
@@ -0,0 +1,142 @@
+"""Tests for the static tracepoints and the in-process probe recorder."""
+
+from __future__ import annotations
+
+from types import SimpleNamespace
+from typing import TYPE_CHECKING, Any
+from unittest.mock import patch
+
+import pytest
+from fastapi.testclient import TestClient
+
+from meetmind.core import probes, tracing
+from meetmind.core.token_cache import VerifiedTokenCache
+from meetmind.utils.response_cache import ResponseCache
+
+if TYPE_CHECKING:
+    from collections.abc import Iterator
+
+
+@pytest.fixture(autouse=True)
+def _stopped_recorder() -> Iterator[None]:
+    probes.recorder.stop()
+    yield
+    probes.recorder.stop()
+
+
+# ─── Probes ─────────────────────────────────────────────────────
+
+
+def test_probes_are_off_by_default() -> None:
+    """Without a tracer or the recorder, call sites skip the probe entirely."""
+    assert not any(p.enabled for p in probes._probes.values())
+
+    ResponseCache().get("nothing here")
+    assert probes.recorder.snapshot()["counts"] == {}
+
+
+def test_recorder_captures_hot_path_probes() -> None:
+    """Stages, cache lookups and their arguments land in the ring."""
+    probes.recorder.start()
+    assert probes.CACHE_HIT.enabled
+
+    cache = VerifiedTokenCache(max_entries=4)
+    cache.get("missing")
+    with tracing.span("screening"):
+        pass
+
+    capture = probes.recorder.snapshot()
+    assert capture["counts"] == {"cache_miss": 1, "stage_done": 1}
+    assert capture["recent"][0]["probe"] == "cache_miss"
+    assert capture["recent"][0]["cache"] == "token"
+    assert capture["recent"][1]["stage"] == "screening"
+    assert capture["recent"][1]["duration_us"] >= 0
+
+    probes.recorder.stop()
+    assert not probes.CACHE_HIT.enabled
+    assert probes.recorder.snapshot()["counts"]  # capture survives stop
+
+
+def test_catalogue_lists_argument_names() -> None:
+    """Every probe has a fixed signature tools can read."""
+    catalogue = probes.catalogue()
+    assert catalogue["db_flush"] == ["table", "rows"]
+    assert catalogue["event_dequeue"] == ["user", "wait_us"]
+
+
+def test_usdt_is_optional() -> None:
+    """Without stapsdt the probes fall back to the recorder only."""
+    with patch.dict("sys.modules", {"stapsdt": None}):
+        assert probes.load_usdt() is False
+    assert not probes.DB_FLUSH.enabled
+
+
+class _FakeUsdtProbe:
+    """A stapsdt probe whose semaphore the test flips by hand."""
+
+    def __init__(self) -> None:
+        self.is_enabled = False
+        self.fired: list[tuple[Any, ...]] = []
+
+    def fire(self, *values: Any) -> None:
+        self.fired.append(values)
+
+
+class _FakeProvider:
+    def __init__(self, name: str) -> None:
+        self.probes: dict[str, _FakeUsdtProbe] = {}
+
+    def add_probe(self, name: str, *arg_types: str) -> _FakeUsdtProbe:
+        self.probes[name] = _FakeUsdtProbe()
+        return self.probes[name]
+
+    def load(self) -> None:
+        pass
+
+
+def test_usdt_probe_enabled_only_while_attached() -> None:
+    """Loading stapsdt alone doesn't turn probes on; an attached tracer does."""
+    fake = SimpleNamespace(
+        Provider=_FakeProvider, ArgTypes=SimpleNamespace(uint64="u64", int64="i64")
+    )
+    try:
+        with patch.dict("sys.modules", {"stapsdt": fake}), patch.object(probes, "_watch_usdt"):
+            assert probes.load_usdt() is True
+        assert not probes.DB_FLUSH.enabled
+
+        usdt = probes._provider.probes["db_flush"]
+        usdt.is_enabled = True
+        probes._refresh()
+        assert probes.DB_FLUSH.enabled
+        assert not probes.LOG_FLUSH.enabled
+        probes.DB_FLUSH.fire("meetings", 3)
+        assert usdt.fired == [(b"meetings", 3)]
+
+        usdt.is_enabled = False
+        probes._refresh()
+        assert not probes.DB_FLUSH.enabled
+    finally:
+        for probe in probes._probes.values():
+            probe._usdt = None
+        probes._provider = None
+        probes._refresh()
+
+
+# ─── Endpoint ───────────────────────────────────────────────────
+
+
+def test_probe_endpoint_toggles_recorder() -> None:
+    """Operators can start a capture over HTTP and read it back."""
+    from meetmind.main import app
+
+    client = TestClient(app, raise_server_exceptions=False)
+
+    assert client.post("/metrics/probes?record=true").json() == {"recording": True}
+    with tracing.span("db_persist"):
+        pass
+    body = client.get("/metrics/probes").json()
+
+    assert body["recording"] is True
+    assert "batch_formed" in body["probes"]
+    assert body["counts"]["stage_done"] >= 1
+    assert client.post("/metrics/probes?record=false").json() == {"recording": False}
@@ -0,0 +1,128 @@
+"""Tests for startup readiness, background warm-up, and gated migrations."""
+
+from __future__ import annotations
+
+import time
+from contextlib import asynccontextmanager
+from typing import TYPE_CHECKING
+from unittest.mock import AsyncMock, MagicMock, patch
+
+from fastapi.testclient import TestClient
+
+from meetmind.core import storage
+from meetmind.core.readiness import Readiness
+
+if TYPE_CHECKING:
+    from collections.abc import AsyncIterator
+
+
+# ─── Registry ───────────────────────────────────────────────────
+
+
+def test_required_components_gate_readiness() -> None:
+    """Only required components hold back readiness."""
+    r = Readiness()
+    r.register("database")
+    r.register("agents", required=False)
+    assert r.ready is False
+
+    r.mark_failed("agents", "no credentials")
+    r.mark_ready("database")
+
+    state = r.to_dict()
+    assert state["ready"] is True
+    components = state["components"]
+    assert components["database"]["status"] == "ready"  # type: ignore[index]
+    assert components["agents"]["error"] == "no credentials"  # type: ignore[index]
+
+
+# ─── Endpoints ──────────────────────────────────────────────────
+
+
+def test_ready_probe_503_until_ready() -> None:
+    """/health/ready reports 503 while required components are pending."""
+    from meetmind.main import app
+
+    r = Readiness()
+    r.register("database")
+    with patch("meetmind.main.readiness", r):
+        client = TestClient(app)
+        assert client.get("/health/ready").status_code == 503
+        r.mark_ready("database")
+        assert client.get("/health/ready").status_code == 200
+
+
+@patch("meetmind.main.storage")
+def test_health_does_not_wait_for_pool(mock_storage: MagicMock) -> None:
+    """Liveness answers immediately while the pool is still being created."""
+    from meetmind.main import app
+
+    mock_storage.pool_ready = MagicMock(return_value=False)
+    mock_storage.get_pool = AsyncMock()
+
+    data = TestClient(app).get("/health").json()
+
+    assert data["status"] == "starting"
+    mock_storage.get_pool.assert_not_awaited()
+
+
+def test_startup_not_blocked_by_database() -> None:
+    """The app serves /health while the database is unreachable."""
+    from meetmind.main import app
+
+    with (
+        patch("meetmind.main.storage.open_pool", AsyncMock(side_effect=OSError("refused"))),
+        patch("meetmind.main.storage.close_db", AsyncMock()),
+        patch("meetmind.main.meeting_manager.init_agents"),
+    ):
+        started = time.monotonic()
+        with TestClient(app) as client:
+            response = client.get("/health")
+        elapsed = time.monotonic() - started
+
+    assert response.status_code == 200
+    assert response.json()["ready"] is False
+    assert elapsed < 2
+
+
+# ─── Migrations ─────────────────────────────────────────────────
+
+
+def _pool_with(conn: MagicMock) -> MagicMock:
+    @asynccontextmanager
+    async def acquire() -> AsyncIterator[MagicMock]:
+        yield conn
+
+    @asynccontextmanager
+    async def transaction() -> AsyncIterator[None]:
+        yield
+
+    conn.transaction = transaction
+    return MagicMock(acquire=acquire)
+
+
+async def test_migrate_skips_current_schema() -> None:
+    """A current schema costs a version lookup and no DDL."""
+    conn = MagicMock()
+    conn.fetchval = AsyncMock(side_effect=[True, storage.SCHEMA_VERSION])
+    conn.execute = AsyncMock()
+
+    with patch.object(storage, "_pool", _pool_with(conn)):
+        assert await storage.migrate() is False
+
+    conn.execute.assert_not_awaited()
+
+
+async def test_migrate_runs_ddl_once_under_lock() -> None:
+    """An old schema is migrated under the advisory lock and stamped."""
+    conn = MagicMock()
+    conn.fetchval = AsyncMock(side_effect=[False, False])  # no schema_version table yet
+    conn.execute = AsyncMock()
+
+    with patch.object(storage, "_pool", _pool_with(conn)):
+        assert await storage.migrate() is True
+
+    statements = [c.args[0] for c in conn.execute.await_args_list]
+    assert "pg_advisory_xact_lock" in statements[0]
+    assert any("CREATE TABLE IF NOT EXISTS schema_version" in s for s in statements)
+    assert "INSERT INTO schema_version" in statements[-1]
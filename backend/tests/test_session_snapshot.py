@@ -0,0 +1,167 @@
+"""Tests for session drain snapshots and resume across restarts."""
+
+from __future__ import annotations
+
+import asyncio
+import zlib
+from unittest.mock import AsyncMock, patch
+
+import pytest
+
+from meetmind.api.meeting_api import MeetingManager
+from meetmind.core import session_snapshot
+from meetmind.core.session_snapshot import SessionSnapshot, SnapshotError
+from meetmind.core.transcript import TranscriptManager
+from meetmind.utils.cost_tracker import CostTracker
+
+
+def _session() -> SessionSnapshot:
+    transcript = TranscriptManager(screening_interval=30)
+    transcript.set_meeting_id("m-1")
+    transcript.add_chunk("We agreed on the budget", speaker="Ana")
+    transcript.get_screening_text()  # screened — must not come back
+    transcript.add_chunk("Next step is the launch", speaker="Luis")
+
+    tracker = CostTracker(budget_usd=2.0)
+    tracker.record("anthropic.claude-3-haiku", 1200, 80)
+    tracker.record_compression_savings(300)
+    return SessionSnapshot(transcript=transcript, tracker=tracker, language="english", owner="u-1")
+
+
+# ─── Format ─────────────────────────────────────────────────────
+
+
+def test_roundtrip_preserves_transcript_cursor_and_costs() -> None:
+    """Segments, the unscreened buffer, and cost counters survive a snapshot."""
+    original = _session()
+    restored = session_snapshot.decode(session_snapshot.encode(original))
+
+    assert restored.transcript.get_segments() == original.transcript.get_segments()
+    assert restored.transcript.get_screening_text() == "Next step is the launch"
+    assert restored.transcript.buffer_size == 0
+    before, after = original.tracker.to_dict(), restored.tracker.to_dict()
+    before.pop("session_duration_s")
+    assert after.pop("session_duration_s") >= 0
+    assert after == before
+    assert (restored.language, restored.owner) == ("english", "u-1")
+
+
+def test_screening_clock_carries_over() -> None:
+    """A session screened just before the deploy isn't screened again right after."""
+    restored = session_snapshot.decode(session_snapshot.encode(_session()))
+    assert restored.transcript.buffer_size == 1
+    assert restored.transcript.should_screen() is False
+
+
+def test_decode_rejects_bad_snapshots() -> None:
+    """Corrupt data and other format versions raise SnapshotError."""
+    with pytest.raises(SnapshotError, match="Corrupt"):
+        session_snapshot.decode(b"garbage")
+    with pytest.raises(SnapshotError, match="version"):
+        session_snapshot.decode(zlib.compress(b'{"v": 99}'))
+    with pytest.raises(SnapshotError, match="Malformed"):
+        session_snapshot.decode(zlib.compress(b'{"v": 1, "language": "es"}'))
+
+
+# ─── Drain / Resume ─────────────────────────────────────────────
+
+
+@patch("meetmind.api.meeting_api.storage")
+async def test_drain_then_resume_in_new_process(mock_storage: AsyncMock) -> None:
+    """The next process resumes the session without recreating the meeting."""
+    stored: dict[str, bytes] = {}
+
+    async def save(snapshots: list[tuple[str, bytes]]) -> int:
+        stored.update(snapshots)
+        return len(snapshots)
+
+    async def take(meeting_id: str) -> bytes | None:
+        return stored.pop(meeting_id, None)
+
+    mock_storage.save_session_snapshots = AsyncMock(side_effect=save)
+    mock_storage.take_session_snapshot = AsyncMock(side_effect=take)
+    mock_storage.create_meeting = AsyncMock()
+    mock_storage.save_segments = AsyncMock()
+
+    old = MeetingManager()
+    await old.ingest_transcript("m-1", [{"text": "Hello team", "speaker": "Ana"}], user_id="u-1")
+    assert await old.drain() == 1
+
+    new = MeetingManager()
+    mock_storage.create_meeting.reset_mock()
+    await new.ingest_transcript("m-1", [{"text": "Let's start", "speaker": "Luis"}], user_id="u-1")
+
+    mock_storage.create_meeting.assert_not_awaited()
+    assert new._transcripts["m-1"].get_full_transcript() == "Hello team Let's start"
+    assert new._owners["m-1"] == "u-1"
+    assert stored == {}
+
+
+@patch("meetmind.api.meeting_api.storage")
+async def test_bad_snapshot_starts_fresh(mock_storage: AsyncMock) -> None:
+    """An unreadable snapshot is dropped and the session is created normally."""
+    mock_storage.take_session_snapshot = AsyncMock(return_value=b"garbage")
+    mock_storage.create_meeting = AsyncMock()
+
+    manager = MeetingManager()
+    await manager.get_or_create_session("m-1", user_id="u-1")
+
+    mock_storage.create_meeting.assert_awaited_once()
+    assert manager._transcripts["m-1"].segment_count == 0
+
+
+@patch("meetmind.api.meeting_api.storage")
+async def test_concurrent_first_batches_share_one_session(mock_storage: AsyncMock) -> None:
+    """Requests racing to open a meeting all end up in the same session."""
+
+    async def slow_take(meeting_id: str) -> None:
+        await asyncio.sleep(0.01)
+
+    mock_storage.take_session_snapshot = AsyncMock(side_effect=slow_take)
+    mock_storage.create_meeting = AsyncMock()
+    mock_storage.save_segments = AsyncMock()
+    manager = MeetingManager()
+
+    await asyncio.gather(
+        *(
+            manager.ingest_transcript("m-1", [{"text": f"line {i}"}], user_id="u-1")
+            for i in range(3)
+        )
+    )
+
+    mock_storage.take_session_snapshot.assert_awaited_once()
+    mock_storage.create_meeting.assert_awaited_once()
+    assert manager._transcripts["m-1"].segment_count == 3
+    assert manager._session_locks == {}
+
+
+@patch("meetmind.api.meeting_api.storage")
+async def test_failed_create_keeps_lock_for_waiters(mock_storage: AsyncMock) -> None:
+    """After a cancelled first create, waiters and newcomers still build one session."""
+    calls = 0
+
+    async def flaky_take(meeting_id: str) -> None:
+        nonlocal calls
+        calls += 1
+        await asyncio.sleep(0.01)
+        if calls == 1:
+            raise asyncio.CancelledError  # the first request goes away mid-create
+
+    mock_storage.take_session_snapshot = AsyncMock(side_effect=flaky_take)
+    mock_storage.create_meeting = AsyncMock()
+    manager = MeetingManager()
+
+    first = asyncio.create_task(manager.get_or_create_session("m-1"))
+    await asyncio.sleep(0)
+    waiter = asyncio.create_task(manager.get_or_create_session("m-1"))
+    await asyncio.sleep(0)
+    with pytest.raises(asyncio.CancelledError):
+        await first
+    # The waiter is still queued on the lock; a newcomer must use the same one
+    newcomer = asyncio.create_task(manager.get_or_create_session("m-1"))
+    await asyncio.gather(waiter, newcomer)
+
+    assert calls == 2
+    mock_storage.create_meeting.assert_awaited_once()
+    assert manager._session_locks == {}
+    assert manager._session_lock_users == {}
@@ -0,0 +1,133 @@
+"""Tests for VerifiedTokenCache and the cached decode_token fast path."""
+
+from __future__ import annotations
+
+import time
+from unittest.mock import patch
+
+import pytest
+from fastapi import HTTPException
+
+from meetmind.core import auth
+from meetmind.core.auth import create_access_token, decode_token, revoke_user_tokens
+from meetmind.core.token_cache import VerifiedTokenCache
+
+
+def _payload(sub: str = "user-1", ttl: float = 60.0, iat: float | None = None) -> dict[str, object]:
+    now = time.time()
+    return {"sub": sub, "type": "access", "iat": int(iat or now), "exp": int(now + ttl)}
+
+
+class TestVerifiedTokenCache:
+    """Tests for hit/miss, expiry, LRU eviction, and revocation."""
+
+    def test_put_and_get(self) -> None:
+        """A stored payload is returned for the same token."""
+        cache = VerifiedTokenCache()
+        payload = _payload()
+        cache.put("tok-a", payload)
+
+        assert cache.get("tok-a") == payload
+        assert cache.get("tok-b") is None
+
+    def test_expired_entry_is_dropped(self) -> None:
+        """Entries past their exp claim are treated as misses."""
+        cache = VerifiedTokenCache()
+        cache.put("tok", _payload(ttl=-1))
+
+        assert cache.get("tok") is None
+        assert cache.size == 0
+
+    def test_payload_without_exp_not_cached(self) -> None:
+        """Tokens without exp are never cached."""
+        cache = VerifiedTokenCache()
+        cache.put("tok", {"sub": "user-1"})
+
+        assert cache.size == 0
+
+    def test_max_entries_eviction(self) -> None:
+        """Least recently used tokens are evicted first."""
+        cache = VerifiedTokenCache(max_entries=2)
+        cache.put("tok-1", _payload())
+        cache.put("tok-2", _payload())
+        cache.get("tok-1")  # tok-2 is now least recently used
+        cache.put("tok-3", _payload())
+
+        assert cache.size == 2
+        assert cache.get("tok-2") is None
+        assert cache.get("tok-1") is not None
+
+    def test_revoke_token(self) -> None:
+        """A revoked token misses and reports revoked until expiry."""
+        cache = VerifiedTokenCache()
+        payload = _payload()
+        cache.put("tok", payload)
+        cache.revoke_token("tok", exp=float(payload["exp"]))  # type: ignore[arg-type]
+
+        assert cache.get("tok") is None
+        assert cache.is_revoked("tok", payload) is True
+
+    def test_revoke_user_only_affects_earlier_tokens(self) -> None:
+        """User revocation drops tokens issued before it, not after."""
+        cache = VerifiedTokenCache()
+        old = _payload(iat=time.time() - 120)
+        cache.put("old", old)
+        cache.put("other-user", _payload(sub="user-2", iat=time.time() - 120))
+
+        cache.revoke_user("user-1")
+        fresh = _payload()
+
+        assert cache.get("old") is None
+        assert cache.is_revoked("old", old) is True
+        assert cache.is_revoked("fresh", fresh) is False
+        assert cache.get("other-user") is not None
+
+    def test_to_dict(self) -> None:
+        """to_dict returns stats with all fields."""
+        cache = VerifiedTokenCache(max_entries=8)
+        cache.put("tok", _payload())
+        cache.get("tok")
+        cache.get("missing")
+
+        d = cache.to_dict()
+        assert d["size"] == 1
+        assert d["max_entries"] == 8
+        assert d["hits"] == 1
+        assert d["misses"] == 1
+        assert d["hit_rate_pct"] == 50.0
+
+
+class TestCachedDecodeToken:
+    """Tests for decode_token using the verified-token cache."""
+
+    def test_second_decode_skips_signature_verification(self) -> None:
+        """Repeat decodes of the same token are served from the cache."""
+        token = create_access_token("cache-user", "c@example.com")
+        first = decode_token(token)
+
+        with patch.object(auth.jwt, "decode", side_effect=AssertionError("not cached")):
+            second = decode_token(token)
+
+        assert second == first
+
+    def test_revoked_user_token_rejected(self) -> None:
+        """Tokens issued before a user revocation are rejected."""
+        old_claims = _payload(sub="revoked-user", iat=time.time() - 120)
+        token = auth.jwt.encode(old_claims, auth._get_jwt_secret(), algorithm="HS256")
+        decode_token(token)
+
+        revoke_user_tokens("revoked-user")
+
+        with pytest.raises(HTTPException) as exc:
+            decode_token(token)
+        assert exc.value.status_code == 401
+        assert exc.value.detail == "Token revoked"
+
+    def test_invalid_token_not_cached(self) -> None:
+        """Tokens failing verification never enter the cache."""
+        size_before = auth.token_cache.size
+
+        with pytest.raises(HTTPException):
+            decode_token("not-a-jwt")
+
+        assert auth.token_cache.size == size_before
@@ -0,0 +1,139 @@
+"""Tests for end-to-end ingest tracing and clock-offset estimation."""
+
+from __future__ import annotations
+
+import time
+from unittest.mock import AsyncMock, patch
+
+import pytest
+from fastapi.testclient import TestClient
+
+from meetmind.core import tracing
+from meetmind.core.tracing import ClockSync, TraceContext, Tracer, tracer
+
+# ─── Clock Offset ───────────────────────────────────────────────
+
+
+def test_clock_offset_uses_lowest_rtt_exchange() -> None:
+    """The NTP estimate from the least-delayed round trip wins."""
+    clock = ClockSync()
+    # Client is 5000ms behind; one fast and one congested exchange
+    clock.add_exchange(("u-1", "phone"), 1000, 6040, 6050, 1090)  # rtt 80, symmetric
+    clock.add_exchange(("u-1", "phone"), 2000, 7900, 7910, 2950)  # rtt 940, asymmetric
+
+    offset, rtt = clock.estimate(("u-1", "phone"))  # type: ignore[misc]
+    assert rtt == 80
+    assert offset == pytest.approx(5000)
+
+
+def test_clock_rejects_impossible_exchanges() -> None:
+    """Negative RTTs (clock jumps, forged echoes) are ignored."""
+    clock = ClockSync()
+    clock.add_exchange(("u-1", "phone"), 1000, 6000, 6500, 1100)
+    assert clock.estimate(("u-1", "phone")) is None
+
+
+def test_clock_estimates_are_per_user() -> None:
+    """Another user reusing a device ID doesn't share (or skew) the estimate."""
+    t = Tracer()
+    t.begin("m-1", "u-1", TraceContext("phone", clock=(0, 5000, 5000, 100)))
+    t.begin("m-2", "u-2", TraceContext("phone", clock=(0, 90_000, 90_000, 10)))
+
+    assert t.clock.estimate(("u-1", "phone")) == (4950, 100)
+    assert t.clock.estimate(("u-2", "phone")) == (89_995, 10)
+
+
+def test_trace_headers_parsed_leniently() -> None:
+    """Malformed headers fall back to unknown rather than failing ingest."""
+    ctx = TraceContext.from_headers(
+        {"x-trace-sent-at": "oops", "x-trace-clock": "1,2,3"}, fallback_device="u-1"
+    )
+    assert ctx == TraceContext(device="u-1")
+
+
+# ─── Batch Trace ────────────────────────────────────────────────
+
+
+async def test_spans_attach_to_current_trace_and_legs_are_split() -> None:
+    """Server spans land on the trace; client legs use the device offset."""
+    t = Tracer()
+    t.clock.add_exchange(("u-1", "phone"), 0, 5000, 5000, 100)  # offset 4950, rtt 100
+    now_client = time.time() * 1000 - 4950
+    trace = t.begin("m-1", "u-1", TraceContext("phone", sent_at_ms=now_client - 60))
+    trace.set_segments([{"text": "a", "id": 7, "captured_at": now_client - 4060}])
+
+    with tracing.span("db_persist"):
+        pass
+    tracing.mark("insight_published")
+
+    row = t.waterfall("m-1")["batches"][0]
+    spans = {s["name"]: s for s in row["spans"]}
+    assert row["trace_id"] == "m-1:7"
+    assert spans["client_batch_wait"]["duration_ms"] == pytest.approx(4000, abs=1)
+    assert spans["network_uplink"]["duration_ms"] == pytest.approx(60, abs=20)
+    assert spans["client_batch_wait"]["start_ms"] < spans["network_uplink"]["start_ms"] < 0
+    assert spans["db_persist"]["start_ms"] >= 0
+    assert "insight_published" in spans
+    assert row["end_to_end_ms"] > 4000
+
+
+def test_without_offset_network_is_unknown() -> None:
+    """No clock exchange yet: the batching wait is known, the network leg isn't."""
+    t = Tracer()
+    trace = t.begin("m-1", "u-1", TraceContext("phone", sent_at_ms=10_000))
+    trace.set_segments([{"text": "a", "captured_at": 7_500}])
+
+    row = trace.to_dict()
+    assert row["spans"][0]["duration_ms"] == 2500
+    assert row["spans"][1]["duration_ms"] is None
+    assert row["end_to_end_ms"] is None
+
+
+def test_retained_traces_are_bounded() -> None:
+    """Total traces and idle meetings are evicted, least recently active first."""
+    t = Tracer(max_batches=3, max_traces=5, ttl_seconds=60)
+    for meeting_id in ("m-1", "m-2"):
+        for _ in range(3):
+            t.begin(meeting_id, "u-1", TraceContext("phone"))
+
+    assert t.owner("m-1") is None  # 6 traces > 5: the older meeting went
+    assert len(t.waterfall("m-2")["batches"]) == 3
+    assert t._traces == 3
+
+    t.begin("m-3", "u-1", TraceContext("phone"))
+    with patch.object(tracing.time, "time", return_value=time.time() + 120):
+        t.begin("m-3", "u-1", TraceContext("phone"))
+    assert t.owner("m-2") is None  # idle past the TTL
+    assert t._traces == 2
+
+
+# ─── Endpoints ──────────────────────────────────────────────────
+
+
+@patch("meetmind.main.meeting_manager")
+def test_ingest_returns_timing_and_trace_is_owner_only(mock_manager: AsyncMock) -> None:
+    """Ingest echoes server times; only the owner can read the waterfall."""
+    from meetmind.core.auth import create_access_token
+    from meetmind.main import app
+
+    tracer.reset()
+    mock_manager.ingest_transcript = AsyncMock(return_value={"segments_added": 1})
+    client = TestClient(app, raise_server_exceptions=False)
+    owner = {"Authorization": f"Bearer {create_access_token('test-user-id', 'a@example.com')}"}
+    other = {"Authorization": f"Bearer {create_access_token('other-user', 'b@example.com')}"}
+
+    response = client.post(
+        "/api/meetings/m-1/transcript",
+        json={"segments": [{"text": "hi", "id": 1, "captured_at": 1000}]},
+        headers={**owner, "X-Device-Id": "phone", "X-Trace-Sent-At": "6000"},
+    )
+    timing = response.json()["trace"]
+    assert timing["trace_id"] == "m-1:1"
+    assert timing["responded_at"] >= timing["received_at"]
+
+    view = client.get("/api/meetings/m-1/trace", headers=owner)
+    assert view.status_code == 200
+    assert view.json()["breakdown"]["stages"]["client_batch_wait"]["p50_ms"] == 5000
+    text = client.get("/api/meetings/m-1/trace?format=text", headers=owner)
+    assert "client_batch_wait" in text.text
+    assert client.get("/api/meetings/m-1/trace", headers=other).status_code == 404
@@ -0,0 +1,195 @@
+"""Tests for the binary transcript ingest format."""
+
+from __future__ import annotations
+
+import struct
+from unittest.mock import AsyncMock, patch
+
+import pytest
+from fastapi.testclient import TestClient
+
+from meetmind.core.transcript_codec import (
+    CONTENT_TYPE,
+    MAX_SEGMENT_ID,
+    MAX_SEGMENTS,
+    TranscriptDecodeError,
+    decode_batch,
+    encode_batch,
+)
+
+SEGMENTS = [
+    {"text": "Hola, ¿empezamos?", "speaker": "Ana"},
+    {"text": "Yes — let's go 🚀", "speaker": "Bob"},
+    {"text": "", "speaker": "Ana"},
+    {"text": "Tercer punto", "speaker": "Ana"},
+]
+
+
+# ─── Codec ──────────────────────────────────────────────────────
+
+
+def test_roundtrip() -> None:
+    """Segments, speakers, and language survive encode → decode."""
+    segments, language = decode_batch(encode_batch(SEGMENTS, language="pt"))
+
+    assert segments == SEGMENTS
+    assert language == "pt"
+
+
+def test_trace_table_roundtrip() -> None:
+    """Segment IDs and capture times ride along when every segment has them."""
+    traced = [
+        {**seg, "id": 40 + i, "captured_at": 1_760_000_000_000 + i * 1500}
+        for i, seg in enumerate(SEGMENTS)
+    ]
+    data = encode_batch(traced)
+
+    assert data[5] == 1  # FLAG_TRACE
+    assert decode_batch(data)[0] == traced
+
+
+def test_speakers_are_interned() -> None:
+    """Speaker names are stored once, not per segment."""
+    many = [{"text": "x", "speaker": "A very long speaker name"}] * 100
+    data = encode_batch(many)
+
+    assert data.count(b"A very long speaker name") == 1
+    assert len(data) < 100 * 10 + 50
+
+
+def test_empty_batch() -> None:
+    """An empty batch decodes to no segments."""
+    assert decode_batch(encode_batch([], language="en")) == ([], "en")
+
+
+def test_oversized_fields_truncated_on_char_boundary() -> None:
+    """Long text is clipped to the u16 length field without splitting a character."""
+    segments, _ = decode_batch(encode_batch([{"text": "é" * 40000, "speaker": "s" * 300}]))
+
+    assert segments[0]["text"] == "é" * 32767
+    assert segments[0]["speaker"] == "s" * 255
+
+
+def test_decode_accepts_memoryview() -> None:
+    """Bodies can be decoded in place from a buffer."""
+    data = bytearray(encode_batch(SEGMENTS))
+    segments, _ = decode_batch(memoryview(data))
+    assert len(segments) == len(SEGMENTS)
+
+
+@pytest.mark.parametrize(
+    ("mutate", "message"),
+    [
+        (lambda d: b"JSON" + d[4:], "Bad magic"),
+        (lambda d: d[:4] + b"\x09" + d[5:], "Unsupported version"),
+        (lambda d: d[:6], "Truncated header"),
+        (lambda d: d[:-3], "out of range"),
+        (lambda d: d[:20], "Truncated"),
+    ],
+)
+def test_malformed_batches_rejected(mutate: object, message: str) -> None:
+    """Corrupt input raises TranscriptDecodeError, never IndexError."""
+    data = encode_batch(SEGMENTS)
+    with pytest.raises(TranscriptDecodeError, match=message):
+        decode_batch(mutate(data))  # type: ignore[operator]
+
+
+def test_too_many_segments_rejected() -> None:
+    """Segment count is capped before the table is read."""
+    header = struct.pack("<4sBBHBB", b"MMTS", 1, 0, MAX_SEGMENTS + 1, 0, 0)
+    with pytest.raises(TranscriptDecodeError, match="Too many"):
+        decode_batch(header)
+
+
+def test_invalid_utf8_rejected() -> None:
+    """Text must be valid UTF-8."""
+    data = bytearray(encode_batch([{"text": "ab", "speaker": "s"}]))
+    data[-1] = 0xFF
+    with pytest.raises(TranscriptDecodeError, match="UTF-8"):
+        decode_batch(bytes(data))
+
+
+def test_out_of_range_segment_id_rejected() -> None:
+    """Trace ids above the Postgres int range are refused at decode time."""
+    data = encode_batch([{"text": "x", "speaker": "s", "id": MAX_SEGMENT_ID + 1, "captured_at": 0}])
+    with pytest.raises(TranscriptDecodeError, match="Segment id"):
+        decode_batch(data)
+
+
+# ─── Endpoint ───────────────────────────────────────────────────
+
+
+def _authed_client() -> TestClient:
+    from meetmind.core.auth import create_access_token
+    from meetmind.main import app
+
+    client = TestClient(app, raise_server_exceptions=False)
+    token = create_access_token("test-user-id", "test@example.com")
+    client.headers.update({"Authorization": f"Bearer {token}"})
+    return client
+
+
+@patch("meetmind.main.meeting_manager")
+def test_binary_ingest_endpoint(mock_manager: AsyncMock) -> None:
+    """Binary batches reach the meeting manager like JSON ones."""
+    mock_manager.ingest_transcript = AsyncMock(return_value={"segments_added": 3})
+
+    response = _authed_client().post(
+        "/api/meetings/m-1/transcript/binary",
+        content=encode_batch(SEGMENTS, language="es"),
+        headers={"Content-Type": CONTENT_TYPE},
+    )
+
+    assert response.status_code == 200
+    kwargs = mock_manager.ingest_transcript.await_args.kwargs
+    assert kwargs["segments"] == SEGMENTS
+    assert kwargs["language"] == "es"
+    assert kwargs["user_id"] == "test-user-id"
+
+
+@patch("meetmind.main.meeting_manager")
+def test_binary_ingest_rejects_garbage(mock_manager: AsyncMock) -> None:
+    """Malformed batches return 400 without touching the manager."""
+    mock_manager.ingest_transcript = AsyncMock()
+
+    response = _authed_client().post(
+        "/api/meetings/m-1/transcript/binary",
+        content=b"not a batch",
+        headers={"Content-Type": CONTENT_TYPE},
+    )
+
+    assert response.status_code == 400
+    mock_manager.ingest_transcript.assert_not_awaited()
+
+
+@patch("meetmind.main.meeting_manager")
+def test_json_ingest_passes_segments_through(mock_manager: AsyncMock) -> None:
+    """Validated JSON segments reach the manager as the dicts the client sent."""
+    mock_manager.ingest_transcript = AsyncMock(return_value={"segments_added": 2})
+    sent = [{"text": "Hola", "speaker": "Ana", "id": 7, "captured_at": 1}, {"text": "Sí"}]
+
+    response = _authed_client().post("/api/meetings/m-1/transcript", json={"segments": sent})
+
+    assert response.status_code == 200
+    assert mock_manager.ingest_transcript.await_args.kwargs["segments"] == sent
+
+
+@pytest.mark.parametrize("bad_id", ["abc", -1, MAX_SEGMENT_ID + 1])
+@pytest.mark.parametrize("persist_only", [False, True])
+@patch("meetmind.main.meeting_manager")
+def test_json_ingest_rejects_bad_segment_id(
+    mock_manager: AsyncMock, persist_only: bool, bad_id: object
+) -> None:
+    """A non-numeric or out-of-range id is a 422, on the live and the late path."""
+    mock_manager.ingest_transcript = AsyncMock()
+    mock_manager.persist_transcript = AsyncMock()
+
+    response = _authed_client().post(
+        "/api/meetings/m-1/transcript",
+        params={"persist_only": persist_only},
+        json={"segments": [{"text": "x", "speaker": "s", "id": bad_id}]},
+    )
+
+    assert response.status_code == 422
+    mock_manager.ingest_transcript.assert_not_awaited()
+    mock_manager.persist_transcript.assert_not_awaited()
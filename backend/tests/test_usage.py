@@ -0,0 +1,165 @@
+"""Tests for per-user monthly usage counters and quota enforcement."""
+
+from __future__ import annotations
+
+import calendar
+from unittest.mock import AsyncMock, patch
+
+import pytest
+from fastapi.testclient import TestClient
+
+from meetmind.core import cost_ledger, usage
+from meetmind.core.usage import QuotaExceededError, UsageCounters, _Counter
+
+
+def _loaded(counters: UsageCounters, user_id: str, tier: str = "free", **totals: float) -> None:
+    counter = _Counter(tier=tier, loaded=True)
+    counter.total = [totals.get(name, 0.0) for name in usage.METRICS]
+    counters._users[user_id] = counter
+
+
+# ─── Quotas ─────────────────────────────────────────────────────
+
+
+def test_free_tier_quotas_enforced() -> None:
+    """Minutes and summaries count the request itself; LLM dollars block once spent."""
+    counters = UsageCounters()
+    _loaded(counters, "u-free", minutes=299.5, summaries=14)
+
+    counters.check("u-free", minutes=0.4)
+    with pytest.raises(QuotaExceededError, match="minutes"):
+        counters.check("u-free", minutes=1.0)
+
+    counters.check("u-free", summary=True)
+    counters.add("u-free", summaries=1)
+    with pytest.raises(QuotaExceededError, match="summaries"):
+        counters.check("u-free", summary=True)
+
+    counters.add("u-free", llm_usd=1.0)
+    with pytest.raises(QuotaExceededError, match="llm_usd"):
+        counters.check("u-free")
+
+
+def test_paid_tiers_and_unknown_users() -> None:
+    """Pro/team get the larger quota; users not loaded yet aren't blocked."""
+    counters = UsageCounters()
+    _loaded(counters, "u-team", tier="team", minutes=500.0)
+
+    counters.check("u-team", minutes=100.0)
+    counters.check("u-new", minutes=10_000.0)
+    assert counters.usage("u-team")["minutes"] == {"used": 500.0, "limit": 3000.0}
+
+
+def test_minutes_estimated_from_words() -> None:
+    """Segments carry text only, so duration comes from the word count."""
+    assert usage.minutes_of([{"text": "word " * 150}, {"text": ""}]) == pytest.approx(1.0)
+
+
+# ─── Persistence ────────────────────────────────────────────────
+
+
+@patch("meetmind.core.usage.storage")
+async def test_flush_adds_increments_and_refreshes_totals(mock_storage: AsyncMock) -> None:
+    """The DB returns totals with other instances' usage; failures keep the increments."""
+    mock_storage.pool_ready.return_value = False
+    mock_storage.add_usage = AsyncMock(
+        side_effect=[RuntimeError("db down"), [("u-1", "pro", 42.0, 0.5, 2)]]
+    )
+    counters = UsageCounters()
+    counters.add("u-1", minutes=2.0, llm_usd=0.1)
+
+    assert await counters.flush() == 0
+    assert counters.usage("u-1")["minutes"]["used"] == 2.0
+
+    assert await counters.flush() == 1
+    month, deltas = mock_storage.add_usage.await_args.args
+    assert month == usage.month_key()
+    assert deltas == [("u-1", 2.0, 0.1, 0)]
+    assert counters.usage("u-1")["tier"] == "pro"
+    assert counters.usage("u-1")["minutes"]["used"] == 42.0
+
+    mock_storage.add_usage.reset_mock()
+    mock_storage.add_usage.return_value = []
+    await counters.flush()
+    assert mock_storage.add_usage.await_args.args[1] == []
+
+
+@patch("meetmind.core.usage.storage")
+async def test_month_rollover(mock_storage: AsyncMock) -> None:
+    """A new month starts from zero; the old month's tail is still flushed to it."""
+    mock_storage.pool_ready.return_value = False
+    mock_storage.add_usage = AsyncMock(return_value=[])
+    january = calendar.timegm((2026, 1, 31, 23, 59, 0))
+    with patch("meetmind.core.usage.time.time", return_value=january):
+        counters = UsageCounters()
+        _loaded(counters, "u-1", minutes=299.0)
+        counters.add("u-1", minutes=0.5)
+
+    with patch("meetmind.core.usage.time.time", return_value=january + 120):
+        counters.check("u-1", minutes=5.0)  # fresh month, not loaded yet
+        assert counters._month == "2026-02"
+        await counters.flush()
+
+    months = [call.args[0] for call in mock_storage.add_usage.await_args_list]
+    assert months == ["2026-01", "2026-02"]
+    assert mock_storage.add_usage.await_args_list[0].args[1] == [("u-1", 0.5, 0.0, 0)]
+    assert counters._closing == {}
+
+
+def test_llm_cost_charged_to_meeting_owner() -> None:
+    """Ledgered LLM calls count against the owner's monthly dollars."""
+    before = usage.counters.usage("u-owner")["llm_usd"]["used"]
+    with cost_ledger.meeting("m-1", "u-owner"):
+        cost = cost_ledger.ledger.record_llm(
+            "openai", "gpt-4o", input_tokens=1000, output_tokens=100
+        )
+    after = usage.counters.usage("u-owner")["llm_usd"]["used"]
+    assert after == pytest.approx(before + cost, abs=1e-4)
+
+
+# ─── Endpoints ──────────────────────────────────────────────────
+
+
+def test_ingest_over_quota_stores_without_screening() -> None:
+    """An exhausted user's meeting keeps its transcript; screening stops."""
+    from meetmind.core.auth import create_access_token
+    from meetmind.main import app
+
+    _loaded(usage.counters, "u-over", minutes=300.0)
+    token = create_access_token("u-over", "over@example.com")
+    client = TestClient(app, raise_server_exceptions=False)
+
+    with patch("meetmind.main.meeting_manager") as manager:
+        manager.ingest_transcript = AsyncMock(return_value={"segments_added": 1})
+        response = client.post(
+            "/api/meetings/m-1/transcript",
+            json={"segments": [{"text": "one more minute"}]},
+            headers={"Authorization": f"Bearer {token}"},
+        )
+        assert manager.ingest_transcript.await_args.kwargs["screen"] is False
+
+    assert response.status_code == 200
+    assert "minutes" in response.json()["quota_exceeded"]
+    usage.counters._users.pop("u-over")
+
+
+def test_copilot_rejected_with_402_when_quota_used() -> None:
+    """LLM calls are still refused once a quota is used up."""
+    from meetmind.core.auth import create_access_token
+    from meetmind.main import app
+
+    _loaded(usage.counters, "u-over", llm_usd=5.0)
+    token = create_access_token("u-over", "over@example.com")
+    client = TestClient(app, raise_server_exceptions=False)
+
+    with patch("meetmind.main.meeting_manager") as manager:
+        response = client.post(
+            "/api/meetings/m-1/copilot",
+            json={"question": "What next?", "transcript_context": "..."},
+            headers={"Authorization": f"Bearer {token}"},
+        )
+        manager.run_copilot.assert_not_called()
+
+    assert response.status_code == 402
+    assert "llm_usd" in response.json()["detail"]
+    usage.counters._users.pop("u-over")
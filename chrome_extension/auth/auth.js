@@ -113,6 +113,8 @@ export async function getAuthHeaders() {
  * @returns {Promise<any>} Parsed JSON response
  */
 export async function apiFetch(path, options = {}) {
+    primeCompressionDictionary();
+    options = await compressBody(options);
     const headers = await getAuthHeaders();
     const res = await fetch(`${API_BASE}${path}`, {
         ...options,
@@ -218,3 +220,42 @@ async function tryRefreshToken() {
         return false;
     }
 }
+
+// ─── Compression ───────────────────────────────────────────────────
+
+/** Request bodies at least this large are sent gzip-compressed. */
+const GZIP_MIN_BYTES = 1024;
+
+let dictionaryPrimed = false;
+
+/**
+ * Fetch the shared compression dictionary once per page.
+ *
+ * The response carries `Use-As-Dictionary`, so Chrome stores it and
+ * advertises `dcz` on later API requests; JSON responses then arrive
+ * zstd-compressed against it and are decoded natively by the browser.
+ */
+function primeCompressionDictionary() {
+    if (dictionaryPrimed) return;
+    dictionaryPrimed = true;
+    fetch(`${API_BASE}/api/compression/dictionary`).catch(() => { });
+}
+
+/**
+ * Gzip large string bodies with the native CompressionStream.
+ * @param {RequestInit} options - fetch options
+ * @returns {Promise<RequestInit>} Options with a compressed body, or unchanged
+ */
+async function compressBody(options) {
+    const body = options.body;
+    if (typeof body !== 'string' || body.length < GZIP_MIN_BYTES) return options;
+    if (typeof CompressionStream === 'undefined') return options;
+
+    const stream = new Blob([body]).stream().pipeThrough(new CompressionStream('gzip'));
+    const compressed = await new Response(stream).arrayBuffer();
+    return {
+        ...options,
+        body: compressed,
+        headers: { ...(options.headers || {}), 'Content-Encoding': 'gzip' },
+    };
+}
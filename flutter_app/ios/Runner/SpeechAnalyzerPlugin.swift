@@ -8,6 +8,14 @@ import Speech
 /// Uses MethodChannel for commands (start/stop/setLanguage) and
 /// EventChannel for streaming transcription results back to Dart.
 ///
+/// A voice activity gate (`SpeechGate`) sits between the mic tap and the
+/// analyzer: only speech, plus a short pre-roll, is fed in, so the
+/// analyzer idles through silence instead of decoding it. Every buffer
+/// carries its real start time, so results stay on the mic's timeline
+/// across the gaps, and the analyzer is finalized through the end of each
+/// utterance when the gate closes. `speech` and `silence` status events
+/// mark the boundaries.
+///
 /// **Requires iOS 26.0+ deployment target.**
 class SpeechAnalyzerPlugin: NSObject {
     static let methodChannelName = "com.aurameet/speech_analyzer"
@@ -27,6 +35,11 @@ class SpeechAnalyzerPlugin: NSObject {
     private var transcriptionTask: Task<Void, Never>?
     private var analyzerTask: Task<Void, Never>?
 
+    // VAD — only touched from the audio tap
+    private var gate = SpeechGate()
+    private var preRoll: [(input: AnalyzerInput, seconds: Double)] = []
+    private var samplesSeen: CMTimeValue = 0  // mic samples since the tap started
+
     init(messenger: FlutterBinaryMessenger) {
         methodChannel = FlutterMethodChannel(
             name: SpeechAnalyzerPlugin.methodChannelName,
@@ -211,10 +224,18 @@ class SpeechAnalyzerPlugin: NSObject {
                 }
                 self.audioContinuation = continuation
 
-                // 7. Install audio tap — convert & yield each buffer
+                // 7. Install audio tap — convert, gate & yield each buffer
+                self.gate = SpeechGate()
+                self.preRoll.removeAll()
+                self.samplesSeen = 0
+                let timescale = CMTimeScale(micFormat.sampleRate)
                 inputNode.installTap(onBus: 0, bufferSize: 4096, format: micFormat) { [weak self] buffer, when in
                     guard let self = self, self.isListening else { return }
 
+                    let startTime = CMTime(value: self.samplesSeen, timescale: timescale)
+                    self.samplesSeen += CMTimeValue(buffer.frameLength)
+
+                    let input: AnalyzerInput
                     if let converter = converter {
                         // Convert to analyzer format
                         let frameCount = AVAudioFrameCount(
@@ -231,16 +252,53 @@ class SpeechAnalyzerPlugin: NSObject {
                             return buffer
                         }
 
-                        if error == nil {
-                            let input = AnalyzerInput(buffer: convertedBuffer)
-                            self.audioContinuation?.yield(input)
-                        } else {
-                            debugPrint("[SpeechAnalyzer] Conversion error: \(error!)")
+                        if let error = error {
+                            debugPrint("[SpeechAnalyzer] Conversion error: \(error)")
+                            return
                         }
+                        input = AnalyzerInput(buffer: convertedBuffer, bufferStartTime: startTime)
                     } else {
                         // No conversion needed
-                        let input = AnalyzerInput(buffer: buffer)
+                        input = AnalyzerInput(buffer: buffer, bufferStartTime: startTime)
+                    }
+
+                    // Gate on the mic buffer's 20 ms frame levels
+                    let seconds = Double(buffer.frameLength) / micFormat.sampleRate
+                    let wasSpeech = self.gate.isSpeech
+                    let isSpeech = self.gate.process(
+                        levels: SpeechGate.frameLevels(buffer, sampleRate: micFormat.sampleRate)
+                    )
+
+                    if isSpeech || wasSpeech {
+                        if !wasSpeech {
+                            // Speech started — send the pre-roll first
+                            for held in self.preRoll {
+                                self.audioContinuation?.yield(held.input)
+                            }
+                            self.preRoll.removeAll()
+                            self.sendEvent(["type": "status", "status": "speech", "locale": locale])
+                        }
+                        // The closing buffer still holds the utterance's tail
                         self.audioContinuation?.yield(input)
+                        if isSpeech { return }
+
+                        // Utterance over: finish it now rather than waiting for more audio
+                        let end = CMTime(value: self.samplesSeen, timescale: timescale)
+                        Task {
+                            do {
+                                try await analyzer.finalize(through: end)
+                            } catch {
+                                debugPrint("[SpeechAnalyzer] Finalize error: \(error)")
+                            }
+                        }
+                        self.sendEvent(["type": "status", "status": "silence", "locale": locale])
+                        return
+                    }
+
+                    self.preRoll.append((input, seconds))
+                    var held = self.preRoll.reduce(0) { $0 + $1.seconds }
+                    while held > SpeechGate.preRollSeconds, self.preRoll.count > 1 {
+                        held -= self.preRoll.removeFirst().seconds
                     }
                 }
 
@@ -369,6 +427,94 @@ class SpeechAnalyzerPlugin: NSObject {
     }
 }
 
+// MARK: - Voice Activity Gate
+
+/// Energy-based VAD with an adaptive noise floor.
+///
+/// The same state machine as `VoiceActivityGate` in Dart: each tap buffer
+/// is split into 20 ms frames, 3 loud frames open the gate, 40 quiet ones
+/// close it, and the floor tracks at the same per-frame rates — slowly
+/// while open, so sustained noise closes the gate eventually. The gate
+/// state is read once per buffer.
+private struct SpeechGate {
+    /// Frame length the gate judges.
+    static let frameSeconds = 0.02
+    /// Audio kept from before speech starts.
+    static let preRollSeconds = 0.3
+    /// Loud frames that open the gate (60 ms).
+    static let openFrames = 3
+    /// Quiet frames that end an utterance (800 ms).
+    static let hangoverFrames = 40
+    /// Speech must be this many times the noise floor...
+    static let openRatio: Float = 3.0
+    /// ...and at least this loud (RMS, ≈ -44 dBFS).
+    static let minRms: Float = 0.006
+    /// Per-frame rate the floor rises at while the gate is open.
+    static let openTrackRate: Float = 0.001
+
+    private(set) var isSpeech = false
+    private var noiseFloor: Float = 0.009
+    private var loud = 0
+    private var quiet = 0
+
+    /// Update with one buffer's frame levels; returns whether the gate is open.
+    mutating func process(levels: [Float]) -> Bool {
+        for rms in levels {
+            let isLoud = rms >= max(SpeechGate.minRms, noiseFloor * SpeechGate.openRatio)
+            if isSpeech {
+                noiseFloor += (rms - noiseFloor) * (rms < noiseFloor ? 0.2 : SpeechGate.openTrackRate)
+                quiet = isLoud ? 0 : quiet + 1
+                if quiet >= SpeechGate.hangoverFrames {
+                    isSpeech = false
+                    loud = 0
+                }
+                continue
+            }
+            if !isLoud {
+                loud = 0
+                // Track the floor: down fast, up slowly (speech isn't noise)
+                noiseFloor += (rms - noiseFloor) * (rms < noiseFloor ? 0.2 : 0.02)
+                continue
+            }
+            loud += 1
+            if loud >= SpeechGate.openFrames {
+                isSpeech = true
+                quiet = 0
+            }
+        }
+        return isSpeech
+    }
+
+    /// RMS of each 20 ms frame of the first channel (samples scaled to ±1).
+    static func frameLevels(_ buffer: AVAudioPCMBuffer, sampleRate: Double) -> [Float] {
+        let count = Int(buffer.frameLength)
+        let frame = max(1, Int(sampleRate * frameSeconds))
+        guard count > 0 else { return [] }
+
+        let sample: (Int) -> Float
+        if let samples = buffer.floatChannelData?[0] {
+            sample = { samples[$0] }
+        } else if let samples = buffer.int16ChannelData?[0] {
+            sample = { Float(samples[$0]) / 32768 }
+        } else {
+            return [Float](repeating: 1, count: openFrames) // unknown format — never gate it out
+        }
+
+        // Whole frames only (a short tail is too noisy to judge), unless
+        // the buffer is shorter than one frame
+        let frames = max(1, count / frame)
+        let length = min(frame, count)
+        return (0..<frames).map { index in
+            var sum: Float = 0
+            for i in index * length..<(index + 1) * length {
+                let s = sample(i)
+                sum += s * s
+            }
+            return (sum / Float(length)).squareRoot()
+        }
+    }
+}
+
 // MARK: - FlutterStreamHandler
 
 extension SpeechAnalyzerPlugin: FlutterStreamHandler {
@@ -6,6 +6,7 @@ import 'package:intl/intl.dart';
 import 'package:meetmind/config/theme.dart';
 import 'package:meetmind/providers/auth_provider.dart';
 import 'package:meetmind/services/meeting_api_service.dart';
+import 'package:meetmind/services/meeting_store.dart';
 
 /// Meeting history screen — browse past sessions with search & swipe delete.
 class HistoryScreen extends ConsumerStatefulWidget {
@@ -34,7 +35,7 @@ class _HistoryScreenState extends ConsumerState<HistoryScreen> {
     super.dispose();
   }
 
-  /// Load meetings from the backend API.
+  /// Load meetings — cached list first, then delta-sync with the backend.
   Future<void> _loadMeetings() async {
     // Guest mode — skip API call, show empty list
     final authState = ref.read(authProvider);
@@ -48,13 +49,16 @@ class _HistoryScreenState extends ConsumerState<HistoryScreen> {
       return;
     }
 
+    final cached = await MeetingStore.instance.cachedMeetings();
+    if (!mounted) return;
     setState(() {
-      _isLoading = true;
+      _meetings = cached;
+      _isLoading = cached.isEmpty;
       _error = null;
     });
 
     try {
-      final meetings = await _api.listMeetings();
+      final meetings = await MeetingStore.instance.sync(_api);
       if (mounted) {
         setState(() {
           _meetings = meetings;
@@ -64,12 +68,15 @@ class _HistoryScreenState extends ConsumerState<HistoryScreen> {
     } on ApiException catch (e) {
       if (mounted) {
         setState(() {
-          _error = e.message;
+          if (_meetings.isEmpty) _error = e.message;
           _isLoading = false;
         });
       }
     } catch (e) {
-      if (mounted) {
+      // Offline with a cached list — keep showing it
+      if (mounted && _meetings.isNotEmpty) {
+        setState(() => _isLoading = false);
+      } else if (mounted) {
         String errorMsg = 'Connection error';
         if (e.toString().contains('TimeoutException')) {
           errorMsg = 'Server is slow — tap Retry';
@@ -110,6 +117,7 @@ class _HistoryScreenState extends ConsumerState<HistoryScreen> {
     if (confirmed == true) {
       try {
         await _api.deleteMeeting(meetingId);
+        await MeetingStore.instance.remove(meetingId);
         setState(() {
           _meetings.removeAt(index);
         });
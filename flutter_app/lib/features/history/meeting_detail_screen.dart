@@ -9,6 +9,7 @@ import 'package:meetmind/providers/subscription_provider.dart';
 import 'package:meetmind/services/export_service.dart';
 import 'package:meetmind/services/meeting_api_service.dart';
 import 'package:meetmind/services/meeting_pdf_service.dart';
+import 'package:meetmind/services/meeting_store.dart';
 
 /// Meeting detail screen — view a past meeting's transcript, summary, insights.
 class MeetingDetailScreen extends ConsumerStatefulWidget {
@@ -44,7 +45,7 @@ class _MeetingDetailScreenState extends ConsumerState<MeetingDetailScreen>
     super.dispose();
   }
 
-  /// Load meeting data from the backend.
+  /// Load meeting data — from the local store unless it changed.
   Future<void> _loadMeeting() async {
     setState(() {
       _isLoading = true;
@@ -52,7 +53,10 @@ class _MeetingDetailScreenState extends ConsumerState<MeetingDetailScreen>
     });
 
     try {
-      final meeting = await _api.getMeeting(widget.meetingId);
+      final meeting = await MeetingStore.instance.meeting(
+        _api,
+        widget.meetingId,
+      );
       if (mounted) {
         setState(() {
           _meeting = meeting;
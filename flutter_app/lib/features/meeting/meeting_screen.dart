@@ -144,6 +144,7 @@ class _MeetingScreenState extends ConsumerState<MeetingScreen>
                 SummaryPanel(
                   summary: meeting?.meetingSummary,
                   isLoading: meeting?.isSummaryLoading ?? false,
+                  error: meeting?.summaryError,
                   hasTranscript: (meeting?.segments.length ?? 0) > 0,
                   onGenerate: () {
                     ref.read(meetingProvider.notifier).requestSummary();
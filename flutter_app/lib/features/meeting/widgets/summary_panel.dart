@@ -12,6 +12,7 @@ class SummaryPanel extends StatelessWidget {
     required this.isLoading,
     required this.hasTranscript,
     required this.onGenerate,
+    this.error,
     super.key,
   });
 
@@ -27,6 +28,9 @@ class SummaryPanel extends StatelessWidget {
   /// Callback to request summary generation.
   final VoidCallback onGenerate;
 
+  /// Why the last request failed (quota, server or network).
+  final String? error;
+
   @override
   Widget build(BuildContext context) {
     if (isLoading) {
@@ -34,7 +38,11 @@ class SummaryPanel extends StatelessWidget {
     }
 
     if (summary == null) {
-      return _EmptyState(hasTranscript: hasTranscript, onGenerate: onGenerate);
+      return _EmptyState(
+        hasTranscript: hasTranscript,
+        onGenerate: onGenerate,
+        error: error,
+      );
     }
 
     return _SummaryContent(summary: summary!);
@@ -81,10 +89,15 @@ class _LoadingState extends StatelessWidget {
 
 /// Empty state before summary generation.
 class _EmptyState extends StatelessWidget {
-  const _EmptyState({required this.hasTranscript, required this.onGenerate});
+  const _EmptyState({
+    required this.hasTranscript,
+    required this.onGenerate,
+    this.error,
+  });
 
   final bool hasTranscript;
   final VoidCallback onGenerate;
+  final String? error;
 
   @override
   Widget build(BuildContext context) {
@@ -116,6 +129,16 @@ class _EmptyState extends StatelessWidget {
               context,
             ).textTheme.bodySmall?.copyWith(color: Colors.white38),
           ),
+          if (error != null) ...<Widget>[
+            const SizedBox(height: 12),
+            Text(
+              error!,
+              textAlign: TextAlign.center,
+              style: Theme.of(
+                context,
+              ).textTheme.bodySmall?.copyWith(color: MeetMindTheme.error),
+            ),
+          ],
           const SizedBox(height: 24),
           ElevatedButton.icon(
             onPressed: hasTranscript ? onGenerate : null,
@@ -243,6 +243,7 @@ class MeetingSession {
     this.meetingSummary,
     this.isCopilotLoading = false,
     this.isSummaryLoading = false,
+    this.summaryError,
   });
 
   final String id;
@@ -260,6 +261,9 @@ class MeetingSession {
   final bool isCopilotLoading;
   final bool isSummaryLoading;
 
+  /// Why the last summary request failed, shown until the next one.
+  final String? summaryError;
+
   /// Live partial text from on-device STT (updates in real-time).
   final String partialTranscript;
 
@@ -282,6 +286,8 @@ class MeetingSession {
     MeetingSummary? meetingSummary,
     bool? isCopilotLoading,
     bool? isSummaryLoading,
+    String? summaryError,
+    bool clearSummaryError = false,
   }) {
     return MeetingSession(
       id: id,
@@ -299,6 +305,8 @@ class MeetingSession {
       meetingSummary: meetingSummary ?? this.meetingSummary,
       isCopilotLoading: isCopilotLoading ?? this.isCopilotLoading,
       isSummaryLoading: isSummaryLoading ?? this.isSummaryLoading,
+      summaryError:
+          clearSummaryError ? null : summaryError ?? this.summaryError,
     );
   }
 }
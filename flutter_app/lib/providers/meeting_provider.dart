@@ -4,11 +4,13 @@ import 'package:flutter/widgets.dart';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
 import 'package:meetmind/models/meeting_models.dart';
 import 'package:meetmind/providers/auth_provider.dart';
+import 'package:meetmind/services/live_events_service.dart';
 import 'package:meetmind/services/meeting_api_service.dart';
 import 'package:meetmind/services/notification_service.dart';
 import 'package:meetmind/services/permission_service.dart';
 import 'package:meetmind/services/stt_service.dart';
 import 'package:meetmind/services/subscription_service.dart';
+import 'package:meetmind/services/upload_queue.dart';
 import 'package:meetmind/services/user_preferences.dart';
 import 'package:uuid/uuid.dart';
 
@@ -48,12 +50,19 @@ class MeetingNotifier extends StateNotifier<MeetingSession?> {
 
   final Ref _ref;
   StreamSubscription<SttTranscript>? _sttSub;
+  StreamSubscription<LiveEvent>? _liveSub;
   Timer? _durationTimer;
   Timer? _transcriptBatchTimer;
   Timer? _partialClearTimer;
 
-  // Buffer transcript segments for batched REST calls
-  final List<Map<String, String>> _pendingSegments = [];
+  // Durable queue for batched transcript uploads (survives offline/app kills)
+  final TranscriptUploadQueue _uploads = TranscriptUploadQueue.instance;
+
+  // Per-meeting segment sequence — the backend traces latency by segment ID
+  int _segmentSeq = 0;
+
+  // Over-quota notice already shown for this meeting
+  bool _quotaNotified = false;
 
   /// Start a new meeting session.
   Future<void> startMeeting({String title = 'New Meeting'}) async {
@@ -92,6 +101,17 @@ class MeetingNotifier extends StateNotifier<MeetingSession?> {
       );
     }
 
+    // Live push channel — insights arrive as soon as the backend has them
+    if (!_ref.read(authProvider).isGuest) {
+      _listenToLiveEvents();
+      await _uploads.open(
+        state!.id,
+        language: UserPreferences.instance.transcriptionLanguage.code,
+      );
+      // Transcripts a killed or offline earlier run couldn't send
+      unawaited(_uploads.drainOrphans(_uploadOrphan));
+    }
+
     // Batch transcript segments every 5s for REST API
     _transcriptBatchTimer = Timer.periodic(
       const Duration(seconds: 5),
@@ -113,6 +133,9 @@ class MeetingNotifier extends StateNotifier<MeetingSession?> {
     _durationTimer?.cancel();
     _transcriptBatchTimer?.cancel();
     _sttSub?.cancel();
+    _liveSub?.cancel();
+    _liveSub = null;
+    LiveEventsService.instance.disconnect();
 
     // Stop STT
     final SttService stt = _ref.read(sttProvider);
@@ -120,8 +143,9 @@ class MeetingNotifier extends StateNotifier<MeetingSession?> {
       stt.stopStream();
     }
 
-    // Flush remaining transcripts
-    await _flushTranscripts();
+    // Flush remaining transcripts; anything unsent stays in the journal
+    await _flushTranscripts(force: true);
+    await _uploads.close(state!.id);
 
     final DateTime endTime = DateTime.now();
     final int durationSecs = endTime.difference(state!.startTime).inSeconds;
@@ -156,7 +180,8 @@ class MeetingNotifier extends StateNotifier<MeetingSession?> {
     }
 
     // Clear session so next visit creates a fresh meeting
-    _flushFailures = 0;
+    _segmentSeq = 0;
+    _quotaNotified = false;
     _partialClearTimer?.cancel();
     state = null;
   }
@@ -199,98 +224,115 @@ class MeetingNotifier extends StateNotifier<MeetingSession?> {
     );
     state = state!.copyWith(segments: [...state!.segments, segment]);
 
-    // Queue for batched REST call
-    _pendingSegments.add(<String, String>{
-      'text': text,
-      'speaker': speaker,
-    });
+    // Queue for batched REST call, stamped for end-to-end tracing
+    // (guests have no journal open — their transcript stays local)
+    unawaited(
+      _uploads.add(state!.id, <String, Object>{
+        'text': text,
+        'speaker': speaker,
+        'id': _segmentSeq++,
+        'captured_at': segment.timestamp.millisecondsSinceEpoch,
+      }),
+    );
   }
 
-  /// Flush pending transcript segments to backend via REST.
+  /// Upload queued transcript segments to the backend via REST.
   ///
-  /// Resilient to backend outages:
-  /// - Re-queues on transient errors (network, 500) up to 3 times
-  /// - Drops segments on permanent errors (401, 403, 404)
-  /// - Prevents infinite log spam from backend issues
-  int _flushFailures = 0;
-  static const int _maxFlushRetries = 3;
-
-  Future<void> _flushTranscripts() async {
-    if (_pendingSegments.isEmpty || state == null) return;
-
-    // Guest mode — skip API calls, transcription is local only
-    final authState = _ref.read(authProvider);
-    if (authState.isGuest) {
-      _pendingSegments.clear();
-      return;
-    }
+  /// The queue decides whether it's time (enough text, or the oldest
+  /// segment has waited long enough, and not backing off); [force]
+  /// sends now. Failed uploads stay queued — see [TranscriptUploadQueue].
+  Future<void> _flushTranscripts({bool force = false}) async {
+    if (state == null) return;
+    await _uploads.flush(
+      state!.id,
+      _uploadBatch,
+      force: force,
+      onResult: (Map<String, dynamic> result) {
+        // Screening results come inline when there's no live stream
+        final Map<String, dynamic>? screening =
+            result['screening'] as Map<String, dynamic>?;
+        if (screening != null) {
+          _handleScreeningResult(screening);
+        }
+        final Object? quota = result['quota_exceeded'];
+        if (quota is String) _notifyQuotaExceeded(quota);
+      },
+    );
+  }
 
-    // If we've failed too many times in a row, drop the queue
-    if (_flushFailures >= _maxFlushRetries) {
-      final int dropped = _pendingSegments.length;
-      _pendingSegments.clear();
-      _flushFailures = 0;
-      debugPrint(
-        '[MeetingNotifier] Dropped $dropped segments after '
-        '$_maxFlushRetries consecutive failures — backend unreachable',
-      );
-      return;
-    }
+  /// Tell the user once that AI screening stopped (the backend keeps
+  /// storing the transcript over quota — only LLM work is cut off).
+  void _notifyQuotaExceeded(String reason) {
+    if (_quotaNotified || state == null) return;
+    _quotaNotified = true;
+    debugPrint('[MeetingNotifier] $reason');
+    state = state!.copyWith(
+      copilotMessages: [
+        ...state!.copilotMessages,
+        CopilotMessage(
+          text: '$reason. Live insights are paused; '
+              'the transcript is still being saved.',
+          sender: CopilotSender.error,
+          timestamp: DateTime.now(),
+        ),
+      ],
+    );
+  }
 
-    final List<Map<String, String>> batch = List<Map<String, String>>.from(
-      _pendingSegments,
+  Future<Map<String, dynamic>> _uploadBatch(
+    String meetingId,
+    List<Map<String, Object>> segments,
+    String language,
+  ) {
+    final MeetingApiService api = _ref.read(meetingApiProvider);
+    return api.sendTranscript(
+      meetingId: meetingId,
+      segments: segments,
+      language: language,
+      pushResults: LiveEventsService.instance.isConnected,
     );
-    _pendingSegments.clear();
+  }
 
-    try {
-      final MeetingApiService api = _ref.read(meetingApiProvider);
-      final String langCode =
-          UserPreferences.instance.transcriptionLanguage.code;
-      final Map<String, dynamic> result = await api.sendTranscript(
-        meetingId: state!.id,
-        segments: batch,
-        language: langCode,
-      );
+  /// Late upload for a meeting that has ended: stored, not screened.
+  Future<Map<String, dynamic>> _uploadOrphan(
+    String meetingId,
+    List<Map<String, Object>> segments,
+    String language,
+  ) {
+    final MeetingApiService api = _ref.read(meetingApiProvider);
+    return api.sendTranscript(
+      meetingId: meetingId,
+      segments: segments,
+      language: language,
+      persistOnly: true,
+    );
+  }
 
-      // Success — reset failure counter
-      _flushFailures = 0;
+  /// Subscribe to pushed screening results and summary progress.
+  void _listenToLiveEvents() {
+    final LiveEventsService live = LiveEventsService.instance;
+    _liveSub?.cancel();
+    _liveSub = live.events.listen(_handleLiveEvent);
+    live.connect();
+  }
 
-      // Process screening results if returned
-      final Map<String, dynamic>? screening =
-          result['screening'] as Map<String, dynamic>?;
-      if (screening != null) {
-        _handleScreeningResult(screening);
-      }
-    } on ApiException catch (e) {
-      // Permanent errors: don't re-queue, just drop
-      if (e.statusCode == 401 || e.statusCode == 403 || e.statusCode == 404) {
-        _flushFailures++;
-        debugPrint(
-          '[MeetingNotifier] Transcript flush ${e.statusCode} '
-          '(failure $_flushFailures/$_maxFlushRetries) — '
-          '${_flushFailures >= _maxFlushRetries ? "will drop queue" : "will retry"}',
-        );
-        // Re-queue for retry if under limit
-        if (_flushFailures < _maxFlushRetries) {
-          _pendingSegments.insertAll(0, batch);
-        }
-      } else {
-        // Transient errors (500, timeout): re-queue
-        _flushFailures++;
-        _pendingSegments.insertAll(0, batch);
-        debugPrint('[MeetingNotifier] Transcript flush transient error: $e');
-      }
-    } catch (e) {
-      // Network errors etc: re-queue with limit
-      _flushFailures++;
-      if (_flushFailures < _maxFlushRetries) {
-        _pendingSegments.insertAll(0, batch);
-      }
-      debugPrint('[MeetingNotifier] Transcript flush failed: $e');
+  /// Route a pushed event for the current meeting.
+  void _handleLiveEvent(LiveEvent event) {
+    if (state == null || event.meetingId != state!.id) return;
+
+    switch (event.type) {
+      case 'screening':
+        // Carries the analysis too — the separate 'insight' event is for
+        // listeners that only care about insights.
+        _handleScreeningResult(event.data);
+      case 'summary_progress':
+        state = state!.copyWith(isSummaryLoading: true);
+      case 'summary':
+        _handleSummaryResult(event.data);
     }
   }
 
-  /// Handle screening result from REST response.
+  /// Handle screening result from a REST response or a pushed event.
   void _handleScreeningResult(Map<String, dynamic> data) {
     if (state == null) return;
 
@@ -372,11 +414,8 @@ class MeetingNotifier extends StateNotifier<MeetingSession?> {
     } catch (e) {
       debugPrint('[MeetingNotifier] Copilot failed: $e');
       if (state != null) {
-        final String errorText = e is ApiException
-            ? 'Server error (${e.statusCode}). Try again.'
-            : 'Connection error. Check your network.';
         final CopilotMessage errorMsg = CopilotMessage(
-          text: errorText,
+          text: _errorText(e),
           sender: CopilotSender.error,
           timestamp: DateTime.now(),
         );
@@ -391,7 +430,7 @@ class MeetingNotifier extends StateNotifier<MeetingSession?> {
   /// Request a meeting summary from the backend via REST.
   Future<void> requestSummary() async {
     if (state == null) return;
-    state = state!.copyWith(isSummaryLoading: true);
+    state = state!.copyWith(isSummaryLoading: true, clearSummaryError: true);
 
     try {
       final MeetingApiService api = _ref.read(meetingApiProvider);
@@ -407,35 +446,48 @@ class MeetingNotifier extends StateNotifier<MeetingSession?> {
         language: langCode,
       );
 
-      final bool isError = response['error'] as bool? ?? false;
-      final Map<String, dynamic>? summaryData =
-          response['summary'] as Map<String, dynamic>?;
-
-      if (isError || summaryData == null) {
-        debugPrint('[MeetingNotifier] Summary error');
-        if (state != null) {
-          state = state!.copyWith(isSummaryLoading: false);
-        }
-        return;
-      }
-
-      final MeetingSummary summary = MeetingSummary.fromJson(
-        summaryData.map((String k, dynamic v) => MapEntry(k, v as Object?)),
-      );
+      _handleSummaryResult(response);
+    } catch (e) {
+      debugPrint('[MeetingNotifier] Summary failed: $e');
       if (state != null) {
         state = state!.copyWith(
-          meetingSummary: summary,
           isSummaryLoading: false,
+          summaryError: _errorText(e),
         );
       }
-    } catch (e) {
-      debugPrint('[MeetingNotifier] Summary failed: $e');
-      if (state != null) {
-        state = state!.copyWith(isSummaryLoading: false);
-      }
     }
   }
 
+  /// User-facing text for a failed copilot or summary request.
+  static String _errorText(Object e) => e is ApiException
+      ? e.statusCode == 402
+          ? 'Monthly AI quota reached.'
+          : 'Server error (${e.statusCode}). Try again.'
+      : 'Connection error. Check your network.';
+
+  /// Handle a summary from a REST response or a pushed event.
+  void _handleSummaryResult(Map<String, dynamic> response) {
+    if (state == null) return;
+
+    final bool isError = response['error'] as bool? ?? false;
+    final Map<String, dynamic>? summaryData =
+        response['summary'] as Map<String, dynamic>?;
+
+    if (isError || summaryData == null) {
+      debugPrint('[MeetingNotifier] Summary error');
+      state = state!.copyWith(isSummaryLoading: false);
+      return;
+    }
+
+    final MeetingSummary summary = MeetingSummary.fromJson(
+      summaryData.map((String k, dynamic v) => MapEntry(k, v as Object?)),
+    );
+    state = state!.copyWith(
+      meetingSummary: summary,
+      isSummaryLoading: false,
+    );
+  }
+
   /// Listen to Apple STT transcript stream.
   void _listenToStt() {
     final SttService stt = _ref.read(sttProvider);
@@ -475,6 +527,8 @@ class MeetingNotifier extends StateNotifier<MeetingSession?> {
     _transcriptBatchTimer?.cancel();
     _partialClearTimer?.cancel();
     _sttSub?.cancel();
+    _liveSub?.cancel();
+    LiveEventsService.instance.disconnect();
     super.dispose();
   }
 }
@@ -0,0 +1,191 @@
+import 'dart:async';
+import 'dart:convert';
+
+import 'package:flutter/foundation.dart';
+import 'package:http/http.dart' as http;
+import 'package:meetmind/services/auth_service.dart';
+import 'package:meetmind/services/meeting_api_service.dart';
+
+/// A server-pushed event from the live events stream.
+class LiveEvent {
+  /// Create a live event.
+  const LiveEvent({required this.type, required this.data, this.id});
+
+  /// Event ID (used to resume after a reconnect).
+  final String? id;
+
+  /// Event type: screening, insight, summary_progress, summary, action_item.
+  final String type;
+
+  /// Decoded JSON payload.
+  final Map<String, dynamic> data;
+
+  /// Meeting the event belongs to (null for account-wide events).
+  String? get meetingId => data['meeting_id'] as String?;
+}
+
+/// Singleton Server-Sent Events client for `/api/events`.
+///
+/// One connection per device carries every meeting's screening results,
+/// insights, summary progress, and action-item updates as soon as the
+/// backend produces them — no waiting for the next transcript flush.
+/// Reconnects with exponential backoff and resumes with `Last-Event-ID`.
+class LiveEventsService {
+  LiveEventsService._();
+  static final LiveEventsService instance = LiveEventsService._();
+
+  static const Duration _maxBackoff = Duration(seconds: 30);
+
+  final StreamController<LiveEvent> _controller =
+      StreamController<LiveEvent>.broadcast();
+
+  http.Client? _client;
+  StreamSubscription<String>? _lines;
+  Timer? _reconnectTimer;
+  String? _lastEventId;
+  int _attempt = 0;
+  bool _active = false;
+  bool _connected = false;
+
+  /// Stream of live events (broadcast).
+  Stream<LiveEvent> get events => _controller.stream;
+
+  /// Whether the service is connected or trying to reconnect.
+  bool get isActive => _active;
+
+  /// Whether the stream is open right now (events pushed now arrive).
+  bool get isConnected => _connected;
+
+  /// Open the stream (no-op if already open).
+  void connect() {
+    if (_active) return;
+    _active = true;
+    _attempt = 0;
+    unawaited(_open());
+  }
+
+  /// Close the stream and stop reconnecting.
+  void disconnect() {
+    _active = false;
+    _connected = false;
+    _reconnectTimer?.cancel();
+    _lines?.cancel();
+    _lines = null;
+    _client?.close();
+    _client = null;
+  }
+
+  Future<void> _open() async {
+    final String? token = AuthService.instance.accessToken;
+    if (!_active || token == null) {
+      _active = false;
+      return;
+    }
+
+    final http.Client client = http.Client();
+    _client = client;
+    final http.Request request = http.Request(
+      'GET',
+      Uri.parse('${MeetingApiService().baseUrl}/api/events'),
+    );
+    request.headers['Accept'] = 'text/event-stream';
+    request.headers['Authorization'] = 'Bearer $token';
+    if (_lastEventId != null) {
+      request.headers['Last-Event-ID'] = _lastEventId!;
+    }
+
+    try {
+      final http.StreamedResponse response = await client.send(request);
+      if (response.statusCode != 200) {
+        debugPrint('[LiveEvents] Connect failed: ${response.statusCode}');
+        // Auth errors won't fix themselves — stop until connect() again
+        if (response.statusCode == 401 || response.statusCode == 403) {
+          disconnect();
+          return;
+        }
+        _scheduleReconnect();
+        return;
+      }
+
+      _attempt = 0;
+      _connected = true;
+      _lines = response.stream
+          .transform(utf8.decoder)
+          .transform(const LineSplitter())
+          .listen(
+            _onLine,
+            onDone: _scheduleReconnect,
+            onError: (Object e) {
+              debugPrint('[LiveEvents] Stream error: $e');
+              _scheduleReconnect();
+            },
+            cancelOnError: true,
+          );
+    } catch (e) {
+      debugPrint('[LiveEvents] Connect error: $e');
+      _scheduleReconnect();
+    }
+  }
+
+  // SSE frame being assembled
+  String? _id;
+  String _type = 'message';
+  final StringBuffer _data = StringBuffer();
+
+  void _onLine(String line) {
+    if (line.isEmpty) {
+      _dispatch();
+      return;
+    }
+    if (line.startsWith(':')) return; // heartbeat comment
+
+    final int colon = line.indexOf(':');
+    final String field = colon < 0 ? line : line.substring(0, colon);
+    String value = colon < 0 ? '' : line.substring(colon + 1);
+    if (value.startsWith(' ')) value = value.substring(1);
+
+    switch (field) {
+      case 'id':
+        _id = value;
+      case 'event':
+        _type = value;
+      case 'data':
+        if (_data.isNotEmpty) _data.write('\n');
+        _data.write(value);
+    }
+  }
+
+  void _dispatch() {
+    if (_data.isNotEmpty) {
+      try {
+        final Object? decoded = jsonDecode(_data.toString());
+        if (decoded is Map<String, dynamic>) {
+          _controller.add(LiveEvent(id: _id, type: _type, data: decoded));
+        }
+      } catch (e) {
+        debugPrint('[LiveEvents] Bad event payload: $e');
+      }
+    }
+    if (_id != null) _lastEventId = _id;
+    _id = null;
+    _type = 'message';
+    _data.clear();
+  }
+
+  void _scheduleReconnect() {
+    _connected = false;
+    _lines?.cancel();
+    _lines = null;
+    _client?.close();
+    _client = null;
+    if (!_active) return;
+
+    final int seconds = 1 << _attempt.clamp(0, 5);
+    final Duration delay = Duration(seconds: seconds) > _maxBackoff
+        ? _maxBackoff
+        : Duration(seconds: seconds);
+    _attempt++;
+    _reconnectTimer?.cancel();
+    _reconnectTimer = Timer(delay, () => unawaited(_open()));
+  }
+}
@@ -1,8 +1,13 @@
 import 'dart:convert';
+import 'dart:io' show gzip;
+import 'dart:typed_data';
 
+import 'package:flutter/foundation.dart';
 import 'package:http/http.dart' as http;
 import 'package:meetmind/config/app_config.dart';
 import 'package:meetmind/services/auth_service.dart';
+import 'package:meetmind/services/transcript_codec.dart';
+import 'package:uuid/uuid.dart';
 
 /// REST API service for meeting history and stats.
 ///
@@ -18,6 +23,22 @@ class MeetingApiService {
 
   final http.Client _client;
 
+  /// Whether the server accepts binary transcript batches.
+  bool _binaryIngest = true;
+
+  /// Whether the server accepts gzip-encoded request bodies.
+  bool _gzipRequests = true;
+
+  /// JSON request bodies at least this large are sent gzip-compressed.
+  static const int _gzipMinBytes = 1024;
+
+  /// Identifies this app run to the backend's per-device clock estimate.
+  final String _deviceId = const Uuid().v4();
+
+  /// Last transcript round trip (`t0,t1,t2,t3` in epoch ms), echoed on the
+  /// next request so the backend can estimate this device's clock offset.
+  String? _lastClockExchange;
+
   /// Base URL for the REST API.
   ///
   /// Omits port when it's the default for the scheme (443 for HTTPS, 80 for HTTP)
@@ -32,6 +53,9 @@ class MeetingApiService {
         : '$protocol://${config.host}:${config.port}';
   }
 
+  /// Base URL for the REST API (shared with the live events stream).
+  String get baseUrl => _baseUrl;
+
   /// Default request headers (includes auth token when available).
   Map<String, String> get _headers {
     final headers = <String, String>{
@@ -68,6 +92,44 @@ class MeetingApiService {
     return await _get('/api/meetings/$meetingId');
   }
 
+  /// Get a meeting only if it changed since the version tagged [etag].
+  ///
+  /// Returns null when the server answers 304 Not Modified, otherwise the
+  /// meeting and its new ETag. Throws [ApiException] on failure.
+  Future<({Map<String, dynamic> meeting, String? etag})?> getMeetingIfChanged(
+    String meetingId, {
+    String? etag,
+  }) async {
+    final uri = Uri.parse('$_baseUrl/api/meetings/$meetingId');
+    final headers = {..._headers, if (etag != null) 'If-None-Match': etag};
+    final response = await _client
+        .get(uri, headers: headers)
+        .timeout(const Duration(seconds: 30));
+
+    if (response.statusCode == 304) return null;
+    if (response.statusCode == 200) {
+      return (
+        meeting: jsonDecode(response.body) as Map<String, dynamic>,
+        etag: response.headers['etag'],
+      );
+    }
+    throw ApiException('GET meeting failed', response.statusCode);
+  }
+
+  /// Get meeting list changes since the [since] cursor (0 = snapshot).
+  ///
+  /// Returns `{cursor, meetings, deleted, has_more}`; snapshot pages add
+  /// `after`, sent back as [after] (with their cursor) for the next page.
+  Future<Map<String, dynamic>> syncMeetings({
+    int since = 0,
+    int limit = 200,
+    String? after,
+  }) async {
+    final String page =
+        after == null ? '' : '&after=${Uri.encodeQueryComponent(after)}';
+    return await _get('/api/meetings/sync?since=$since&limit=$limit$page');
+  }
+
   /// Delete a meeting and all related data.
   ///
   /// Returns true if deleted successfully.
@@ -84,6 +146,30 @@ class MeetingApiService {
     throw ApiException('Failed to delete meeting', response.statusCode);
   }
 
+  /// Download the server-rendered PDF report for a meeting.
+  ///
+  /// The backend streams pages as they are laid out, so long meetings
+  /// export without rendering on the device. Set [fullExport] to false
+  /// to omit AI insights and the transcript appendix.
+  /// Throws [ApiException] if not found or on failure.
+  Future<Uint8List> downloadReportPdf(
+    String meetingId, {
+    bool fullExport = true,
+  }) async {
+    final uri = Uri.parse(
+      '$_baseUrl/api/meetings/$meetingId/report.pdf?full=$fullExport',
+    );
+    final headers = {..._headers, 'Accept': 'application/pdf'};
+    final response = await _client
+        .get(uri, headers: headers)
+        .timeout(const Duration(seconds: 60));
+
+    if (response.statusCode == 200) {
+      return response.bodyBytes;
+    }
+    throw ApiException('Failed to download report', response.statusCode);
+  }
+
   // ─── Action Items ─────────────────────────────────────────────
 
   /// Get all pending action items across meetings.
@@ -152,16 +238,94 @@ class MeetingApiService {
 
   /// Send transcript segments to backend for AI screening.
   ///
+  /// Uses the compact binary batch format ([TranscriptCodec]); falls back
+  /// to JSON for the rest of the session if the server doesn't support it.
   /// Returns screening/analysis results if triggered.
+  ///
+  /// [persistOnly] stores the segments without screening — for uploads
+  /// left over from a meeting that has already ended. Resending a segment
+  /// (same `id`) is harmless: the backend keeps the first copy.
+  ///
+  /// [pushResults] tells the backend this device reads the live event
+  /// stream, so screening results are pushed there instead of held back
+  /// for this response.
   Future<Map<String, dynamic>> sendTranscript({
     required String meetingId,
-    required List<Map<String, String>> segments,
+    required List<Map<String, Object>> segments,
     String language = 'es',
+    bool persistOnly = false,
+    bool pushResults = false,
   }) async {
-    return await _post('/api/meetings/$meetingId/transcript', {
-      'segments': segments,
-      'language': language,
-    });
+    final String query = persistOnly ? '?persist_only=true' : '';
+    final int sentAt = DateTime.now().millisecondsSinceEpoch;
+    final Map<String, String> traceHeaders = <String, String>{
+      'X-Device-Id': _deviceId,
+      'X-Trace-Sent-At': '$sentAt',
+      if (_lastClockExchange != null) 'X-Trace-Clock': _lastClockExchange!,
+      if (pushResults) 'X-Live-Events': '1',
+    };
+
+    Map<String, dynamic>? result;
+    if (_binaryIngest) {
+      final uri = Uri.parse(
+        '$_baseUrl/api/meetings/$meetingId/transcript/binary$query',
+      );
+      final headers = {
+        ..._headers,
+        ...traceHeaders,
+        'Content-Type': TranscriptCodec.contentType,
+      };
+      final response = await _client
+          .post(
+            uri,
+            headers: headers,
+            body: TranscriptCodec.encode(segments, language: language),
+          )
+          .timeout(const Duration(seconds: 60));
+
+      if (response.statusCode == 200) {
+        result = jsonDecode(response.body) as Map<String, dynamic>;
+      } else if (response.statusCode == 415 || _isMissingRoute(response)) {
+        // Older backend without the binary route — switch to JSON
+        _binaryIngest = false;
+      } else {
+        throw ApiException('POST transcript failed', response.statusCode);
+      }
+    }
+    result ??= await _post(
+      '/api/meetings/$meetingId/transcript$query',
+      {'segments': segments, 'language': language},
+      extraHeaders: traceHeaders,
+    );
+    _recordClockExchange(sentAt, result['trace']);
+    return result;
+  }
+
+  /// Whether a 404 means the route doesn't exist, as opposed to an
+  /// application 404 such as "Meeting not found".
+  ///
+  /// An unmatched route answers with no JSON `detail` (a proxy page) or
+  /// with the framework's generic "Not Found".
+  static bool _isMissingRoute(http.Response response) {
+    if (response.statusCode != 404) return false;
+    try {
+      final Object? body = jsonDecode(response.body);
+      final Object? detail =
+          body is Map<String, dynamic> ? body['detail'] : null;
+      return detail == null || detail == 'Not Found';
+    } on FormatException {
+      return true;
+    }
+  }
+
+  /// Remember the server's receive/respond times for the next request.
+  void _recordClockExchange(int sentAt, Object? trace) {
+    if (trace is! Map<String, dynamic>) return;
+    final Object? received = trace['received_at'];
+    final Object? responded = trace['responded_at'];
+    if (received is! num || responded is! num) return;
+    final int receivedBack = DateTime.now().millisecondsSinceEpoch;
+    _lastClockExchange = '$sentAt,$received,$responded,$receivedBack';
   }
 
   /// Ask the AI copilot a question about the meeting.
@@ -210,13 +374,38 @@ class MeetingApiService {
   /// Perform a POST request and parse JSON response.
   Future<Map<String, dynamic>> _post(
     String path,
-    Map<String, dynamic> body,
-  ) async {
+    Map<String, dynamic> body, {
+    Map<String, String> extraHeaders = const <String, String>{},
+  }) async {
     final uri = Uri.parse('$_baseUrl$path');
-    final response = await _client
-        .post(uri, headers: _headers, body: jsonEncode(body))
+    final Uint8List json = utf8.encode(jsonEncode(body));
+    http.Response response;
+
+    // Copilot questions and summaries carry the whole transcript —
+    // compress them (responses are already gzip-decoded by dart:io).
+    if (_gzipRequests && !kIsWeb && json.length >= _gzipMinBytes) {
+      final headers = {
+        ..._headers,
+        ...extraHeaders,
+        'Content-Encoding': 'gzip',
+      };
+      response = await _client
+          .post(uri, headers: headers, body: gzip.encode(json))
+          .timeout(const Duration(seconds: 60));
+      if (response.statusCode != 415) {
+        return _decodePost(path, response);
+      }
+      // Server doesn't decode request bodies — send plain from now on
+      _gzipRequests = false;
+    }
+
+    response = await _client
+        .post(uri, headers: {..._headers, ...extraHeaders}, body: json)
         .timeout(const Duration(seconds: 60));
+    return _decodePost(path, response);
+  }
 
+  Map<String, dynamic> _decodePost(String path, http.Response response) {
     if (response.statusCode == 200) {
       return jsonDecode(response.body) as Map<String, dynamic>;
     }
@@ -1,6 +1,8 @@
 import 'dart:typed_data';
 
+import 'package:flutter/foundation.dart';
 import 'package:intl/intl.dart';
+import 'package:meetmind/services/meeting_api_service.dart';
 import 'package:pdf/pdf.dart';
 import 'package:pdf/widgets.dart' as pw;
 import 'package:printing/printing.dart';
@@ -140,12 +142,19 @@ class MeetingPdfService {
     return pdf.save();
   }
 
-  /// Share the generated PDF via native share sheet.
+  /// Share the meeting PDF via native share sheet.
+  ///
+  /// Prefers the report streamed by the backend, which keeps long
+  /// meetings off the UI isolate; falls back to on-device rendering when
+  /// the meeting is not synced, the server is unreachable, or the server
+  /// refuses it (422: text in a script its built-in fonts lack — the
+  /// on-device renderer embeds Inter and handles it).
   Future<void> sharePdf(
     Map<String, dynamic> meeting, {
     bool fullExport = true,
   }) async {
-    final bytes = await generatePdf(meeting, fullExport: fullExport);
+    final bytes = await _serverPdf(meeting, fullExport: fullExport) ??
+        await generatePdf(meeting, fullExport: fullExport);
     final title = meeting['title'] as String? ?? 'Meeting';
     final safeName = title
         .replaceAll(RegExp(r'[^\w\s-]'), '')
@@ -158,6 +167,24 @@ class MeetingPdfService {
     );
   }
 
+  /// Download the server-rendered report, or null if unavailable.
+  Future<Uint8List?> _serverPdf(
+    Map<String, dynamic> meeting, {
+    required bool fullExport,
+  }) async {
+    final meetingId = meeting['id'] as String?;
+    if (meetingId == null) return null;
+    try {
+      return await MeetingApiService().downloadReportPdf(
+        meetingId,
+        fullExport: fullExport,
+      );
+    } catch (e) {
+      debugPrint('[MeetingPdfService] Server PDF unavailable: $e');
+      return null;
+    }
+  }
+
   // ═══════════════════════════════════════════════════════════════════
   //  HEADER & FOOTER
   // ═══════════════════════════════════════════════════════════════════
@@ -0,0 +1,211 @@
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:flutter/foundation.dart';
+import 'package:meetmind/services/auth_service.dart';
+import 'package:meetmind/services/meeting_api_service.dart';
+import 'package:path_provider/path_provider.dart';
+
+/// Local cache of the meeting history, kept current by delta sync.
+///
+/// The list is stored with the server's sync cursor, so reopening History
+/// only asks `/api/meetings/sync` for what changed (usually nothing).
+/// Meeting details are stored with their ETag and revalidated with
+/// `If-None-Match`; unchanged meetings cost a 304 and no download.
+///
+/// Files live under the app support directory, one folder per user:
+/// `meetings_<userId>/index.json` plus `<meetingId>.json` per detail.
+class MeetingStore {
+  MeetingStore._();
+  static final MeetingStore instance = MeetingStore._();
+
+  Directory? _dir;
+  String? _dirUser;
+  int _cursor = 0;
+  final Map<String, Map<String, dynamic>> _meetings =
+      <String, Map<String, dynamic>>{};
+
+  /// Cached meetings, most recent first (empty before the first sync).
+  Future<List<Map<String, dynamic>>> cachedMeetings() async {
+    try {
+      await _load();
+    } catch (e) {
+      debugPrint('[MeetingStore] Cache unavailable: $e');
+    }
+    return _sorted();
+  }
+
+  /// Apply server changes since the stored cursor and return the list.
+  ///
+  /// Throws [ApiException] (or a network error) if the sync fails; the
+  /// cached list is left untouched in that case.
+  Future<List<Map<String, dynamic>>> sync(MeetingApiService api) async {
+    final Directory? dir = await _load();
+    int since = _cursor;
+    String? after;
+    // A full snapshot is collected apart and replaces the list at the end
+    final Map<String, Map<String, dynamic>>? snapshot =
+        since == 0 ? <String, Map<String, dynamic>>{} : null;
+    bool hasMore = true;
+    while (hasMore) {
+      final Map<String, dynamic> page = await api.syncMeetings(
+        since: since,
+        after: after,
+      );
+      final Map<String, Map<String, dynamic>> target = snapshot ?? _meetings;
+      for (final dynamic m in page['meetings'] as List<dynamic>) {
+        final Map<String, dynamic> meeting = m as Map<String, dynamic>;
+        target[meeting['id'] as String] = meeting;
+      }
+      for (final dynamic id in page['deleted'] as List<dynamic>) {
+        _meetings.remove(id);
+        await _deleteDetail(dir, id as String);
+      }
+      final int next = (page['cursor'] as num).toInt();
+      if (snapshot != null) {
+        // Snapshot pages all carry the cursor read before the first one
+        after = page['after'] as String?;
+        hasMore = page['has_more'] == true && after != null;
+      } else {
+        hasMore = page['has_more'] == true && next > since;
+      }
+      since = next;
+    }
+    if (snapshot != null) {
+      _meetings
+        ..clear()
+        ..addAll(snapshot);
+    }
+    _cursor = since;
+    await _saveIndex(dir);
+    return _sorted();
+  }
+
+  /// Get a meeting's details, downloading only if it changed.
+  ///
+  /// Falls back to the cached copy when offline.
+  Future<Map<String, dynamic>> meeting(
+    MeetingApiService api,
+    String meetingId,
+  ) async {
+    final Directory? dir = await _load();
+    final Map<String, dynamic>? cached = await _readDetail(dir, meetingId);
+
+    try {
+      final result = await api.getMeetingIfChanged(
+        meetingId,
+        etag: cached?['etag'] as String?,
+      );
+      if (result == null) {
+        return cached!['meeting'] as Map<String, dynamic>;
+      }
+      await _writeDetail(dir, meetingId, result.meeting, result.etag);
+      return result.meeting;
+    } on ApiException {
+      rethrow;
+    } catch (e) {
+      if (cached == null) rethrow;
+      debugPrint('[MeetingStore] Offline — showing cached $meetingId: $e');
+      return cached['meeting'] as Map<String, dynamic>;
+    }
+  }
+
+  /// Drop a meeting locally (after the user deleted it).
+  Future<void> remove(String meetingId) async {
+    final Directory? dir = await _load();
+    _meetings.remove(meetingId);
+    await _deleteDetail(dir, meetingId);
+    await _saveIndex(dir);
+  }
+
+  // ─── Internal ─────────────────────────────────────────────────
+
+  List<Map<String, dynamic>> _sorted() {
+    final List<Map<String, dynamic>> list = _meetings.values.toList();
+    list.sort((a, b) => _startedAt(b).compareTo(_startedAt(a)));
+    return list;
+  }
+
+  static DateTime _startedAt(Map<String, dynamic> m) =>
+      DateTime.tryParse(m['started_at'] as String? ?? '') ??
+      DateTime.fromMillisecondsSinceEpoch(0);
+
+  /// Open the current user's folder, reloading the index on user change.
+  Future<Directory?> _load() async {
+    final String? userId = AuthService.instance.user?['id'] as String?;
+    if (kIsWeb || userId == null) return null;
+    if (_dir != null && _dirUser == userId) return _dir;
+
+    final Directory base = await getApplicationSupportDirectory();
+    final Directory dir = Directory('${base.path}/meetings_$userId');
+    await dir.create(recursive: true);
+    _dir = dir;
+    _dirUser = userId;
+    _cursor = 0;
+    _meetings.clear();
+
+    final File index = File('${dir.path}/index.json');
+    if (await index.exists()) {
+      try {
+        final Map<String, dynamic> data =
+            jsonDecode(await index.readAsString()) as Map<String, dynamic>;
+        _cursor = (data['cursor'] as num?)?.toInt() ?? 0;
+        for (final dynamic m in data['meetings'] as List<dynamic>? ?? []) {
+          final Map<String, dynamic> meeting = m as Map<String, dynamic>;
+          _meetings[meeting['id'] as String] = meeting;
+        }
+      } catch (e) {
+        debugPrint('[MeetingStore] Corrupt index, resyncing: $e');
+        _cursor = 0;
+        _meetings.clear();
+      }
+    }
+    return dir;
+  }
+
+  Future<void> _saveIndex(Directory? dir) async {
+    if (dir == null) return;
+    final File index = File('${dir.path}/index.json');
+    await index.writeAsString(
+      jsonEncode(<String, dynamic>{
+        'cursor': _cursor,
+        'meetings': _meetings.values.toList(),
+      }),
+    );
+  }
+
+  File _detailFile(Directory dir, String meetingId) =>
+      File('${dir.path}/${Uri.encodeComponent(meetingId)}.json');
+
+  Future<Map<String, dynamic>?> _readDetail(
+    Directory? dir,
+    String meetingId,
+  ) async {
+    if (dir == null) return null;
+    final File file = _detailFile(dir, meetingId);
+    if (!await file.exists()) return null;
+    try {
+      return jsonDecode(await file.readAsString()) as Map<String, dynamic>;
+    } catch (_) {
+      return null;
+    }
+  }
+
+  Future<void> _writeDetail(
+    Directory? dir,
+    String meetingId,
+    Map<String, dynamic> meeting,
+    String? etag,
+  ) async {
+    if (dir == null || etag == null) return;
+    await _detailFile(dir, meetingId).writeAsString(
+      jsonEncode(<String, dynamic>{'etag': etag, 'meeting': meeting}),
+    );
+  }
+
+  Future<void> _deleteDetail(Directory? dir, String meetingId) async {
+    if (dir == null) return;
+    final File file = _detailFile(dir, meetingId);
+    if (await file.exists()) await file.delete();
+  }
+}
@@ -16,6 +16,8 @@ import 'package:speech_to_text/speech_to_text.dart';
 ///   - Word-by-word ~100-200ms latency
 ///   - Auto language detection
 ///   - Continuous listening
+///   - Silence gating (VAD with pre-roll) on the SpeechAnalyzer engine —
+///     decoding runs only while someone is talking
 ///   - 30+ language support
 class SttService {
   SttService._();
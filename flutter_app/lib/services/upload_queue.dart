@@ -0,0 +1,339 @@
+import 'dart:convert';
+import 'dart:io';
+import 'dart:math';
+
+import 'package:flutter/foundation.dart';
+import 'package:meetmind/services/auth_service.dart';
+import 'package:meetmind/services/meeting_api_service.dart';
+import 'package:path_provider/path_provider.dart';
+
+/// Sends one batch of segments; returns the ingest response.
+typedef TranscriptUploader = Future<Map<String, dynamic>> Function(
+  String meetingId,
+  List<Map<String, Object>> segments,
+  String language,
+);
+
+/// Durable transcript upload queue — nothing is dropped while offline.
+///
+/// Every segment is appended to a per-meeting journal before it is
+/// queued, and an upload only acknowledges segments the backend accepted.
+/// A subway tunnel, a backend outage or an app kill leaves the segments
+/// on disk; the next flush (or the next app start, via [drainOrphans])
+/// sends them.
+///
+/// Uploads coalesce: a flush sends everything waiting (up to
+/// [maxBatchSegments] per request) once enough text has built up or the
+/// oldest segment has waited [maxHold], so a backlog after an outage goes
+/// out in a few large requests rather than one per tick. Failures back
+/// off exponentially with jitter instead of being counted toward a drop.
+///
+/// Journals live under the app support directory, one folder per user:
+/// `upload_queue_<userId>/<meetingId>.jsonl`, one JSON record per line:
+/// `{"t":"open","language":..}`, `{"t":"seg","seg":{..}}` and
+/// `{"t":"ack","n":<segments acknowledged so far>}`. A fully acknowledged
+/// journal is deleted. On web the queue is memory-only.
+class TranscriptUploadQueue {
+  TranscriptUploadQueue._() : _fixedDir = null;
+
+  /// A queue journaling into [dir] regardless of the signed-in user.
+  @visibleForTesting
+  TranscriptUploadQueue.inDirectory(Directory dir) : _fixedDir = dir;
+
+  static final TranscriptUploadQueue instance = TranscriptUploadQueue._();
+
+  /// Segments per request (the backend accepts up to 2000 per batch).
+  static const int maxBatchSegments = 500;
+
+  /// Send once this much text is waiting...
+  static const int minBatchChars = 120;
+
+  /// ...or once the oldest segment has waited this long.
+  static const Duration maxHold = Duration(seconds: 10);
+
+  static const Duration _minBackoff = Duration(seconds: 5);
+  static const Duration _maxBackoff = Duration(minutes: 2);
+
+  final Map<String, _Journal> _journals = <String, _Journal>{};
+  final Random _random = Random();
+  final Directory? _fixedDir;
+  Directory? _dir;
+  String? _dirUser;
+
+  /// Start journaling a meeting.
+  Future<void> open(String meetingId, {required String language}) async {
+    final _Journal journal = _journals.putIfAbsent(
+      meetingId,
+      () => _Journal(meetingId, language),
+    );
+    journal.file ??= await _file(meetingId);
+  }
+
+  /// Persist a segment and queue it for upload.
+  ///
+  /// The segment is queued immediately; the returned future completes
+  /// once it is on disk (writes to a journal run in order).
+  Future<void> add(String meetingId, Map<String, Object> segment) {
+    final _Journal? journal = _journals[meetingId];
+    if (journal == null) return Future<void>.value();
+    journal.pending.add(segment);
+    journal.pendingChars += (segment['text'] as String? ?? '').length;
+    journal.oldestAt ??= DateTime.now();
+    return journal.write(<String, Object>{'t': 'seg', 'seg': segment});
+  }
+
+  /// Segments waiting for the backend.
+  int pendingCount(String meetingId) =>
+      _journals[meetingId]?.pending.length ?? 0;
+
+  /// Upload what's waiting for a meeting, if it's time.
+  ///
+  /// [force] ignores coalescing and backoff (used when the meeting ends).
+  /// [onResult] gets each ingest response (inline screening results).
+  Future<void> flush(
+    String meetingId,
+    TranscriptUploader upload, {
+    bool force = false,
+    void Function(Map<String, dynamic> result)? onResult,
+  }) async {
+    final _Journal? journal = _journals[meetingId];
+    if (journal == null || journal.pending.isEmpty || journal.uploading) {
+      return;
+    }
+    final DateTime now = DateTime.now();
+    if (!force) {
+      if (now.isBefore(journal.retryAt)) return;
+      final bool held = now.difference(journal.oldestAt ?? now) < maxHold;
+      if (journal.pendingChars < minBatchChars && held) return;
+    }
+
+    journal.uploading = true;
+    try {
+      while (journal.pending.isNotEmpty) {
+        final List<Map<String, Object>> batch = journal.pending
+            .take(maxBatchSegments)
+            .toList(growable: false);
+        try {
+          final Map<String, dynamic> result = await upload(
+            meetingId,
+            batch,
+            journal.language,
+          );
+          journal.failures = 0;
+          journal.retryAt = DateTime.fromMillisecondsSinceEpoch(0);
+          await _acknowledge(journal, batch.length);
+          onResult?.call(result);
+        } on ApiException catch (e) {
+          if (!_isRejected(e.statusCode)) rethrow;
+          // The backend will never accept this batch — don't let it
+          // block everything after it. A 404 means the meeting itself is
+          // gone (deleted, or not this user's), so nothing queued for it
+          // will ever be accepted.
+          final int dropped =
+              e.statusCode == 404 ? journal.pending.length : batch.length;
+          debugPrint(
+            '[UploadQueue] $dropped segments rejected '
+            '(${e.statusCode}) — dropping them',
+          );
+          await _acknowledge(journal, dropped);
+        }
+      }
+    } catch (e) {
+      journal.failures++;
+      final Duration delay = _backoff(journal.failures);
+      journal.retryAt = DateTime.now().add(delay);
+      debugPrint(
+        '[UploadQueue] Upload failed (${journal.pending.length} waiting, '
+        'retry in ${delay.inSeconds}s): $e',
+      );
+    } finally {
+      journal.uploading = false;
+    }
+  }
+
+  /// Stop tracking a meeting; unsent segments stay on disk for
+  /// [drainOrphans].
+  Future<void> close(String meetingId) async {
+    final _Journal? journal = _journals.remove(meetingId);
+    await journal?.writes;
+  }
+
+  /// Upload journals left behind by earlier runs (app killed or offline
+  /// when a meeting ended).
+  ///
+  /// Those meetings are over, so [upload] should only persist (see
+  /// `MeetingApiService.sendTranscript`'s `persistOnly`): a live ingest
+  /// would reopen the session and spend screening budget on it.
+  Future<void> drainOrphans(TranscriptUploader upload) async {
+    final Directory? dir = await _load();
+    if (dir == null) return;
+    await for (final FileSystemEntity entity in dir.list()) {
+      if (entity is! File || !entity.path.endsWith('.jsonl')) continue;
+      final String name = entity.uri.pathSegments.last;
+      final String meetingId = Uri.decodeComponent(
+        name.substring(0, name.length - '.jsonl'.length),
+      );
+      if (_journals.containsKey(meetingId)) continue;
+
+      final _Journal? journal = await _replay(meetingId, entity);
+      if (journal == null) continue;
+      _journals[meetingId] = journal;
+      debugPrint(
+        '[UploadQueue] Resending ${journal.pending.length} segments '
+        'for $meetingId',
+      );
+      await flush(meetingId, upload, force: true);
+      await close(meetingId);
+    }
+  }
+
+  // ─── Internal ─────────────────────────────────────────────────
+
+  /// 4xx that retrying can't fix (auth, quota and rate limits can).
+  static bool _isRejected(int status) =>
+      status == 400 || status == 404 || status == 413 || status == 422;
+
+  Duration _backoff(int failures) {
+    final int exp = min(failures - 1, 10);
+    final int ms = min(
+      _minBackoff.inMilliseconds * (1 << exp),
+      _maxBackoff.inMilliseconds,
+    );
+    // ±20% jitter so clients coming out of the same outage spread out
+    final double jitter = 0.8 + 0.4 * _random.nextDouble();
+    return Duration(milliseconds: (ms * jitter).round());
+  }
+
+  Future<void> _acknowledge(_Journal journal, int count) {
+    for (int i = 0; i < count; i++) {
+      final Map<String, Object> seg = journal.pending.removeAt(0);
+      journal.pendingChars -= (seg['text'] as String? ?? '').length;
+    }
+    if (journal.pending.isEmpty) {
+      journal
+        ..acked = 0
+        ..oldestAt = null;
+      return journal.delete();
+    }
+    journal
+      ..acked += count
+      ..oldestAt = DateTime.now();
+    return journal.write(<String, Object>{'t': 'ack', 'n': journal.acked});
+  }
+
+  /// Rebuild a journal from disk; null if it holds nothing to send.
+  Future<_Journal?> _replay(String meetingId, File file) async {
+    String language = 'es';
+    final List<Map<String, Object>> segments = <Map<String, Object>>[];
+    int acked = 0;
+    for (final String line in await file.readAsLines()) {
+      try {
+        final Map<String, dynamic> record =
+            jsonDecode(line) as Map<String, dynamic>;
+        switch (record['t']) {
+          case 'open':
+            language = record['language'] as String? ?? language;
+          case 'seg':
+            segments.add(
+              (record['seg'] as Map<String, dynamic>).cast<String, Object>(),
+            );
+          case 'ack':
+            acked = (record['n'] as num).toInt();
+        }
+      } catch (_) {
+        // Torn last line from a kill mid-write — the rest is intact
+      }
+    }
+    final _Journal journal = _Journal(meetingId, language)
+      ..file = file
+      ..headerWritten = true
+      ..acked = acked;
+    if (acked >= segments.length) {
+      await journal.delete();
+      return null;
+    }
+    for (final Map<String, Object> seg in segments.skip(acked)) {
+      journal.pending.add(seg);
+      journal.pendingChars += (seg['text'] as String? ?? '').length;
+    }
+    journal.oldestAt = DateTime.now();
+    return journal;
+  }
+
+  Future<File?> _file(String meetingId) async {
+    final Directory? dir = await _load();
+    if (dir == null) return null;
+    return File('${dir.path}/${Uri.encodeComponent(meetingId)}.jsonl');
+  }
+
+  /// The current user's queue folder (null on web or when signed out).
+  Future<Directory?> _load() async {
+    if (_fixedDir != null) return _fixedDir;
+    final String? userId = AuthService.instance.user?['id'] as String?;
+    if (kIsWeb || userId == null) return null;
+    if (_dir != null && _dirUser == userId) return _dir;
+
+    final Directory base = await getApplicationSupportDirectory();
+    final Directory dir = Directory('${base.path}/upload_queue_$userId');
+    await dir.create(recursive: true);
+    _dir = dir;
+    _dirUser = userId;
+    return dir;
+  }
+}
+
+/// One meeting's queue: pending segments mirrored by an append-only file.
+class _Journal {
+  _Journal(this.meetingId, this.language);
+
+  final String meetingId;
+  final String language;
+  final List<Map<String, Object>> pending = <Map<String, Object>>[];
+  File? file;
+  bool headerWritten = false;
+  int acked = 0;
+  int pendingChars = 0;
+  DateTime? oldestAt;
+  int failures = 0;
+  DateTime retryAt = DateTime.fromMillisecondsSinceEpoch(0);
+  bool uploading = false;
+
+  /// Tail of the write chain — file operations run strictly in order.
+  Future<void> writes = Future<void>.value();
+
+  Future<void> write(Map<String, Object> record) {
+    final File? target = file;
+    if (target == null) return writes; // memory-only (web)
+    writes = writes.then((_) async {
+      final StringBuffer lines = StringBuffer();
+      if (!headerWritten) {
+        lines.writeln(
+          jsonEncode(<String, Object>{'t': 'open', 'language': language}),
+        );
+        headerWritten = true;
+      }
+      lines.writeln(jsonEncode(record));
+      await target.writeAsString(
+        lines.toString(),
+        mode: FileMode.append,
+        flush: true,
+      );
+    }).catchError((Object e) {
+      debugPrint('[UploadQueue] Journal write failed for $meetingId: $e');
+    });
+    return writes;
+  }
+
+  /// Everything is acknowledged — start the next entry from a fresh file.
+  Future<void> delete() {
+    final File? target = file;
+    if (target == null) return writes;
+    writes = writes.then((_) async {
+      headerWritten = false;
+      if (await target.exists()) await target.delete();
+    }).catchError((Object e) {
+      debugPrint('[UploadQueue] Journal delete failed for $meetingId: $e');
+    });
+    return writes;
+  }
+}
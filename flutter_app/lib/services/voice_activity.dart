@@ -0,0 +1,141 @@
+import 'dart:math';
+import 'dart:typed_data';
+
+/// Energy-based voice activity gate for 16 kHz mono PCM16 audio.
+///
+/// Sits between the mic and the recognizer so decoding only runs while
+/// someone is talking: in a two-hour meeting that's mostly silence, CPU
+/// time then follows speech time, not meeting time.
+///
+/// Audio is judged in 20 ms frames against an adaptive noise floor. Speech
+/// opens the gate after [_openFrames] loud frames and closes it after
+/// [_hangoverFrames] quiet ones (so pauses between words don't cut an
+/// utterance). The last [_preRollFrames] frames before the gate opens are
+/// kept and sent first, so the start of the first word isn't clipped.
+///
+/// The floor keeps tracking while the gate is open, much more slowly
+/// ([_openTrackRate]), so sustained noise (a fan, traffic) is eventually
+/// absorbed into the floor and closes the gate instead of holding it open
+/// for the rest of the meeting.
+///
+/// `SpeechGate` in `SpeechAnalyzerPlugin.swift` runs the same frames,
+/// thresholds and rates over each tap buffer.
+class VoiceActivityGate {
+  VoiceActivityGate({
+    required this.onAudio,
+    this.onSpeechStart,
+    this.onSpeechEnd,
+  });
+
+  /// Samples per frame (20 ms at 16 kHz).
+  static const int frameSamples = 320;
+  static const int _frameBytes = frameSamples * 2;
+
+  /// Loud frames needed to open the gate (60 ms).
+  static const int _openFrames = 3;
+
+  /// Quiet frames that close it (800 ms).
+  static const int _hangoverFrames = 40;
+
+  /// Audio kept from before the gate opened (300 ms).
+  static const int _preRollFrames = 15;
+
+  /// Speech must be this many times the noise floor...
+  static const double _openRatio = 3.0;
+
+  /// ...and at least this loud (RMS, ≈ -44 dBFS).
+  static const double _minRms = 200;
+
+  /// Per-frame rate the floor rises at while the gate is open (≈ 20 s time
+  /// constant, so a long utterance barely moves it).
+  static const double _openTrackRate = 0.001;
+
+  /// Audio to recognize: speech plus pre-roll, one call per [add].
+  final void Function(Uint8List pcm) onAudio;
+  final void Function()? onSpeechStart;
+
+  /// Called once the utterance's audio has been passed to [onAudio].
+  final void Function()? onSpeechEnd;
+
+  bool _speech = false;
+  double _noiseFloor = 300;
+  int _loud = 0;
+  int _quiet = 0;
+  final List<Uint8List> _preRoll = <Uint8List>[];
+  final BytesBuilder _partial = BytesBuilder(copy: false);
+
+  /// Whether the gate is open.
+  bool get isSpeech => _speech;
+
+  /// Feed mic audio (any chunk size).
+  void add(Uint8List bytes) {
+    _partial.add(bytes);
+    if (_partial.length < _frameBytes) return;
+
+    final Uint8List buffered = _partial.takeBytes();
+    final int whole = buffered.length - buffered.length % _frameBytes;
+    if (whole < buffered.length) {
+      _partial.add(Uint8List.sublistView(buffered, whole));
+    }
+
+    final BytesBuilder out = BytesBuilder(copy: false);
+    for (int offset = 0; offset < whole; offset += _frameBytes) {
+      final Uint8List frame =
+          Uint8List.sublistView(buffered, offset, offset + _frameBytes);
+      final double rms = _rms(frame);
+      final bool loud = rms >= max(_minRms, _noiseFloor * _openRatio);
+
+      if (_speech) {
+        out.add(frame);
+        _noiseFloor +=
+            (rms - _noiseFloor) * (rms < _noiseFloor ? 0.2 : _openTrackRate);
+        _quiet = loud ? 0 : _quiet + 1;
+        if (_quiet >= _hangoverFrames) {
+          if (out.isNotEmpty) onAudio(out.takeBytes());
+          _speech = false;
+          _loud = 0;
+          onSpeechEnd?.call();
+        }
+        continue;
+      }
+
+      _preRoll.add(frame);
+      if (_preRoll.length > _preRollFrames) _preRoll.removeAt(0);
+      if (!loud) {
+        _loud = 0;
+        // Track the floor: down fast, up slowly (speech isn't noise)
+        _noiseFloor += (rms - _noiseFloor) * (rms < _noiseFloor ? 0.2 : 0.02);
+        continue;
+      }
+      if (++_loud >= _openFrames) {
+        _speech = true;
+        _quiet = 0;
+        onSpeechStart?.call();
+        for (final Uint8List pre in _preRoll) {
+          out.add(pre);
+        }
+        _preRoll.clear();
+      }
+    }
+    if (out.isNotEmpty) onAudio(out.takeBytes());
+  }
+
+  /// Forget everything (a new stream starts).
+  void reset() {
+    _speech = false;
+    _loud = 0;
+    _quiet = 0;
+    _preRoll.clear();
+    _partial.clear();
+  }
+
+  static double _rms(Uint8List frame) {
+    final ByteData data = ByteData.sublistView(frame);
+    double sum = 0;
+    for (int i = 0; i < frame.length; i += 2) {
+      final int s = data.getInt16(i, Endian.little);
+      sum += s * s;
+    }
+    return sqrt(sum / (frame.length ~/ 2));
+  }
+}
@@ -0,0 +1,114 @@
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:meetmind/services/meeting_api_service.dart';
+import 'package:meetmind/services/upload_queue.dart';
+
+void main() {
+  late Directory dir;
+
+  setUp(() {
+    dir = Directory.systemTemp.createTempSync('upload_queue_test');
+  });
+
+  tearDown(() {
+    if (dir.existsSync()) dir.deleteSync(recursive: true);
+  });
+
+  File journalOf(String meetingId) =>
+      File('${dir.path}/${Uri.encodeComponent(meetingId)}.jsonl');
+
+  Map<String, Object> seg(int id) => <String, Object>{
+        'id': id,
+        'text': 'segment $id',
+        'speaker': 'Ana',
+      };
+
+  test('replays a journal with a torn last line from the last ack', () async {
+    final String lines = <Map<String, Object>>[
+      <String, Object>{'t': 'open', 'language': 'en'},
+      <String, Object>{'t': 'seg', 'seg': seg(1)},
+      <String, Object>{'t': 'seg', 'seg': seg(2)},
+      <String, Object>{'t': 'ack', 'n': 1},
+      <String, Object>{'t': 'seg', 'seg': seg(3)},
+    ].map(jsonEncode).join('\n');
+    // Killed mid-write: the last record is cut off, no newline
+    journalOf('m-1').writeAsStringSync('$lines\n{"t":"seg","seg":{"id":4,"te');
+
+    final List<Object?> sent = <Object?>[];
+    String? language;
+    await TranscriptUploadQueue.inDirectory(dir).drainOrphans((
+      String meetingId,
+      List<Map<String, Object>> segments,
+      String lang,
+    ) async {
+      sent.addAll(segments.map((Map<String, Object> s) => s['id']));
+      language = lang;
+      return <String, dynamic>{};
+    });
+
+    expect(sent, <Object?>[2, 3]);
+    expect(language, 'en');
+    expect(journalOf('m-1').existsSync(), isFalse);
+  });
+
+  test('acknowledged segments are not sent again after a restart', () async {
+    final TranscriptUploadQueue queue = TranscriptUploadQueue.inDirectory(dir);
+    await queue.open('m-1', language: 'es');
+    for (int id = 1; id <= 3; id++) {
+      await queue.add('m-1', seg(id));
+    }
+
+    int calls = 0;
+    await queue.flush('m-1', (
+      String meetingId,
+      List<Map<String, Object>> segments,
+      String lang,
+    ) async {
+      calls++;
+      if (calls == 1) {
+        // Captured while the first batch is in flight
+        await queue.add('m-1', seg(4));
+        return <String, dynamic>{};
+      }
+      throw const ApiException('POST transcript failed', 503);
+    }, force: true);
+
+    expect(calls, 2);
+    expect(queue.pendingCount('m-1'), 1);
+    await queue.close('m-1');
+
+    final List<Object?> resent = <Object?>[];
+    await TranscriptUploadQueue.inDirectory(dir).drainOrphans((
+      String meetingId,
+      List<Map<String, Object>> segments,
+      String lang,
+    ) async {
+      resent.addAll(segments.map((Map<String, Object> s) => s['id']));
+      return <String, dynamic>{};
+    });
+
+    expect(resent, <Object?>[4]);
+    expect(journalOf('m-1').existsSync(), isFalse);
+  });
+
+  test('a 404 drops everything queued for the meeting', () async {
+    final TranscriptUploadQueue queue = TranscriptUploadQueue.inDirectory(dir);
+    await queue.open('m-1', language: 'es');
+    await queue.add('m-1', seg(1));
+    await queue.add('m-1', seg(2));
+
+    await queue.flush('m-1', (
+      String meetingId,
+      List<Map<String, Object>> segments,
+      String lang,
+    ) async {
+      throw const ApiException('Meeting not found', 404);
+    }, force: true);
+
+    expect(queue.pendingCount('m-1'), 0);
+    await queue.close('m-1');
+    expect(journalOf('m-1').existsSync(), isFalse);
+  });
+}
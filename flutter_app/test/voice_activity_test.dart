@@ -0,0 +1,109 @@
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:meetmind/services/voice_activity.dart';
+
+const int _frameBytes = VoiceActivityGate.frameSamples * 2;
+
+/// [count] 20 ms frames of constant [amplitude] (RMS == amplitude).
+Uint8List _frames(int count, int amplitude) {
+  final ByteData data = ByteData(count * _frameBytes);
+  for (int i = 0; i < count * VoiceActivityGate.frameSamples; i++) {
+    data.setInt16(i * 2, amplitude, Endian.little);
+  }
+  return data.buffer.asUint8List();
+}
+
+Uint8List _concat(List<Uint8List> parts) {
+  final BytesBuilder out = BytesBuilder();
+  for (final Uint8List part in parts) {
+    out.add(part);
+  }
+  return out.takeBytes();
+}
+
+class _Recorder {
+  final List<Uint8List> audio = <Uint8List>[];
+  int starts = 0;
+  int ends = 0;
+
+  late final VoiceActivityGate gate = VoiceActivityGate(
+    onAudio: audio.add,
+    onSpeechStart: () => starts++,
+    onSpeechEnd: () => ends++,
+  );
+
+  void feed(Uint8List bytes, int chunk) {
+    for (int offset = 0; offset < bytes.length; offset += chunk) {
+      final int end =
+          offset + chunk < bytes.length ? offset + chunk : bytes.length;
+      gate.add(Uint8List.sublistView(bytes, offset, end));
+    }
+  }
+}
+
+void main() {
+  // 400 ms of silence, 200 ms of speech, 1 s of silence
+  final Uint8List meeting = _concat(<Uint8List>[
+    _frames(20, 0),
+    _frames(10, 3000),
+    _frames(50, 0),
+  ]);
+
+  for (final int chunk in <int>[_frameBytes, 333, 1]) {
+    test('opens on speech and closes after the hangover ($chunk-byte chunks)',
+        () {
+      final _Recorder rec = _Recorder()..feed(meeting, chunk);
+
+      expect(rec.starts, 1);
+      expect(rec.ends, 1);
+      expect(rec.gate.isSpeech, isFalse);
+      // 300 ms pre-roll (12 silent + the 3 loud frames that opened it)
+      expect(rec.audio.first.length, 15 * _frameBytes);
+      // Pre-roll, 7 more loud frames, and the 40 quiet frames of hangover:
+      // frames 8..69 of the input, byte for byte
+      final Uint8List sent = _concat(rec.audio);
+      expect(sent.length, 62 * _frameBytes);
+      expect(sent, meeting.sublist(8 * _frameBytes, 70 * _frameBytes));
+    });
+  }
+
+  test('pre-roll holds only what was heard before the gate opened', () {
+    final _Recorder rec = _Recorder()..feed(_frames(3, 3000), _frameBytes);
+
+    expect(rec.starts, 1);
+    expect(rec.audio.single.length, 3 * _frameBytes);
+  });
+
+  test('a partial frame waits for the rest of its bytes', () {
+    final Uint8List loud = _frames(3, 3000);
+    final _Recorder rec = _Recorder()
+      ..feed(_frames(20, 0), _frameBytes)
+      ..feed(Uint8List.sublistView(loud, 0, loud.length - 1), 333);
+
+    expect(rec.starts, 0);
+    rec.feed(Uint8List.sublistView(loud, loud.length - 1), 1);
+    expect(rec.starts, 1);
+  });
+
+  test('sustained noise is absorbed into the floor and closes the gate', () {
+    final _Recorder rec = _Recorder()
+      ..feed(_frames(20, 0), _frameBytes)
+      ..feed(_frames(600, 3000), _frameBytes);
+
+    expect(rec.starts, 1);
+    expect(rec.ends, 1);
+    expect(rec.gate.isSpeech, isFalse);
+  });
+
+  test('reset drops the pre-roll and a partial frame', () {
+    final _Recorder rec = _Recorder()
+      ..feed(_frames(2, 3000), _frameBytes)
+      ..feed(_frames(1, 3000).sublist(0, 101), 101);
+    rec.gate.reset();
+    rec.feed(_frames(2, 3000), _frameBytes);
+
+    expect(rec.starts, 0);
+    expect(rec.audio, isEmpty);
+  });
+}
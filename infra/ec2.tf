@@ -5,13 +5,23 @@
 
 # --- Data sources ---
 
+# AMI architecture follows the instance type, so switching to Graviton
+# (c7g/t4g) is a one-variable change — the backend image is multi-arch.
+data "aws_ec2_instance_type" "selected" {
+  instance_type = var.instance_type
+}
+
+locals {
+  ami_arch = contains(data.aws_ec2_instance_type.selected.supported_architectures, "arm64") ? "arm64" : "x86_64"
+}
+
 data "aws_ami" "amazon_linux" {
   most_recent = true
   owners      = ["amazon"]
 
   filter {
     name   = "name"
-    values = ["al2023-ami-*-x86_64"]
+    values = ["al2023-ami-*-${local.ami_arch}"]
   }
 
   filter {
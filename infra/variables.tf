@@ -29,7 +29,7 @@ variable "aws_profile" {
 # --- EC2 ---
 
 variable "instance_type" {
-  description = "EC2 instance type (t3.small = 2 vCPU, 2GB, ~$15/mo)"
+  description = "EC2 instance type (t3.small = 2 vCPU, 2GB, ~$15/mo; Graviton types like c7g select an arm64 AMI)"
   type        = string
   default     = "t3.small"
 }
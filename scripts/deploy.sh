@@ -25,6 +25,7 @@ err()  { echo -e "${RED}[ERROR]${NC} $*" >&2; exit 1; }
 log "Validating prerequisites..."
 command -v aws >/dev/null 2>&1 || err "aws CLI not found"
 command -v docker >/dev/null 2>&1 || err "docker not found"
+docker buildx version >/dev/null 2>&1 || err "docker buildx not found"
 
 # --- Step 1: Get ECR repository URL ---
 log "Getting ECR repository URL..."
@@ -39,21 +40,26 @@ TAG="${1:-latest}"
 IMAGE="${ECR_REPO}:${TAG}"
 log "Target image: ${IMAGE}"
 
-# --- Step 2: Build Docker image ---
-log "Building Docker image..."
-docker build -t "${IMAGE}" -f backend/Dockerfile backend/
-
-# --- Step 3: Login to ECR ---
+# --- Step 2: Login to ECR ---
 log "Logging in to ECR..."
 aws ecr get-login-password --region "${AWS_REGION}" --profile "${AWS_PROFILE}" | \
   docker login --username AWS --password-stdin "${ECR_REPO%%/*}"
 
-# --- Step 4: Push to ECR ---
-log "Pushing image to ECR..."
-docker push "${IMAGE}"
+# --- Step 3: Build + push multi-arch image ---
+# One tag for x86 (t3/c6i) and Graviton (c7g); each host pulls its own
+# architecture, so the instance type can change without a rebuild.
+PLATFORMS="${PLATFORMS:-linux/amd64,linux/arm64}"
+log "Building ${PLATFORMS} image..."
+docker buildx build \
+  --platform "${PLATFORMS}" \
+  --provenance=false \
+  -t "${IMAGE}" \
+  -f backend/Dockerfile \
+  --push \
+  backend/
 log "Image pushed: ${IMAGE}"
 
-# --- Step 5: Get EC2 public IP ---
+# --- Step 4: Get EC2 public IP ---
 log "Getting EC2 instance IP..."
 EC2_IP=$(aws ec2 describe-instances \
   --filters "Name=tag:Name,Values=${PROJECT}-production" "Name=instance-state-name,Values=running" \
@@ -64,7 +70,7 @@ EC2_IP=$(aws ec2 describe-instances \
 
 log "EC2 IP: ${EC2_IP}"
 
-# --- Step 6: Get secrets from SSM ---
+# --- Step 5: Get secrets from SSM ---
 log "Fetching secrets from SSM..."
 OPENAI_KEY=$(aws ssm get-parameter \
   --name "${SSM_PREFIX}/openai-api-key" \
@@ -82,7 +88,7 @@ HF_TOKEN=$(aws ssm get-parameter \
   --query 'Parameter.Value' \
   --output text 2>/dev/null) || true
 
-# --- Step 7: Deploy to EC2 ---
+# --- Step 6: Deploy to EC2 ---
 log "Deploying to EC2..."
 
 # Determine SSH key
@@ -113,14 +119,15 @@ export TAG="${TAG}"
 export MEETMIND_OPENAI_API_KEY="${OPENAI_KEY}"
 export MEETMIND_HUGGINGFACE_TOKEN="${HF_TOKEN}"
 
-# Pull and restart
+# Pull first so the old container keeps serving during the download, then
+# restart — it drains on SIGTERM and live sessions resume in the new one
 docker compose -f docker-compose.prod.yml pull
 docker compose -f docker-compose.prod.yml up -d --remove-orphans
 
-# Wait for health
+# Wait for readiness (database + schema up, sessions can resume)
 echo "Waiting for health check..."
 for i in {1..30}; do
-  if curl -sf http://localhost:8000/health > /dev/null 2>&1; then
+  if curl -sf http://localhost:8000/health/ready > /dev/null 2>&1; then
     echo "✅ Backend healthy!"
     break
   fi
@@ -128,7 +135,7 @@ for i in {1..30}; do
 done
 REMOTE
 
-# --- Step 8: Verify ---
+# --- Step 7: Verify ---
 log "Verifying deployment..."
 sleep 5
 DOMAIN=$(grep -oP '^\S+' backend/Caddyfile | head -1 | tr -d '{')
@@ -2,7 +2,7 @@
 # ============================================================================
 # MeetMind Quality Gate — Based on MEETMIND_DEVELOPMENT_STANDARDS.md
 # ============================================================================
-# Usage: ./scripts/quality-check.sh [--fix]
+# Usage: ./scripts/quality-check.sh [--fix] [--perf]
 #
 # Verifies ALL development standards:
 #   SEC-001: No hardcoded secrets (gitleaks)
@@ -13,6 +13,7 @@
 #   DOC-001: Type hints & linting (mypy --strict)
 #   LINT: 0 errors (ruff)
 #   FORMAT: 100% formatted (ruff format)
+#   PERF-001: No regressions vs. recorded baseline (--perf only)
 # ============================================================================
 
 set -uo pipefail
@@ -30,9 +31,13 @@ BACKEND_DIR="$ROOT_DIR/backend"
 FLUTTER_DIR="$ROOT_DIR/flutter_app"
 
 FIX_MODE=false
-if [[ "${1:-}" == "--fix" ]]; then
-    FIX_MODE=true
-fi
+PERF_MODE=false
+for arg in "$@"; do
+    case "$arg" in
+        --fix) FIX_MODE=true ;;
+        --perf) PERF_MODE=true ;;
+    esac
+done
 
 PASSED=0
 FAILED=0
@@ -398,6 +403,32 @@ if $ALL_FILES_OK; then
     pass "STRUCTURE: All required project files present"
 fi
 
+# ============================================================================
+# SECTION 6: PERFORMANCE (opt-in, slow)
+# ============================================================================
+if $PERF_MODE; then
+    echo ""
+    echo -e "${BLUE}━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━${NC}"
+    echo -e "${BLUE}  ⏱️  PERFORMANCE${NC}"
+    echo -e "${BLUE}━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━${NC}"
+
+    cd "$BACKEND_DIR"
+
+    # PERF-001: Pinned benchmarks vs. the baseline for this host class
+    echo ""
+    PERF_OUTPUT=$(uv run python scripts/perf_gate.py check 2>&1)
+    PERF_EXIT=$?
+    if [[ $PERF_EXIT -eq 0 ]]; then
+        pass "PERF-001: No regressions beyond noise"
+    elif [[ $PERF_EXIT -eq 2 ]]; then
+        warn "PERF-001: No comparable baseline — run: uv run python scripts/perf_gate.py record"
+        echo "$PERF_OUTPUT" | tail -3
+    else
+        fail "PERF-001: Performance regression vs. baseline"
+        echo "$PERF_OUTPUT" | tail -20
+    fi
+fi
+
 # ============================================================================
 # RESULTS
 # ============================================================================